@@ -35,7 +35,11 @@ HEADERS = \
     qtwebenginecoreglobal_p.h \
     qwebenginecookiestore.h \
     qwebenginecookiestore_p.h \
+    qwebenginehttpcacheentry.h \
+    qwebenginehttpcacheentry_p.h \
     qwebenginehttprequest.h \
+    qwebenginenetworkmetrics.h \
+    qwebenginenetworkmetrics_p.h \
     qwebenginequotarequest.h \
     qwebengineregisterprotocolhandlerrequest.h \
     qwebengineurlrequestinterceptor.h \
@@ -47,7 +51,9 @@ HEADERS = \
 SOURCES = \
     qtwebenginecoreglobal.cpp \
     qwebenginecookiestore.cpp \
+    qwebenginehttpcacheentry.cpp \
     qwebenginehttprequest.cpp \
+    qwebenginenetworkmetrics.cpp \
     qwebenginequotarequest.cpp \
     qwebengineregisterprotocolhandlerrequest.cpp \
     qwebengineurlrequestinfo.cpp \
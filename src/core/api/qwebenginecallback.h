@@ -45,6 +45,7 @@
 #include <QtCore/qshareddata.h>
 #include <QtCore/qstring.h>
 #include <QtCore/qvariant.h>
+#include <QtCore/qvector.h>
 
 namespace QtWebEngineCore {
 class CallbackDirectory;
@@ -52,6 +53,10 @@ class CallbackDirectory;
 
 QT_BEGIN_NAMESPACE
 
+class QImage;
+class QWebEngineHttpCacheEntry;
+class QWebEngineHttpCacheStatistics;
+
 namespace QtWebEnginePrivate {
 
 template <typename T>
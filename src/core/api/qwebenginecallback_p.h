@@ -53,21 +53,26 @@
 
 #include "qtwebenginecoreglobal_p.h"
 #include "qwebenginecallback.h"
+#include "qwebenginehttpcacheentry.h"
 
 #include <QByteArray>
 #include <QHash>
 #include <QSharedData>
 #include <QString>
 #include <QVariant>
+#include <QVector>
 #include <type_traits>
 
-// keep in sync with Q_DECLARE_SHARED... in qwebenginecallback.h
+// keep in sync with Q_DECLARE_SHARED... in qwebenginecallback.h, qwebenginepage.h and qwebengineprofile.h
 #define FOR_EACH_TYPE(F) \
     F(bool) \
     F(int) \
     F(const QString &) \
     F(const QByteArray &) \
-    F(const QVariant &)
+    F(const QVariant &) \
+    F(const QImage &) \
+    F(const QVector<QWebEngineHttpCacheEntry> &) \
+    F(const QWebEngineHttpCacheStatistics &)
 
 namespace QtWebEngineCore {
 
@@ -76,6 +81,8 @@ class CallbackDirectory {
     void invokeInternal(quint64 callbackId, T result);
     template<typename T>
     void invokeEmptyInternal(QtWebEnginePrivate::QWebEngineCallbackPrivateBase<T> *callback);
+    template<typename T>
+    void invokePartialInternal(quint64 callbackId, T result);
 
 public:
     ~CallbackDirectory()
@@ -113,6 +120,15 @@ public:
     FOR_EACH_TYPE(DEFINE_INVOKE_FOR_TYPE)
 #undef DEFINE_INVOKE_FOR_TYPE
 
+    // Calls the callback but keeps it registered, for callbacks receiving a stream of results.
+    // The final result must be delivered through invoke().
+#define DEFINE_INVOKE_PARTIAL_FOR_TYPE(Type) \
+    void invokePartial(quint64 callbackId, Type result) { \
+        invokePartialInternal<Type>(callbackId, std::forward<Type>(result)); \
+    }
+    FOR_EACH_TYPE(DEFINE_INVOKE_PARTIAL_FOR_TYPE)
+#undef DEFINE_INVOKE_PARTIAL_FOR_TYPE
+
     template <typename A>
     void invokeDirectly(const QWebEngineCallback<typename std::remove_reference<A>::type &> &callback, A &argument)
     {
@@ -180,6 +196,19 @@ void CallbackDirectory::invokeInternal(quint64 callbackId, T result)
     delete ptr;
 }
 
+template<typename T>
+inline
+void CallbackDirectory::invokePartialInternal(quint64 callbackId, T result)
+{
+    CallbackSharedDataPointerBase * const sharedPtrBase = m_callbackMap.value(callbackId);
+    if (!sharedPtrBase)
+        return;
+
+    auto ptr = static_cast<CallbackSharedDataPointer<T> *>(sharedPtrBase);
+    Q_ASSERT(ptr);
+    (*ptr->callback)(std::forward<T>(result));
+}
+
 template<typename T>
 inline
 void CallbackDirectory::invokeEmptyInternal(QtWebEnginePrivate::QWebEngineCallbackPrivateBase<T> *callback)
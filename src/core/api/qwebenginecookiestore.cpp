@@ -42,6 +42,7 @@
 
 #include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 
+#include "browser_context_adapter.h"
 #include "net/cookie_monster_delegate_qt.h"
 
 #include <QByteArray>
@@ -68,6 +69,7 @@ QWebEngineCookieStorePrivate::QWebEngineCookieStorePrivate(QWebEngineCookieStore
     , m_deleteAllCookiesPending(false)
     , m_getAllCookiesPending(false)
     , delegate(0)
+    , browserContextAdapter(0)
 {
 }
 
@@ -204,6 +206,13 @@ bool QWebEngineCookieStorePrivate::canAccessCookies(const QUrl &firstPartyUrl, c
     return filterCallback(request);
 }
 
+void QWebEngineCookieStorePrivate::cookieFilterChanged()
+{
+    // Renderers answer storage access checks from a snapshot that depends on the filter.
+    if (browserContextAdapter)
+        browserContextAdapter->updateStorageAccessPolicy();
+}
+
 /*!
     \class QWebEngineCookieStore
     \inmodule QtWebEngineCore
@@ -358,13 +367,15 @@ void QWebEngineCookieStore::deleteAllCookies()
 
     \note The cookie filter also controls other features with tracking capabilities similar to
     those of cookies; including IndexedDB, DOM storage, filesystem API, service workers,
-    and AppCache.
+    and AppCache. For IndexedDB, DOM storage, web databases and the filesystem API, the result
+    of the filter is cached per origin in each render process until a new filter is set.
 
     \sa deleteAllCookies(), loadAllCookies()
 */
 void QWebEngineCookieStore::setCookieFilter(const std::function<bool(const FilterRequest &)> &filterCallback)
 {
     d_ptr->filterCallback = filterCallback;
+    d_ptr->cookieFilterChanged();
 }
 
 /*!
@@ -374,6 +385,7 @@ void QWebEngineCookieStore::setCookieFilter(const std::function<bool(const Filte
 void QWebEngineCookieStore::setCookieFilter(std::function<bool(const FilterRequest &)> &&filterCallback)
 {
     d_ptr->filterCallback = std::move(filterCallback);
+    d_ptr->cookieFilterChanged();
 }
 
 /*!
@@ -61,6 +61,7 @@
 #include <QUrl>
 
 namespace QtWebEngineCore {
+class BrowserContextAdapter;
 class CookieMonsterDelegateQt;
 }
 
@@ -86,6 +87,7 @@ public:
     bool m_getAllCookiesPending;
 
     QtWebEngineCore::CookieMonsterDelegateQt *delegate;
+    QtWebEngineCore::BrowserContextAdapter *browserContextAdapter;
 
     QWebEngineCookieStorePrivate(QWebEngineCookieStore *q);
 
@@ -98,6 +100,7 @@ public:
     void getAllCookies();
 
     bool canAccessCookies(const QUrl &firstPartyUrl, const QUrl &url);
+    void cookieFilterChanged();
 
     void onGetAllCallbackResult(qint64 callbackId, const QByteArray &cookieList);
     void onSetCallbackResult(qint64 callbackId, bool success);
@@ -0,0 +1,212 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qwebenginehttpcacheentry.h"
+#include "qwebenginehttpcacheentry_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QWebEngineHttpCacheEntry
+    \since 5.12
+    \ingroup webengine
+    \inmodule QtWebEngineCore
+
+    \brief The QWebEngineHttpCacheEntry class describes a response stored in the HTTP cache
+    of a profile.
+
+    Entries are listed by QWebEngineProfile::requestHttpCacheEntries(). The object is a
+    snapshot taken while the cache was enumerated and does not follow later changes of
+    the cache.
+*/
+
+/*!
+    Constructs an empty cache entry.
+*/
+QWebEngineHttpCacheEntry::QWebEngineHttpCacheEntry()
+    : d(new QWebEngineHttpCacheEntryPrivate)
+{
+}
+
+/*!
+    \internal
+*/
+QWebEngineHttpCacheEntry::QWebEngineHttpCacheEntry(QWebEngineHttpCacheEntryPrivate *p)
+    : d(p)
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QWebEngineHttpCacheEntry::QWebEngineHttpCacheEntry(const QWebEngineHttpCacheEntry &other)
+    : d(other.d)
+{
+}
+
+/*!
+    Disposes of the QWebEngineHttpCacheEntry object.
+*/
+QWebEngineHttpCacheEntry::~QWebEngineHttpCacheEntry()
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QWebEngineHttpCacheEntry &QWebEngineHttpCacheEntry::operator=(const QWebEngineHttpCacheEntry &other)
+{
+    d = other.d;
+    return *this;
+}
+
+/*!
+    \fn void QWebEngineHttpCacheEntry::swap(QWebEngineHttpCacheEntry &other)
+
+    Swaps this entry with \a other. This function is very fast and never fails.
+*/
+
+/*!
+    Returns the URL of the cached response.
+*/
+QUrl QWebEngineHttpCacheEntry::url() const
+{
+    return d->url;
+}
+
+/*!
+    Returns the size of the entry in bytes, that is the stored response headers and body.
+*/
+qint64 QWebEngineHttpCacheEntry::size() const
+{
+    return d->size;
+}
+
+/*!
+    Returns when the entry was last read or written.
+*/
+QDateTime QWebEngineHttpCacheEntry::lastUsed() const
+{
+    return d->lastUsed;
+}
+
+/*!
+    \class QWebEngineHttpCacheStatistics
+    \since 5.12
+    \ingroup webengine
+    \inmodule QtWebEngineCore
+
+    \brief The QWebEngineHttpCacheStatistics class holds the size of the HTTP cache of a profile.
+
+    The statistics are computed by QWebEngineProfile::requestHttpCacheStatistics().
+*/
+
+/*!
+    Constructs invalid statistics.
+*/
+QWebEngineHttpCacheStatistics::QWebEngineHttpCacheStatistics()
+    : d(new QWebEngineHttpCacheStatisticsPrivate)
+{
+}
+
+/*!
+    \internal
+*/
+QWebEngineHttpCacheStatistics::QWebEngineHttpCacheStatistics(QWebEngineHttpCacheStatisticsPrivate *p)
+    : d(p)
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QWebEngineHttpCacheStatistics::QWebEngineHttpCacheStatistics(const QWebEngineHttpCacheStatistics &other)
+    : d(other.d)
+{
+}
+
+/*!
+    Disposes of the QWebEngineHttpCacheStatistics object.
+*/
+QWebEngineHttpCacheStatistics::~QWebEngineHttpCacheStatistics()
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QWebEngineHttpCacheStatistics &QWebEngineHttpCacheStatistics::operator=(const QWebEngineHttpCacheStatistics &other)
+{
+    d = other.d;
+    return *this;
+}
+
+/*!
+    \fn void QWebEngineHttpCacheStatistics::swap(QWebEngineHttpCacheStatistics &other)
+
+    Swaps these statistics with \a other. This function is very fast and never fails.
+*/
+
+/*!
+    Returns whether the statistics could be computed. They are invalid when the profile has
+    no HTTP cache or the cache could not be opened.
+*/
+bool QWebEngineHttpCacheStatistics::isValid() const
+{
+    return d->valid;
+}
+
+/*!
+    Returns the number of entries in the cache.
+*/
+qint64 QWebEngineHttpCacheStatistics::entryCount() const
+{
+    return d->entryCount;
+}
+
+/*!
+    Returns the size of all entries of the cache in bytes.
+*/
+qint64 QWebEngineHttpCacheStatistics::totalSize() const
+{
+    return d->totalSize;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,112 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QWEBENGINEHTTPCACHEENTRY_H
+#define QWEBENGINEHTTPCACHEENTRY_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtCore/qdatetime.h>
+#include <QtCore/qshareddata.h>
+#include <QtCore/qurl.h>
+
+namespace QtWebEngineCore {
+class HttpCacheControllerQt;
+}
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineHttpCacheEntryPrivate;
+class QWebEngineHttpCacheStatisticsPrivate;
+
+class QWEBENGINE_EXPORT QWebEngineHttpCacheEntry
+{
+public:
+    QWebEngineHttpCacheEntry();
+    QWebEngineHttpCacheEntry(const QWebEngineHttpCacheEntry &other);
+    ~QWebEngineHttpCacheEntry();
+#ifdef Q_COMPILER_RVALUE_REFS
+    QWebEngineHttpCacheEntry &operator=(QWebEngineHttpCacheEntry &&other) Q_DECL_NOTHROW { swap(other);
+                                                                                           return *this; }
+#endif
+    QWebEngineHttpCacheEntry &operator=(const QWebEngineHttpCacheEntry &other);
+
+    void swap(QWebEngineHttpCacheEntry &other) Q_DECL_NOTHROW { qSwap(d, other.d); }
+
+    QUrl url() const;
+    qint64 size() const;
+    QDateTime lastUsed() const;
+
+private:
+    friend class QtWebEngineCore::HttpCacheControllerQt;
+    QWebEngineHttpCacheEntry(QWebEngineHttpCacheEntryPrivate *p);
+    QSharedDataPointer<QWebEngineHttpCacheEntryPrivate> d;
+};
+
+Q_DECLARE_SHARED(QWebEngineHttpCacheEntry)
+
+class QWEBENGINE_EXPORT QWebEngineHttpCacheStatistics
+{
+public:
+    QWebEngineHttpCacheStatistics();
+    QWebEngineHttpCacheStatistics(const QWebEngineHttpCacheStatistics &other);
+    ~QWebEngineHttpCacheStatistics();
+#ifdef Q_COMPILER_RVALUE_REFS
+    QWebEngineHttpCacheStatistics &operator=(QWebEngineHttpCacheStatistics &&other) Q_DECL_NOTHROW { swap(other);
+                                                                                                     return *this; }
+#endif
+    QWebEngineHttpCacheStatistics &operator=(const QWebEngineHttpCacheStatistics &other);
+
+    void swap(QWebEngineHttpCacheStatistics &other) Q_DECL_NOTHROW { qSwap(d, other.d); }
+
+    bool isValid() const;
+    qint64 entryCount() const;
+    qint64 totalSize() const;
+
+private:
+    friend class QtWebEngineCore::HttpCacheControllerQt;
+    QWebEngineHttpCacheStatistics(QWebEngineHttpCacheStatisticsPrivate *p);
+    QSharedDataPointer<QWebEngineHttpCacheStatisticsPrivate> d;
+};
+
+Q_DECLARE_SHARED(QWebEngineHttpCacheStatistics)
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINEHTTPCACHEENTRY_H
@@ -38,6 +38,8 @@
 ****************************************************************************/
 
 #include "qplatformdefs.h"
+#include <QtCore/qiodevice.h>
+#include <QtCore/qpointer.h>
 #include <QtCore/qshareddata.h>
 #include <QtWebEngineCore/qwebenginehttprequest.h>
 #include <algorithm>
@@ -76,6 +78,8 @@ public:
     typedef QVector<HeaderPair> Headers;
     Headers headers;
     QByteArray postData;
+    QString postDataFile;
+    QPointer<QIODevice> postDataDevice;
 
     inline QWebEngineHttpRequestPrivate()
     {
@@ -91,6 +95,9 @@ public:
         method = other.method;
         url = other.url;
         headers = other.headers;
+        postData = other.postData;
+        postDataFile = other.postDataFile;
+        postDataDevice = other.postDataDevice;
     }
 
     inline bool operator==(const QWebEngineHttpRequestPrivate &other) const
@@ -261,11 +268,89 @@ QByteArray QWebEngineHttpRequest::postData() const
 /*!
     Sets the (raw) POST data this WebEngine request contains to be \a postData.
 
+    This replaces a file or device set with setPostDataFile() or
+    setPostDataDevice().
+
     \sa postData()
 */
 void QWebEngineHttpRequest::setPostData(const QByteArray &postData)
 {
     d->postData = postData;
+    d->postDataFile.clear();
+    d->postDataDevice = nullptr;
+}
+
+/*!
+    \since 5.12
+
+    Returns the path of the file whose contents are sent as the POST data of
+    this WebEngine request, or an empty string if none is set.
+
+    \sa setPostDataFile()
+*/
+QString QWebEngineHttpRequest::postDataFile() const
+{
+    return d->postDataFile;
+}
+
+/*!
+    \since 5.12
+
+    Sets the POST data of this WebEngine request to be the contents of the file
+    at \a filePath.
+
+    The file is not read into memory, but streamed to the server while the
+    request is uploaded, so it can be used for bodies that are too large to
+    hold in a QByteArray. The file must not change until the upload has finished.
+
+    This replaces data set with setPostData() or setPostDataDevice().
+
+    \sa postDataFile(), QWebEnginePage::uploadProgress()
+*/
+void QWebEngineHttpRequest::setPostDataFile(const QString &filePath)
+{
+    d->postDataFile = filePath;
+    d->postData.clear();
+    d->postDataDevice = nullptr;
+}
+
+/*!
+    \since 5.12
+
+    Returns the device the POST data of this WebEngine request is read from,
+    or \c nullptr if none is set.
+
+    \sa setPostDataDevice()
+*/
+QIODevice *QWebEngineHttpRequest::postDataDevice() const
+{
+    return d->postDataDevice;
+}
+
+/*!
+    \since 5.12
+
+    Sets the POST data of this WebEngine request to be the data that can be read
+    from \a device, starting at its current position.
+
+    The device must be open for reading when the request is loaded. If it is a
+    QFile, its contents are streamed from the underlying file just as with
+    setPostDataFile(), and the file must not change until the upload has
+    finished. Any other device is read in chunks into a temporary file when the
+    request is loaded, so the data does not have to fit into memory, and the
+    navigation only starts once all of its data has been read. The device must
+    stay open until then. The file is kept for as long as the navigation history
+    refers to it, so that the request can be submitted again on reload.
+
+    This replaces data set with setPostData() or setPostDataFile().
+
+    \sa postDataDevice(), QWebEnginePage::uploadProgress()
+*/
+void QWebEngineHttpRequest::setPostDataDevice(QIODevice *device)
+{
+    d->postDataDevice = device;
+    d->postData.clear();
+    d->postDataFile.clear();
 }
 
 /*!
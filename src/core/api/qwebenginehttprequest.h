@@ -49,6 +49,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QIODevice;
 
 class QWebEngineHttpRequestPrivate;
 
@@ -87,6 +88,12 @@ public:
     QByteArray postData() const;
     void setPostData(const QByteArray &postData);
 
+    QString postDataFile() const;
+    void setPostDataFile(const QString &filePath);
+
+    QIODevice *postDataDevice() const;
+    void setPostDataDevice(QIODevice *device);
+
     bool hasHeader(const QByteArray &headerName) const;
     QVector<QByteArray> headers() const;
     QByteArray header(const QByteArray &headerName) const;
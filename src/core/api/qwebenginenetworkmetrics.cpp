@@ -0,0 +1,191 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "qwebenginenetworkmetrics.h"
+#include "qwebenginenetworkmetrics_p.h"
+
+QT_BEGIN_NAMESPACE
+
+/*!
+    \class QWebEngineNetworkMetrics
+    \since 5.12
+    \ingroup webengine
+    \inmodule QtWebEngineCore
+
+    \brief The QWebEngineNetworkMetrics class holds a snapshot of the network traffic
+    of a profile or a page.
+
+    The counters are accumulated on the network thread while requests are running and
+    copied into a QWebEngineNetworkMetrics object by QWebEngineProfile::networkMetrics()
+    or QWebEnginePage::networkMetrics(). The object does not change afterwards, so it
+    can be kept around and compared to a later snapshot.
+
+    Only bytes that were actually transferred over the network are counted. Responses
+    served from the HTTP cache count as requests and cache hits, but add no received
+    bytes.
+*/
+
+/*!
+    Constructs a QWebEngineNetworkMetrics object with all counters set to zero.
+*/
+QWebEngineNetworkMetrics::QWebEngineNetworkMetrics()
+    : d(new QWebEngineNetworkMetricsPrivate)
+{
+}
+
+/*!
+    \internal
+*/
+QWebEngineNetworkMetrics::QWebEngineNetworkMetrics(QWebEngineNetworkMetricsPrivate *p)
+    : d(p)
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QWebEngineNetworkMetrics::QWebEngineNetworkMetrics(const QWebEngineNetworkMetrics &other)
+    : d(other.d)
+{
+}
+
+/*!
+    Disposes of the QWebEngineNetworkMetrics object.
+*/
+QWebEngineNetworkMetrics::~QWebEngineNetworkMetrics()
+{
+}
+
+/*!
+    Creates a copy of \a other.
+*/
+QWebEngineNetworkMetrics &QWebEngineNetworkMetrics::operator=(const QWebEngineNetworkMetrics &other)
+{
+    d = other.d;
+    return *this;
+}
+
+/*!
+    \fn void QWebEngineNetworkMetrics::swap(QWebEngineNetworkMetrics &other)
+
+    Swaps this snapshot with \a other. This function is very fast and never fails.
+*/
+
+/*!
+    Returns the number of bytes received over the network, including headers.
+*/
+qint64 QWebEngineNetworkMetrics::bytesReceived() const
+{
+    return d->bytesReceived;
+}
+
+/*!
+    Returns the number of bytes sent over the network, including headers.
+*/
+qint64 QWebEngineNetworkMetrics::bytesSent() const
+{
+    return d->bytesSent;
+}
+
+/*!
+    Returns the number of completed requests of all resource types.
+*/
+qint64 QWebEngineNetworkMetrics::requestCount() const
+{
+    qint64 count = 0;
+    for (int i = 0; i < QWebEngineNetworkMetricsPrivate::ResourceTypeSlots; ++i)
+        count += d->requests[i];
+    return count;
+}
+
+/*!
+    \overload
+
+    Returns the number of completed requests for resources of \a type.
+*/
+qint64 QWebEngineNetworkMetrics::requestCount(QWebEngineUrlRequestInfo::ResourceType type) const
+{
+    if (type < 0 || type >= QWebEngineUrlRequestInfo::ResourceTypeLast)
+        return d->requests[QWebEngineUrlRequestInfo::ResourceTypeLast];
+    return d->requests[type];
+}
+
+/*!
+    Returns the number of responses that were served from the HTTP cache.
+*/
+qint64 QWebEngineNetworkMetrics::cacheHitCount() const
+{
+    return d->cacheHits;
+}
+
+/*!
+    Returns the number of requests that completed with a network error.
+
+    Requests that were cancelled are not included.
+
+    \sa cancelledRequestCount()
+*/
+qint64 QWebEngineNetworkMetrics::failedRequestCount() const
+{
+    return d->failedRequests;
+}
+
+/*!
+    Returns the number of requests that were cancelled before they completed,
+    for example because the page navigated away or a request interceptor
+    ignored them.
+*/
+qint64 QWebEngineNetworkMetrics::cancelledRequestCount() const
+{
+    return d->cancelledRequests;
+}
+
+/*!
+    Returns the average time in milliseconds between sending a request and
+    receiving the response headers, or \c 0 if no response was received yet.
+*/
+qreal QWebEngineNetworkMetrics::averageTimeToFirstByte() const
+{
+    if (!d->timeToFirstByteCount)
+        return 0;
+    return qreal(d->timeToFirstByteTotal) / d->timeToFirstByteCount / 1000;
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,89 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef QWEBENGINENETWORKMETRICS_H
+#define QWEBENGINENETWORKMETRICS_H
+
+#include <QtWebEngineCore/qtwebenginecoreglobal.h>
+#include <QtWebEngineCore/qwebengineurlrequestinfo.h>
+#include <QtCore/qshareddata.h>
+
+namespace QtWebEngineCore {
+class NetworkMetricsQt;
+}
+
+QT_BEGIN_NAMESPACE
+
+class QWebEngineNetworkMetricsPrivate;
+
+class QWEBENGINE_EXPORT QWebEngineNetworkMetrics
+{
+public:
+    QWebEngineNetworkMetrics();
+    QWebEngineNetworkMetrics(const QWebEngineNetworkMetrics &other);
+    ~QWebEngineNetworkMetrics();
+#ifdef Q_COMPILER_RVALUE_REFS
+    QWebEngineNetworkMetrics &operator=(QWebEngineNetworkMetrics &&other) Q_DECL_NOTHROW { swap(other);
+                                                                                           return *this; }
+#endif
+    QWebEngineNetworkMetrics &operator=(const QWebEngineNetworkMetrics &other);
+
+    void swap(QWebEngineNetworkMetrics &other) Q_DECL_NOTHROW { qSwap(d, other.d); }
+
+    qint64 bytesReceived() const;
+    qint64 bytesSent() const;
+    qint64 requestCount() const;
+    qint64 requestCount(QWebEngineUrlRequestInfo::ResourceType type) const;
+    qint64 cacheHitCount() const;
+    qint64 failedRequestCount() const;
+    qint64 cancelledRequestCount() const;
+    qreal averageTimeToFirstByte() const;
+
+private:
+    friend class QtWebEngineCore::NetworkMetricsQt;
+    QWebEngineNetworkMetrics(QWebEngineNetworkMetricsPrivate *p);
+    QSharedDataPointer<QWebEngineNetworkMetricsPrivate> d;
+};
+
+Q_DECLARE_SHARED(QWebEngineNetworkMetrics)
+
+QT_END_NAMESPACE
+
+#endif // QWEBENGINENETWORKMETRICS_H
@@ -42,6 +42,8 @@
 #include "third_party/WebKit/public/web/WebAXEnums.h"
 #include "browser_accessibility_qt.h"
 
+#include <limits>
+
 using namespace blink;
 
 namespace content {
@@ -68,12 +70,18 @@ BrowserAccessibility *BrowserAccessibilityFactoryQt::Create()
 }
 
 #ifndef QT_NO_ACCESSIBILITY
+// Events are delivered at most once per frame, merged per node.
+static const int kEventFlushIntervalMs = 16;
+
 BrowserAccessibilityManagerQt::BrowserAccessibilityManagerQt(
     QObject *parentObject, const ui::AXTreeUpdate &initialTree,
     BrowserAccessibilityDelegate* delegate, BrowserAccessibilityFactory* factory)
       : BrowserAccessibilityManager(delegate, factory)
       , m_parentObject(parentObject)
 {
+    m_flushTimer.setSingleShot(true);
+    m_flushTimer.setInterval(kEventFlushIntervalMs);
+    QObject::connect(&m_flushTimer, &QTimer::timeout, [this]() { flushEvents(); });
     Initialize(initialTree);
 }
 
@@ -82,44 +90,351 @@ QAccessibleInterface *BrowserAccessibilityManagerQt::rootParentAccessible()
     return QAccessible::queryAccessibleInterface(m_parentObject);
 }
 
+void BrowserAccessibilityManagerQt::setMaxEventRate(int eventsPerSecond)
+{
+    m_maxEventRate = qMax(0, eventsPerSecond);
+    m_eventBudget = m_maxEventRate;
+    m_rateTimer.start();
+}
+
+void BrowserAccessibilityManagerQt::OnNodeWillBeDeleted(ui::AXTree *tree, ui::AXNode *node)
+{
+    if (m_geometryIndexValid) {
+        unindexNode(node->id());
+        m_staleGeometry.remove(node->id());
+    }
+    BrowserAccessibilityManager::OnNodeWillBeDeleted(tree, node);
+}
+
+void BrowserAccessibilityManagerQt::OnAtomicUpdateFinished(ui::AXTree *tree, bool root_changed,
+                                                           const std::vector<ui::AXTreeDelegate::Change> &changes)
+{
+    if (root_changed)
+        m_geometryIndexValid = false;
+    for (const ui::AXTreeDelegate::Change &change : changes) {
+        BrowserAccessibility *node = GetFromAXNode(change.node);
+        if (!node)
+            continue;
+        static_cast<BrowserAccessibilityQt*>(node)->invalidateCachedData();
+        // Scroll offsets and container bounds move the whole subtree.
+        invalidateGeometry(node);
+    }
+    BrowserAccessibilityManager::OnAtomicUpdateFinished(tree, root_changed, changes);
+}
+
+// Cells are large enough that most nodes span only a few of them.
+static const int kGeometryCellSize = 256;
+
+static inline int geometryCell(int coordinate)
+{
+    return coordinate >= 0 ? coordinate / kGeometryCellSize : (coordinate + 1) / kGeometryCellSize - 1;
+}
+
+static inline quint64 geometryCellKey(int cellX, int cellY)
+{
+    return (quint64(quint32(cellX)) << 32) | quint32(cellY);
+}
+
+void BrowserAccessibilityManagerQt::invalidateGeometry(BrowserAccessibility *node)
+{
+    if (!m_geometryIndexValid)
+        return;
+    if (node == GetRoot() || m_staleGeometry.size() > m_indexedBounds.size() / 2) {
+        // Rebuilding is cheaper than tracking most of the tree one by one.
+        m_geometryIndexValid = false;
+        return;
+    }
+    QVector<BrowserAccessibility *> nodes;
+    nodes.append(node);
+    while (!nodes.isEmpty()) {
+        BrowserAccessibility *current = nodes.takeLast();
+        m_staleGeometry.insert(current->GetId());
+        for (uint32_t i = 0; i < current->InternalChildCount(); ++i)
+            nodes.append(current->InternalGetChild(i));
+    }
+}
+
+void BrowserAccessibilityManagerQt::indexNode(BrowserAccessibility *node)
+{
+    const gfx::Rect bounds = node->GetPageBoundsRect();
+    if (bounds.IsEmpty())
+        return;
+    const QRect rect(bounds.x(), bounds.y(), bounds.width(), bounds.height());
+    m_indexedBounds.insert(node->GetId(), rect);
+    for (int x = geometryCell(rect.left()); x <= geometryCell(rect.right()); ++x)
+        for (int y = geometryCell(rect.top()); y <= geometryCell(rect.bottom()); ++y)
+            m_geometryCells[geometryCellKey(x, y)].append(node->GetId());
+}
+
+void BrowserAccessibilityManagerQt::unindexNode(int32_t nodeId)
+{
+    auto it = m_indexedBounds.find(nodeId);
+    if (it == m_indexedBounds.end())
+        return;
+    const QRect rect = *it;
+    m_indexedBounds.erase(it);
+    for (int x = geometryCell(rect.left()); x <= geometryCell(rect.right()); ++x) {
+        for (int y = geometryCell(rect.top()); y <= geometryCell(rect.bottom()); ++y) {
+            auto cell = m_geometryCells.find(geometryCellKey(x, y));
+            if (cell == m_geometryCells.end())
+                continue;
+            cell->removeOne(nodeId);
+            if (cell->isEmpty())
+                m_geometryCells.erase(cell);
+        }
+    }
+}
+
+void BrowserAccessibilityManagerQt::ensureGeometryIndex()
+{
+    if (m_geometryIndexValid) {
+        for (int32_t nodeId : qAsConst(m_staleGeometry)) {
+            unindexNode(nodeId);
+            if (BrowserAccessibility *node = GetFromID(nodeId))
+                indexNode(node);
+        }
+        m_staleGeometry.clear();
+        return;
+    }
+
+    m_geometryCells.clear();
+    m_indexedBounds.clear();
+    m_staleGeometry.clear();
+    m_geometryIndexValid = true;
+    BrowserAccessibility *root = GetRoot();
+    if (!root)
+        return;
+    QVector<BrowserAccessibility *> nodes;
+    nodes.append(root);
+    while (!nodes.isEmpty()) {
+        BrowserAccessibility *node = nodes.takeLast();
+        indexNode(node);
+        for (uint32_t i = 0; i < node->InternalChildCount(); ++i)
+            nodes.append(node->InternalGetChild(i));
+    }
+}
+
+BrowserAccessibility *BrowserAccessibilityManagerQt::childAtPoint(BrowserAccessibility *parent, const QPoint &pagePoint,
+                                                                  bool *indexed)
+{
+    BrowserAccessibility *firstChild = parent->PlatformGetChild(0);
+    *indexed = firstChild && firstChild->manager() == this;
+    if (!*indexed)
+        return nullptr;
+
+    ensureGeometryIndex();
+    auto cell = m_geometryCells.constFind(geometryCellKey(geometryCell(pagePoint.x()), geometryCell(pagePoint.y())));
+    if (cell == m_geometryCells.constEnd())
+        return nullptr;
+
+    // Like a linear scan, prefer the first child in document order.
+    BrowserAccessibility *hit = nullptr;
+    int hitIndex = 0;
+    for (int32_t nodeId : *cell) {
+        if (!m_indexedBounds.value(nodeId).contains(pagePoint))
+            continue;
+        BrowserAccessibility *node = GetFromID(nodeId);
+        if (!node || node->PlatformGetParent() != parent)
+            continue;
+        const int index = node->GetIndexInParent();
+        if (!hit || index < hitIndex) {
+            hit = node;
+            hitIndex = index;
+        }
+    }
+    return hit;
+}
+
 void BrowserAccessibilityManagerQt::FireBlinkEvent(ui::AXEvent event_type,
                                                    BrowserAccessibility* node)
+{
+    switch (event_type) {
+    case ui::AX_EVENT_FOCUS:
+        // Focus changes are only delayed by the rate limit, and must not overtake earlier changes.
+        queueFocusEvent(node);
+        flushEvents();
+        break;
+    case ui::AX_EVENT_CHECKED_STATE_CHANGED:
+        queueEvent(node, CheckedStateChanged);
+        break;
+    case ui::AX_EVENT_VALUE_CHANGED:
+        queueEvent(node, ValueChanged);
+        break;
+    case ui::AX_EVENT_CHILDREN_CHANGED:
+        queueEvent(node, StructureChanged);
+        break;
+    case ui::AX_EVENT_LAYOUT_COMPLETE:
+        queueEvent(node, LocationChanged);
+        break;
+    case ui::AX_EVENT_LOAD_COMPLETE:
+        break;
+    case ui::AX_EVENT_TEXT_CHANGED:
+        queueEvent(node, TextChanged);
+        break;
+    case ui::AX_EVENT_TEXT_SELECTION_CHANGED:
+        queueEvent(node, TextSelectionChanged);
+        break;
+    default:
+        break;
+    }
+}
+
+void BrowserAccessibilityManagerQt::queueEvent(BrowserAccessibility *node, PendingEventFlag flag)
+{
+    const int32_t id = node->GetId();
+    auto it = m_pendingIndex.constFind(id);
+    if (it != m_pendingIndex.constEnd()) {
+        m_pendingEvents[*it].flags |= flag;
+    } else {
+        m_pendingIndex.insert(id, m_pendingEvents.size());
+        m_pendingEvents.append({ id, flag });
+    }
+    if (!m_flushTimer.isActive())
+        m_flushTimer.start();
+}
+
+// Only the last focus change is of interest. It is not merged into the entry of the
+// node, so that it is delivered after every event queued before it.
+void BrowserAccessibilityManagerQt::queueFocusEvent(BrowserAccessibility *node)
+{
+    for (int i = 0; i < m_pendingEvents.size(); ++i) {
+        if (m_pendingEvents.at(i).flags == FocusChanged) {
+            m_pendingEvents.remove(i);
+            rebuildPendingIndex();
+            break;
+        }
+    }
+    m_pendingEvents.append({ node->GetId(), FocusChanged });
+}
+
+void BrowserAccessibilityManagerQt::rebuildPendingIndex()
+{
+    m_pendingIndex.clear();
+    for (int i = 0; i < m_pendingEvents.size(); ++i) {
+        if (m_pendingEvents.at(i).flags != FocusChanged)
+            m_pendingIndex.insert(m_pendingEvents.at(i).nodeId, i);
+    }
+}
+
+// A structure change of an ancestor already covers the subtree of |node|.
+bool BrowserAccessibilityManagerQt::hasPendingStructureChange(BrowserAccessibility *node) const
+{
+    for (BrowserAccessibility *ancestor = node->PlatformGetParent(); ancestor; ancestor = ancestor->PlatformGetParent()) {
+        if (ancestor->manager() != this)
+            break;
+        auto it = m_pendingIndex.constFind(ancestor->GetId());
+        if (it != m_pendingIndex.constEnd() && (m_pendingEvents.at(*it).flags & StructureChanged))
+            return true;
+    }
+    return false;
+}
+
+void BrowserAccessibilityManagerQt::flushEvents()
+{
+    // The order deliverEvents() uses, entries split by the rate limit are cut in this order.
+    static const PendingEventFlag deliveryOrder[] = {
+        StructureChanged, LocationChanged, CheckedStateChanged, ValueChanged,
+        TextChanged, TextSelectionChanged, FocusChanged
+    };
+
+    m_flushTimer.stop();
+    if (m_pendingEvents.isEmpty())
+        return;
+
+    const int flushInterval = m_maxEventRate > 0 ? qMax(kEventFlushIntervalMs, 1000 / m_maxEventRate)
+                                                 : kEventFlushIntervalMs;
+    int budget = std::numeric_limits<int>::max();
+    if (m_maxEventRate > 0) {
+        m_eventBudget = qMin<double>(m_maxEventRate,
+                                     m_eventBudget + m_rateTimer.restart() * m_maxEventRate / 1000.0);
+        budget = int(m_eventBudget);
+        if (budget == 0) {
+            // Keep merging until the budget allows the next event.
+            m_flushTimer.start(flushInterval);
+            return;
+        }
+    }
+
+    // Structure changes of ancestors are checked against all pending events first.
+    for (PendingEvents &events : m_pendingEvents) {
+        if (!(events.flags & StructureChanged))
+            continue;
+        BrowserAccessibility *node = GetFromID(events.nodeId);
+        if (node && hasPendingStructureChange(node))
+            events.flags &= ~StructureChanged;
+    }
+
+    // The events are taken in queue order. An entry with more events than the budget
+    // allows is split, and the rest of it stays first in the queue.
+    QVector<PendingEvents> events;
+    int taken = 0;
+    int spent = 0;
+    for (; taken < m_pendingEvents.size() && spent < budget; ++taken) {
+        PendingEvents &pending = m_pendingEvents[taken];
+        const int count = qPopulationCount(uint(pending.flags));
+        if (spent + count > budget) {
+            int flags = 0;
+            for (PendingEventFlag flag : deliveryOrder) {
+                if (spent == budget)
+                    break;
+                if (pending.flags & flag) {
+                    flags |= flag;
+                    ++spent;
+                }
+            }
+            pending.flags &= ~flags;
+            events.append({ pending.nodeId, flags });
+            break;
+        }
+        spent += count;
+        events.append(pending);
+    }
+    if (m_maxEventRate > 0)
+        m_eventBudget -= spent;
+
+    m_pendingEvents.remove(0, taken);
+    rebuildPendingIndex();
+    if (!m_pendingEvents.isEmpty())
+        m_flushTimer.start(flushInterval);
+
+    for (const PendingEvents &pending : qAsConst(events)) {
+        // Nodes removed since the event was queued are skipped.
+        BrowserAccessibility *node = GetFromID(pending.nodeId);
+        if (node && pending.flags)
+            deliverEvents(node, pending.flags);
+    }
+}
+
+void BrowserAccessibilityManagerQt::deliverEvents(BrowserAccessibility *node, int flags)
 {
     BrowserAccessibilityQt *iface = static_cast<BrowserAccessibilityQt*>(node);
 
-    switch (event_type) {
-    case ui::AX_EVENT_FOCUS: {
-        QAccessibleEvent event(iface, QAccessible::Focus);
+    if (flags & StructureChanged) {
+        QAccessibleEvent event(iface, QAccessible::ObjectReorder);
+        QAccessible::updateAccessibility(&event);
+    }
+    if (flags & LocationChanged) {
+        QAccessibleEvent event(iface, QAccessible::LocationChanged);
         QAccessible::updateAccessibility(&event);
-        break;
     }
-    case ui::AX_EVENT_CHECKED_STATE_CHANGED: {
+    if (flags & CheckedStateChanged) {
         QAccessible::State change;
         change.checked = true;
         QAccessibleStateChangeEvent event(iface, change);
         QAccessible::updateAccessibility(&event);
-        break;
     }
-    case ui::AX_EVENT_VALUE_CHANGED: {
+    if (flags & ValueChanged) {
         QVariant value;
         if (QAccessibleValueInterface *valueIface = iface->valueInterface())
             value = valueIface->currentValue();
         QAccessibleValueChangeEvent event(iface, value);
         QAccessible::updateAccessibility(&event);
-        break;
     }
-    case ui::AX_EVENT_CHILDREN_CHANGED:
-        break;
-    case ui::AX_EVENT_LAYOUT_COMPLETE:
-        break;
-    case ui::AX_EVENT_LOAD_COMPLETE:
-        break;
-    case ui::AX_EVENT_TEXT_CHANGED: {
+    if (flags & TextChanged) {
         QAccessibleTextUpdateEvent event(iface, -1, QString(), QString());
         QAccessible::updateAccessibility(&event);
-        break;
     }
-    case ui::AX_EVENT_TEXT_SELECTION_CHANGED: {
+    if (flags & TextSelectionChanged) {
         QAccessibleTextInterface *textIface = iface->textInterface();
         if (textIface) {
             int start = 0;
@@ -133,10 +448,10 @@ void BrowserAccessibilityManagerQt::FireBlinkEvent(ui::AXEvent event_type,
                 QAccessible::updateAccessibility(&event);
             }
         }
-        break;
     }
-    default:
-        break;
+    if (flags & FocusChanged) {
+        QAccessibleEvent event(iface, QAccessible::Focus);
+        QAccessible::updateAccessibility(&event);
     }
 }
 #endif // QT_NO_ACCESSIBILITY
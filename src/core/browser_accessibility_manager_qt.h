@@ -42,7 +42,13 @@
 
 #include "content/browser/accessibility/browser_accessibility_manager.h"
 #ifndef QT_NO_ACCESSIBILITY
+#include <QtCore/qelapsedtimer.h>
+#include <QtCore/qhash.h>
 #include <QtCore/qobject.h>
+#include <QtCore/qrect.h>
+#include <QtCore/qset.h>
+#include <QtCore/qtimer.h>
+#include <QtCore/qvector.h>
 
 QT_BEGIN_NAMESPACE
 class QAccessibleInterface;
@@ -68,9 +74,64 @@ public:
 
     QAccessibleInterface *rootParentAccessible();
 
+    // Caps the number of events delivered per second, 0 means no cap.
+    void setMaxEventRate(int eventsPerSecond);
+
+    // Returns the direct child of |parent| containing |pagePoint|, looked up
+    // in the geometry index of this tree. |indexed| is set to false if the
+    // children of |parent| are not part of this tree.
+    BrowserAccessibility *childAtPoint(BrowserAccessibility *parent, const QPoint &pagePoint, bool *indexed);
+    // Marks the bounds of |node| and its subtree as stale.
+    void invalidateGeometry(BrowserAccessibility *node);
+
+    // ui::AXTreeDelegate
+    void OnNodeWillBeDeleted(ui::AXTree *tree, ui::AXNode *node) override;
+    void OnAtomicUpdateFinished(ui::AXTree *tree, bool root_changed,
+                                const std::vector<ui::AXTreeDelegate::Change> &changes) override;
+
 private:
     Q_DISABLE_COPY(BrowserAccessibilityManagerQt)
+
+    // Events of one node waiting for the next flush, merged into one entry.
+    // Each flag is delivered as one event.
+    enum PendingEventFlag {
+        CheckedStateChanged = 0x1,
+        ValueChanged = 0x2,
+        TextChanged = 0x4,
+        TextSelectionChanged = 0x8,
+        StructureChanged = 0x10,
+        LocationChanged = 0x20,
+        FocusChanged = 0x40
+    };
+    struct PendingEvents {
+        int32_t nodeId;
+        int flags;
+    };
+
+    void queueEvent(BrowserAccessibility *node, PendingEventFlag flag);
+    void queueFocusEvent(BrowserAccessibility *node);
+    void rebuildPendingIndex();
+    void flushEvents();
+    void deliverEvents(BrowserAccessibility *node, int flags);
+    bool hasPendingStructureChange(BrowserAccessibility *node) const;
+
+    void ensureGeometryIndex();
+    void indexNode(BrowserAccessibility *node);
+    void unindexNode(int32_t nodeId);
+
     QObject *m_parentObject;
+    QVector<PendingEvents> m_pendingEvents;
+    QHash<int32_t, int> m_pendingIndex;
+    QTimer m_flushTimer;
+    QElapsedTimer m_rateTimer;
+    double m_eventBudget = 0;
+    int m_maxEventRate = 0;
+
+    // Grid of page coordinate cells to the ids of the nodes overlapping them.
+    QHash<quint64, QVector<int32_t>> m_geometryCells;
+    QHash<int32_t, QRect> m_indexedBounds;
+    QSet<int32_t> m_staleGeometry;
+    bool m_geometryIndexValid = false;
 };
 
 }
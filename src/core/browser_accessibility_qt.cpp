@@ -72,8 +72,23 @@ QObject *BrowserAccessibilityQt::object() const
     return 0;
 }
 
+// Containers with fewer children are hit tested without the geometry index.
+static const int kIndexedHitTestChildCount = 16;
+
 QAccessibleInterface *BrowserAccessibilityQt::childAt(int x, int y) const
 {
+    if (manager() && childCount() >= kIndexedHitTestChildCount) {
+        // The index works in page coordinates, which do not move with the view.
+        const gfx::Rect screenBounds = GetScreenBoundsRect();
+        const gfx::Rect pageBounds = GetPageBoundsRect();
+        const QPoint pagePoint(x - screenBounds.x() + pageBounds.x(), y - screenBounds.y() + pageBounds.y());
+        BrowserAccessibilityManagerQt *managerQt = static_cast<BrowserAccessibilityManagerQt*>(manager());
+        bool indexed = false;
+        BrowserAccessibility *hit = managerQt->childAtPoint(this, pagePoint, &indexed);
+        if (indexed)
+            return static_cast<BrowserAccessibilityQt*>(hit);
+    }
+
     for (int i = 0; i < childCount(); ++i) {
         QAccessibleInterface *childIface = child(i);
         Q_ASSERT(childIface);
@@ -152,19 +167,37 @@ int BrowserAccessibilityQt::indexOfChild(const QAccessibleInterface *iface) cons
 
 QString BrowserAccessibilityQt::text(QAccessible::Text t) const
 {
+    ui::AXStringAttribute attribute;
+    int slot;
     switch (t) {
     case QAccessible::Name:
-        return toQt(GetStringAttribute(ui::AX_ATTR_NAME));
+        attribute = ui::AX_ATTR_NAME;
+        slot = 0;
+        break;
     case QAccessible::Description:
-        return toQt(GetStringAttribute(ui::AX_ATTR_DESCRIPTION));
+        attribute = ui::AX_ATTR_DESCRIPTION;
+        slot = 1;
+        break;
     case QAccessible::Value:
-        return toQt(GetStringAttribute(ui::AX_ATTR_VALUE));
+        attribute = ui::AX_ATTR_VALUE;
+        slot = 2;
+        break;
     case QAccessible::Accelerator:
-        return toQt(GetStringAttribute(ui::AX_ATTR_KEY_SHORTCUTS));
-    default:
+        attribute = ui::AX_ATTR_KEY_SHORTCUTS;
+        slot = 3;
         break;
+    default:
+        return QString();
     }
-    return QString();
+    Q_STATIC_ASSERT(CachedTextCount == 4);
+
+    // The UTF-8 to UTF-16 conversion is done once per data change, text
+    // interface queries on editable text call this once per offset.
+    if (!(m_cachedTextMask & (1u << slot))) {
+        m_cachedText[slot] = toQt(GetStringAttribute(attribute));
+        m_cachedTextMask |= 1u << slot;
+    }
+    return m_cachedText[slot];
 }
 
 void BrowserAccessibilityQt::setText(QAccessible::Text t, const QString &text)
@@ -180,6 +213,26 @@ QRect BrowserAccessibilityQt::rect() const
 }
 
 QAccessible::Role BrowserAccessibilityQt::role() const
+{
+    if (m_cachedRole < 0)
+        m_cachedRole = computeRole();
+    return QAccessible::Role(m_cachedRole);
+}
+
+void BrowserAccessibilityQt::invalidateCachedData()
+{
+    m_cachedTextMask = 0;
+    for (QString &text : m_cachedText)
+        text.clear();
+    m_cachedRole = -1;
+}
+
+void BrowserAccessibilityQt::OnLocationChanged()
+{
+    static_cast<BrowserAccessibilityManagerQt*>(manager())->invalidateGeometry(this);
+}
+
+QAccessible::Role BrowserAccessibilityQt::computeRole() const
 {
     switch (GetRole()) {
     case ui::AX_ROLE_NONE:
@@ -81,6 +81,10 @@ public:
     void NativeAddReference() override;
     void NativeReleaseReference() override;
     bool IsNative() const override { return true; }
+    void OnLocationChanged() override;
+
+    // Drops the memoized text and role, called when the node data changed.
+    void invalidateCachedData();
 
     // QAccessibleActionInterface
     QStringList actionNames() const override;
@@ -142,6 +146,14 @@ public:
     QAccessibleInterface* table() const override;
 
     void modelChange(QAccessibleTableModelChangeEvent *event) override;
+
+private:
+    QAccessible::Role computeRole() const;
+
+    enum { CachedTextCount = 4 };
+    mutable QString m_cachedText[CachedTextCount];
+    mutable uint m_cachedTextMask = 0;
+    mutable int m_cachedRole = -1;
 };
 
 }
@@ -39,21 +39,40 @@
 
 #include "browser_context_adapter.h"
 
+#include "base/bind.h"
+#include "base/memory/memory_pressure_listener.h"
+#include "base/process/process.h"
+#include "base/process/process_metrics.h"
+#include "base/task_runner_util.h"
+#include "base/task_scheduler/post_task.h"
+#include "content/browser/renderer_host/render_process_host_impl.h"
 #include "content/browser/web_contents/web_contents_impl.h"
+#include "content/public/browser/browser_child_process_host.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/browsing_data_remover.h"
 #include "content/public/browser/download_manager.h"
+#include "content/public/browser/render_frame_host.h"
+#include "content/public/browser/render_process_host.h"
+#include "content/public/common/child_process_host.h"
 
+#include "api/qwebenginecookiestore_p.h"
+#include "browser_context_adapter_client.h"
+#include "common/qt_messages.h"
 #include "content_client_qt.h"
 #include "download_manager_delegate_qt.h"
+#include "net/http_auth_credential_store_qt.h"
+#include "net/network_metrics_qt.h"
+#include "net/ssl_host_state_delegate_qt.h"
 #include "net/url_request_context_getter_qt.h"
 #include "permission_manager_qt.h"
 #include "profile_qt.h"
 #include "renderer_host/user_resource_controller_host.h"
 #include "type_conversion.h"
 #include "visited_links_manager_qt.h"
+#include "web_contents_adapter.h"
 #include "web_engine_context.h"
 
+#include "net/http/http_auth.h"
 #include "net/proxy/proxy_service.h"
 
 #include "components/keyed_service/content/browser_context_dependency_manager.h"
@@ -63,7 +82,11 @@
 #include <QString>
 #include <QStandardPaths>
 
+#include <set>
+
 namespace {
+const int kLifecyclePolicyInterval = 1000;
+
 inline QString buildLocationFromStandardPath(const QString &standardPath, const QString &name) {
     QString location = standardPath;
     if (location.isEmpty())
@@ -83,7 +106,22 @@ BrowserContextAdapter::BrowserContextAdapter(const QString &storageName):
     , m_persistentCookiesPolicy(AllowPersistentCookies)
     , m_visitedLinksPolicy(TrackVisitedLinksOnDisk)
     , m_httpCacheMaxSize(0)
+    , m_storageAccessPolicy(AllowStorageAccess)
+    , m_downloadProgressInterval(0)
+    , m_lifecycleFreezeDelay(0)
+    , m_lifecycleMemoryBudget(0)
+    , m_samplingRendererMemory(false)
+    , m_maximumSpareRenderProcesses(1)
+    , m_requestedSpareRenderProcesses(0)
+    , m_spareRenderProcessId(content::ChildProcessHost::kInvalidUniqueID)
+    , m_launchingSpareRenderProcess(false)
+    , m_spareRenderProcessHits(0)
+    , m_spareRenderProcessMisses(0)
+    , m_nextRequestId(0)
 {
+    m_lifecycleTimer.setInterval(kLifecyclePolicyInterval);
+    QObject::connect(&m_lifecycleTimer, &QTimer::timeout, [this] () { applyLifecyclePolicy(); });
+
     WebEngineContext::current()->addBrowserContext(this);
     // creation of profile requires webengine context
     m_browserContext.reset(new ProfileQt(this));
@@ -94,6 +132,8 @@ BrowserContextAdapter::BrowserContextAdapter(const QString &storageName):
 
 BrowserContextAdapter::~BrowserContextAdapter()
 {
+    m_requestedSpareRenderProcesses = 0;
+    releaseSpareRenderProcess();
     WebEngineContext::current()->removeBrowserContext(this);
     if (m_downloadManagerDelegate) {
         m_browserContext->GetDownloadManager(m_browserContext.data())->Shutdown();
@@ -111,6 +151,7 @@ void BrowserContextAdapter::setStorageName(const QString &storageName)
             m_browserContext->m_profileIOData->updateStorageSettings();
         if (m_visitedLinksManager)
             resetVisitedLinksManager();
+        updatePersistentStoragePaths();
     }
 }
 
@@ -123,6 +164,7 @@ void BrowserContextAdapter::setOffTheRecord(bool offTheRecord)
         m_browserContext->m_profileIOData->updateStorageSettings();
     if (m_visitedLinksManager)
         resetVisitedLinksManager();
+    updatePersistentStoragePaths();
 }
 
 ProfileQt *BrowserContextAdapter::browserContext()
@@ -146,8 +188,10 @@ DownloadManagerDelegateQt *BrowserContextAdapter::downloadManagerDelegate()
 
 QWebEngineCookieStore *BrowserContextAdapter::cookieStore()
 {
-    if (!m_cookieStore)
+    if (!m_cookieStore) {
         m_cookieStore.reset(new QWebEngineCookieStore);
+        m_cookieStore->d_func()->browserContextAdapter = this;
+    }
     return m_cookieStore.data();
 }
 
@@ -221,6 +265,7 @@ void BrowserContextAdapter::setDataPath(const QString &path)
             m_browserContext->m_profileIOData->updateStorageSettings();
         if (m_visitedLinksManager)
             resetVisitedLinksManager();
+        updatePersistentStoragePaths();
     }
 }
 
@@ -337,6 +382,45 @@ void BrowserContextAdapter::setPersistentCookiesPolicy(BrowserContextAdapter::Pe
         m_browserContext->m_profileIOData->updateCookieStore();
 }
 
+void BrowserContextAdapter::setStorageAccessPolicy(BrowserContextAdapter::StorageAccessPolicy policy)
+{
+    if (m_storageAccessPolicy == policy)
+        return;
+    m_storageAccessPolicy = policy;
+    updateStorageAccessPolicy();
+}
+
+QWebEngineNetworkMetrics BrowserContextAdapter::networkMetrics() const
+{
+    return m_browserContext->m_profileIOData->networkMetrics()->snapshot();
+}
+
+void BrowserContextAdapter::resetNetworkMetrics()
+{
+    m_browserContext->m_profileIOData->networkMetrics()->reset();
+}
+
+bool BrowserContextAdapter::hasCookieFilter() const
+{
+    return m_cookieStore && m_cookieStore->d_func()->filterCallback;
+}
+
+void BrowserContextAdapter::updateStorageAccessPolicy()
+{
+    m_browserContext->m_profileIOData->updateStorageAccessPolicy();
+
+    for (content::RenderProcessHost::iterator it(content::RenderProcessHost::AllHostsIterator()); !it.IsAtEnd(); it.Advance()) {
+        content::RenderProcessHost *host = it.GetCurrentValue();
+        if (host->GetBrowserContext() == m_browserContext.data())
+            sendStorageAccessPolicy(host);
+    }
+}
+
+void BrowserContextAdapter::sendStorageAccessPolicy(content::RenderProcessHost *host) const
+{
+    host->Send(new QtWebEngineMsg_SetStorageAccessPolicy(m_storageAccessPolicy, hasCookieFilter()));
+}
+
 BrowserContextAdapter::VisitedLinksPolicy BrowserContextAdapter::visitedLinksPolicy() const
 {
     if (isOffTheRecord() || m_visitedLinksPolicy == DoNotTrackVisitedLinks)
@@ -462,6 +546,119 @@ bool BrowserContextAdapter::checkPermission(const QUrl &origin, PermissionType t
     return static_cast<PermissionManagerQt*>(browserContext()->GetPermissionManager())->checkPermission(origin, type);
 }
 
+BrowserContextAdapter::PermissionState BrowserContextAdapter::permissionState(const QUrl &origin, PermissionType type)
+{
+    // Decisions are kept for serialized origins.
+    const QUrl securityOrigin = toQt(toGurl(origin).GetOrigin());
+    return static_cast<PermissionManagerQt*>(browserContext()->GetPermissionManager())->permissionState(securityOrigin, type);
+}
+
+bool BrowserContextAdapter::setPermission(const QString &originPattern, PermissionType type, PermissionState state)
+{
+    return static_cast<PermissionManagerQt*>(browserContext()->GetPermissionManager())->setPermission(originPattern, type, state);
+}
+
+void BrowserContextAdapter::clearPermissions()
+{
+    static_cast<PermissionManagerQt*>(browserContext()->GetPermissionManager())->clearPermissions();
+}
+
+QByteArray BrowserContextAdapter::exportPermissions()
+{
+    return static_cast<PermissionManagerQt*>(browserContext()->GetPermissionManager())->exportPermissions();
+}
+
+bool BrowserContextAdapter::importPermissions(const QByteArray &data)
+{
+    return static_cast<PermissionManagerQt*>(browserContext()->GetPermissionManager())->importPermissions(data);
+}
+
+static SSLHostStateDelegateQt *sslHostStateDelegate(ProfileQt *profile)
+{
+    return static_cast<SSLHostStateDelegateQt *>(profile->GetSSLHostStateDelegate());
+}
+
+bool BrowserContextAdapter::addCertificateException(const QString &host, bool publicKeyHash, const QByteArray &sha256, const QDateTime &expiry)
+{
+    return sslHostStateDelegate(browserContext())->addCertificateException(host, publicKeyHash, sha256, expiry);
+}
+
+void BrowserContextAdapter::removeCertificateExceptions(const QString &host)
+{
+    sslHostStateDelegate(browserContext())->removeCertificateExceptions(host);
+}
+
+void BrowserContextAdapter::clearCertificateExceptions()
+{
+    sslHostStateDelegate(browserContext())->clearCertificateExceptions();
+}
+
+QByteArray BrowserContextAdapter::exportCertificateExceptions()
+{
+    return sslHostStateDelegate(browserContext())->exportCertificateExceptions();
+}
+
+bool BrowserContextAdapter::importCertificateExceptions(const QByteArray &data)
+{
+    return sslHostStateDelegate(browserContext())->importCertificateExceptions(data);
+}
+
+bool BrowserContextAdapter::rememberCertificateErrorDecisions()
+{
+    return sslHostStateDelegate(browserContext())->rememberUserDecisions();
+}
+
+void BrowserContextAdapter::setRememberCertificateErrorDecisions(bool remember)
+{
+    sslHostStateDelegate(browserContext())->setRememberUserDecisions(remember);
+}
+
+static std::string httpAuthSchemeName(BrowserContextAdapter::HttpAuthScheme scheme)
+{
+    switch (scheme) {
+    case BrowserContextAdapter::AnyHttpAuthScheme:
+        break;
+    case BrowserContextAdapter::BasicHttpAuthScheme:
+        return net::HttpAuth::SchemeToString(net::HttpAuth::AUTH_SCHEME_BASIC);
+    case BrowserContextAdapter::DigestHttpAuthScheme:
+        return net::HttpAuth::SchemeToString(net::HttpAuth::AUTH_SCHEME_DIGEST);
+    case BrowserContextAdapter::NtlmHttpAuthScheme:
+        return net::HttpAuth::SchemeToString(net::HttpAuth::AUTH_SCHEME_NTLM);
+    case BrowserContextAdapter::NegotiateHttpAuthScheme:
+        return net::HttpAuth::SchemeToString(net::HttpAuth::AUTH_SCHEME_NEGOTIATE);
+    }
+    return std::string();
+}
+
+bool BrowserContextAdapter::addHttpAuthCredentials(const QUrl &origin, const QString &realm, HttpAuthScheme scheme,
+                                                   const QString &user, const QString &password, bool preemptive)
+{
+    const GURL gurl = toGurl(origin);
+    if (!gurl.SchemeIsHTTPOrHTTPS() || gurl.host().empty())
+        return false;
+    ProfileIODataQt *ioData = m_browserContext->m_profileIOData.get();
+    if (!ioData->httpAuthCredentialStore()->add(url::Origin::Create(gurl), realm.toStdString(),
+                                                httpAuthSchemeName(scheme),
+                                                net::AuthCredentials(toString16(user), toString16(password)),
+                                                preemptive))
+        return false;
+    if (preemptive && scheme == BasicHttpAuthScheme && !realm.isEmpty())
+        ioData->updateHttpAuthCache();
+    return true;
+}
+
+void BrowserContextAdapter::removeHttpAuthCredentials(const QUrl &origin)
+{
+    ProfileIODataQt *ioData = m_browserContext->m_profileIOData.get();
+    ioData->removeFromHttpAuthCache(ioData->httpAuthCredentialStore()->remove(url::Origin::Create(toGurl(origin))));
+}
+
+void BrowserContextAdapter::clearHttpAuthCredentials()
+{
+    ProfileIODataQt *ioData = m_browserContext->m_profileIOData.get();
+    ioData->removeFromHttpAuthCache(ioData->httpAuthCredentialStore()->clear());
+}
+
 QString BrowserContextAdapter::httpAcceptLanguageWithoutQualities() const
 {
     const QStringList list = m_httpAcceptLanguage.split(QLatin1Char(','));
@@ -543,4 +740,336 @@ void BrowserContextAdapter::resetVisitedLinksManager()
     m_visitedLinksManager.reset(new VisitedLinksManagerQt(this));
 }
 
+void BrowserContextAdapter::updatePersistentStoragePaths()
+{
+    if (m_browserContext->m_permissionManager)
+        m_browserContext->m_permissionManager->setPersistentStoragePath(dataPath());
+    if (m_browserContext->m_sslHostStateDelegate)
+        m_browserContext->m_sslHostStateDelegate->setPersistentStoragePath(dataPath());
+}
+
+void BrowserContextAdapter::addWebContentsAdapter(WebContentsAdapter *adapter)
+{
+    Q_ASSERT(!m_webContentsAdapters.contains(adapter));
+    m_webContentsAdapters.append(adapter);
+    updateLifecyclePolicy();
+}
+
+void BrowserContextAdapter::removeWebContentsAdapter(WebContentsAdapter *adapter)
+{
+    m_webContentsAdapters.removeOne(adapter);
+    updateLifecyclePolicy();
+}
+
+void BrowserContextAdapter::setLifecycleFreezeDelay(int msecs)
+{
+    m_lifecycleFreezeDelay = qMax(0, msecs);
+    updateLifecyclePolicy();
+}
+
+void BrowserContextAdapter::setLifecycleMemoryBudget(qint64 bytes)
+{
+    m_lifecycleMemoryBudget = qMax(qint64(0), bytes);
+    updateLifecyclePolicy();
+}
+
+void BrowserContextAdapter::updateLifecyclePolicy()
+{
+    const bool enabled = m_lifecycleFreezeDelay > 0 || m_lifecycleMemoryBudget > 0;
+    if (enabled && !m_webContentsAdapters.isEmpty()) {
+        if (!m_lifecycleTimer.isActive())
+            m_lifecycleTimer.start();
+    } else {
+        m_lifecycleTimer.stop();
+    }
+}
+
+void BrowserContextAdapter::applyLifecyclePolicy()
+{
+    typedef WebContentsAdapter::LifecycleState LifecycleState;
+
+    // Pages being inspected or playing audio are left alone, freezing them would be user visible.
+    if (m_lifecycleFreezeDelay > 0) {
+        for (WebContentsAdapter *adapter : qAsConst(m_webContentsAdapters)) {
+            if (adapter->isVisible() || adapter->lifecycleState() != LifecycleState::Active)
+                continue;
+            if (adapter->msecsSinceHidden() < m_lifecycleFreezeDelay)
+                continue;
+            if (adapter->hasInspector() || adapter->recentlyAudible())
+                continue;
+            adapter->setLifecycleState(LifecycleState::Frozen);
+        }
+    }
+
+    if (m_lifecycleMemoryBudget > 0 && !m_samplingRendererMemory)
+        sampleRendererMemory();
+}
+
+// Runs on a blocking task runner, reading the process statistics may touch the file system.
+static qint64 rendererWorkingSetSize(std::vector<base::Process> processes)
+{
+    qint64 total = 0;
+    for (const base::Process &process : processes) {
+#if defined(OS_MACOSX)
+        std::unique_ptr<base::ProcessMetrics> metrics =
+                base::ProcessMetrics::CreateProcessMetrics(process.Handle(), content::BrowserChildProcessHost::GetPortProvider());
+#else
+        std::unique_ptr<base::ProcessMetrics> metrics = base::ProcessMetrics::CreateProcessMetrics(process.Handle());
+#endif
+        total += metrics->GetWorkingSetSize();
+    }
+    return total;
+}
+
+void BrowserContextAdapter::sampleRendererMemory()
+{
+    std::set<content::RenderProcessHost *> hosts;
+    for (WebContentsAdapter *adapter : qAsConst(m_webContentsAdapters)) {
+        if (adapter->lifecycleState() == WebContentsAdapter::LifecycleState::Discarded)
+            continue;
+        hosts.insert(adapter->webContents()->GetMainFrame()->GetProcess());
+    }
+
+    // The handles are duplicated so they stay valid if a renderer exits while it is being sampled.
+    std::vector<base::Process> processes;
+    for (content::RenderProcessHost *host : hosts) {
+        if (host->HasConnection())
+            processes.push_back(base::Process::DeprecatedGetProcessFromHandle(host->GetHandle()).Duplicate());
+    }
+    if (processes.empty())
+        return;
+
+    m_samplingRendererMemory = true;
+    base::PostTaskAndReplyWithResult(
+                base::CreateTaskRunnerWithTraits({ base::MayBlock(), base::TaskPriority::BACKGROUND }).get(),
+                FROM_HERE,
+                base::BindOnce(&rendererWorkingSetSize, std::move(processes)),
+                base::BindOnce([](QPointer<BrowserContextAdapter> adapter, qint64 usage) {
+                    if (adapter)
+                        adapter->rendererMemorySampled(usage);
+                }, QPointer<BrowserContextAdapter>(this)));
+}
+
+void BrowserContextAdapter::rendererMemorySampled(qint64 usage)
+{
+    typedef WebContentsAdapter::LifecycleState LifecycleState;
+
+    m_samplingRendererMemory = false;
+    if (m_lifecycleMemoryBudget <= 0 || usage <= m_lifecycleMemoryBudget)
+        return;
+
+    // Discard the page that has been hidden the longest. Only one page is discarded per
+    // round so the memory of the killed renderer is reclaimed before the budget is checked again.
+    WebContentsAdapter *candidate = nullptr;
+    for (WebContentsAdapter *adapter : qAsConst(m_webContentsAdapters)) {
+        if (adapter->isVisible() || adapter->lifecycleState() == LifecycleState::Discarded)
+            continue;
+        if (adapter->hasInspector() || adapter->recentlyAudible())
+            continue;
+        if (!candidate || adapter->msecsSinceHidden() > candidate->msecsSinceHidden())
+            candidate = adapter;
+    }
+    if (candidate)
+        candidate->setLifecycleState(LifecycleState::Discarded);
+}
+
+void BrowserContextAdapter::warmUpRenderProcesses(int count)
+{
+    m_requestedSpareRenderProcesses = qBound(0, m_requestedSpareRenderProcesses + count, m_maximumSpareRenderProcesses);
+    if (m_requestedSpareRenderProcesses > 0 && !spareRenderProcess())
+        startSpareRenderProcess();
+}
+
+void BrowserContextAdapter::setMaximumSpareRenderProcesses(int count)
+{
+    m_maximumSpareRenderProcesses = qMax(0, count);
+    if (m_requestedSpareRenderProcesses > m_maximumSpareRenderProcesses)
+        m_requestedSpareRenderProcesses = m_maximumSpareRenderProcesses;
+    if (m_requestedSpareRenderProcesses == 0)
+        releaseSpareRenderProcess();
+}
+
+// Chromium keeps a single spare render process for all profiles, and launching one shuts
+// down the spare of any other profile. So requested spares are launched one after the
+// other as each one gets adopted, and profiles take turns instead of replacing each
+// other's spare.
+content::RenderProcessHost *BrowserContextAdapter::spareRenderProcess() const
+{
+    if (m_spareRenderProcessId == content::ChildProcessHost::kInvalidUniqueID)
+        return nullptr;
+    content::RenderProcessHost *spare = content::RenderProcessHost::FromID(m_spareRenderProcessId);
+    // Chromium also drops the spare when a navigation of another profile needs a process.
+    if (!spare || spare->FastShutdownStarted())
+        return nullptr;
+    return spare;
+}
+
+void BrowserContextAdapter::startSpareRenderProcess()
+{
+    if (spareRenderProcess())
+        return;
+    // The profile gets its turn once the spare of the other profile is adopted or released.
+    for (BrowserContextAdapter *adapter : WebEngineContext::current()->m_browserContextAdapters) {
+        if (adapter != this && adapter->spareRenderProcess())
+            return;
+    }
+
+    if (!m_memoryPressureListener) {
+        m_memoryPressureListener.reset(new base::MemoryPressureListener(base::Bind(
+            [] (BrowserContextAdapter *adapter, base::MemoryPressureListener::MemoryPressureLevel level) {
+                if (level == base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE)
+                    return;
+                // A spare only saves time, give its memory back.
+                adapter->m_requestedSpareRenderProcesses = 0;
+                adapter->releaseSpareRenderProcess();
+            }, base::Unretained(this))));
+    }
+
+    // The spare announces itself through renderProcessWillLaunch(). No spare is created
+    // in single process mode or when the process limit is reached.
+    m_spareRenderProcessId = content::ChildProcessHost::kInvalidUniqueID;
+    m_launchingSpareRenderProcess = true;
+    content::RenderProcessHostImpl::WarmupSpareRenderProcessHost(m_browserContext.data());
+    m_launchingSpareRenderProcess = false;
+}
+
+void BrowserContextAdapter::releaseSpareRenderProcess()
+{
+    content::RenderProcessHost *spare = spareRenderProcess();
+    m_spareRenderProcessId = content::ChildProcessHost::kInvalidUniqueID;
+    if (spare) {
+        if (!spare->FastShutdownIfPossible())
+            spare->Cleanup();
+        scheduleSpareRenderProcesses();
+    }
+}
+
+// Launches the spare of the next profile waiting for one, once the event loop is back.
+void BrowserContextAdapter::scheduleSpareRenderProcesses()
+{
+    WebEngineContext *context = WebEngineContext::current();
+    if (!context || !context->globalQObject())
+        return;
+    QTimer::singleShot(0, context->globalQObject(), [] () {
+        for (BrowserContextAdapter *adapter : WebEngineContext::current()->m_browserContextAdapters) {
+            if (adapter->m_requestedSpareRenderProcesses > 0) {
+                adapter->startSpareRenderProcess();
+                if (adapter->spareRenderProcess())
+                    return;
+            }
+        }
+    });
+}
+
+void BrowserContextAdapter::renderProcessWillLaunch(content::RenderProcessHost *host)
+{
+    if (m_launchingSpareRenderProcess)
+        m_spareRenderProcessId = host->GetID();
+}
+
+void BrowserContextAdapter::renderProcessAssigned(content::RenderProcessHost *host)
+{
+    if (m_spareRenderProcessId != content::ChildProcessHost::kInvalidUniqueID && host->GetID() == m_spareRenderProcessId) {
+        ++m_spareRenderProcessHits;
+        m_spareRenderProcessId = content::ChildProcessHost::kInvalidUniqueID;
+        if (m_requestedSpareRenderProcesses > 0)
+            --m_requestedSpareRenderProcesses;
+    } else if (m_requestedSpareRenderProcesses > 0 && !host->HasConnection()) {
+        // A new process is launched on demand although a spare was requested.
+        ++m_spareRenderProcessMisses;
+    } else {
+        return;
+    }
+
+    // Launch the next spare after the navigation taking this process got going.
+    scheduleSpareRenderProcesses();
+}
+
+void BrowserContextAdapter::preconnect(const QUrl &url, int numSockets)
+{
+    if (!url.isValid() || numSockets <= 0)
+        return;
+    m_browserContext->m_profileIOData->preconnect(toGurl(url), numSockets);
+}
+
+quint64 BrowserContextAdapter::prefetchHostName(const QString &hostName)
+{
+    const quint64 requestId = ++m_nextRequestId;
+    m_browserContext->m_profileIOData->prefetchHostName(requestId, hostName.toStdString());
+    return requestId;
+}
+
+quint64 BrowserContextAdapter::prefetch(const QUrl &url, PrefetchPriority priority)
+{
+    const quint64 requestId = ++m_nextRequestId;
+    m_browserContext->m_profileIOData->prefetch(requestId, toGurl(url), priority);
+    return requestId;
+}
+
+void BrowserContextAdapter::networkPredictionFinished(quint64 requestId, bool success)
+{
+    for (BrowserContextAdapterClient *client : qAsConst(m_clients))
+        client->networkPredictionFinished(requestId, success);
+}
+
+quint64 BrowserContextAdapter::requestHttpCacheEntries()
+{
+    const quint64 requestId = ++m_nextRequestId;
+    m_browserContext->m_profileIOData->requestHttpCacheEntries(requestId);
+    return requestId;
+}
+
+quint64 BrowserContextAdapter::requestHttpCacheStatistics()
+{
+    const quint64 requestId = ++m_nextRequestId;
+    m_browserContext->m_profileIOData->requestHttpCacheStatistics(requestId);
+    return requestId;
+}
+
+quint64 BrowserContextAdapter::insertHttpCacheEntry(const QUrl &url, const QByteArray &headers, const QByteArray &body)
+{
+    const quint64 requestId = ++m_nextRequestId;
+    m_browserContext->m_profileIOData->insertHttpCacheEntry(requestId, toGurl(url), headers.toStdString(),
+                                                            body.toStdString());
+    return requestId;
+}
+
+quint64 BrowserContextAdapter::removeHttpCacheEntry(const QUrl &url)
+{
+    const quint64 requestId = ++m_nextRequestId;
+    m_browserContext->m_profileIOData->removeHttpCacheEntry(requestId, toGurl(url));
+    return requestId;
+}
+
+quint64 BrowserContextAdapter::removeHttpCacheEntriesWithPrefix(const QString &urlPrefix)
+{
+    const quint64 requestId = ++m_nextRequestId;
+    m_browserContext->m_profileIOData->removeHttpCacheEntriesWithPrefix(requestId, urlPrefix.toStdString());
+    return requestId;
+}
+
+void BrowserContextAdapter::httpCacheEntriesReceived(quint64 requestId, const QVector<QWebEngineHttpCacheEntry> &entries)
+{
+    for (BrowserContextAdapterClient *client : qAsConst(m_clients))
+        client->httpCacheEntriesReceived(requestId, entries);
+}
+
+void BrowserContextAdapter::httpCacheStatisticsReceived(quint64 requestId, const QWebEngineHttpCacheStatistics &statistics)
+{
+    for (BrowserContextAdapterClient *client : qAsConst(m_clients))
+        client->httpCacheStatisticsReceived(requestId, statistics);
+}
+
+void BrowserContextAdapter::httpCacheEntryInserted(quint64 requestId, bool success)
+{
+    for (BrowserContextAdapterClient *client : qAsConst(m_clients))
+        client->httpCacheEntryInserted(requestId, success);
+}
+
+void BrowserContextAdapter::httpCacheEntriesRemoved(quint64 requestId, int count)
+{
+    for (BrowserContextAdapterClient *client : qAsConst(m_clients))
+        client->httpCacheEntriesRemoved(requestId, count);
+}
+
 } // namespace QtWebEngineCore
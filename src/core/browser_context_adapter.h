@@ -42,19 +42,31 @@
 
 #include "qtwebenginecoreglobal.h"
 
+#include <QDateTime>
 #include <QEnableSharedFromThis>
 #include <QList>
 #include <QPointer>
 #include <QScopedPointer>
 #include <QString>
+#include <QTimer>
 #include <QVector>
 
 #include "api/qwebenginecookiestore.h"
+#include "api/qwebenginehttpcacheentry.h"
+#include "api/qwebenginenetworkmetrics.h"
 #include "api/qwebengineurlrequestinterceptor.h"
 #include "api/qwebengineurlschemehandler.h"
 
 QT_FORWARD_DECLARE_CLASS(QObject)
 
+namespace base {
+class MemoryPressureListener;
+}
+
+namespace content {
+class RenderProcessHost;
+}
+
 namespace QtWebEngineCore {
 
 class BrowserContextAdapterClient;
@@ -62,6 +74,7 @@ class DownloadManagerDelegateQt;
 class ProfileQt;
 class UserResourceControllerHost;
 class VisitedLinksManagerQt;
+class WebContentsAdapter;
 
 class QWEBENGINE_EXPORT BrowserContextAdapter : public QObject
 {
@@ -133,6 +146,13 @@ public:
         TrackVisitedLinksOnDisk,
     };
 
+    // KEEP IN SYNC with StorageAccessPolicyQt::Policy
+    enum StorageAccessPolicy {
+        AllowStorageAccess = 0,
+        BlockThirdPartyStorageAccess,
+        BlockStorageAccess
+    };
+
     enum PermissionType {
         UnsupportedPermission = 0,
         GeolocationPermission = 1,
@@ -142,6 +162,30 @@ public:
         VideoCapturePermission = 4,
     };
 
+    // KEEP IN SYNC with QWebEnginePage::PermissionPolicy
+    enum PermissionState {
+        AskPermission = 0,
+        GrantedPermission,
+        DeniedPermission
+    };
+
+    // KEEP IN SYNC with QWebEngineProfile::PrefetchPriority
+    enum PrefetchPriority {
+        IdlePrefetchPriority = 0,
+        LowPrefetchPriority,
+        MediumPrefetchPriority,
+        HighPrefetchPriority
+    };
+
+    // KEEP IN SYNC with QWebEngineProfile::HttpAuthScheme
+    enum HttpAuthScheme {
+        AnyHttpAuthScheme = 0,
+        BasicHttpAuthScheme,
+        DigestHttpAuthScheme,
+        NtlmHttpAuthScheme,
+        NegotiateHttpAuthScheme
+    };
+
     HttpCacheType httpCacheType() const;
     void setHttpCacheType(BrowserContextAdapter::HttpCacheType);
 
@@ -154,6 +198,20 @@ public:
     int httpCacheMaxSize() const;
     void setHttpCacheMaxSize(int maxSize);
 
+    // Minimum interval between two progress updates of a download, 0 reports every update.
+    int downloadProgressInterval() const { return m_downloadProgressInterval; }
+    void setDownloadProgressInterval(int msecs) { m_downloadProgressInterval = qMax(0, msecs); }
+
+    StorageAccessPolicy storageAccessPolicy() const { return m_storageAccessPolicy; }
+    void setStorageAccessPolicy(StorageAccessPolicy policy);
+    bool hasCookieFilter() const;
+    // Pushes the storage access policy snapshot to the render processes of this profile.
+    void updateStorageAccessPolicy();
+    void sendStorageAccessPolicy(content::RenderProcessHost *host) const;
+
+    QWebEngineNetworkMetrics networkMetrics() const;
+    void resetNetworkMetrics();
+
     bool trackVisitedLinks() const;
     bool persistVisitedLinks() const;
 
@@ -167,6 +225,24 @@ public:
 
     void permissionRequestReply(const QUrl &origin, PermissionType type, bool reply);
     bool checkPermission(const QUrl &origin, PermissionType type);
+    PermissionState permissionState(const QUrl &origin, PermissionType type);
+    bool setPermission(const QString &originPattern, PermissionType type, PermissionState state);
+    void clearPermissions();
+    QByteArray exportPermissions();
+    bool importPermissions(const QByteArray &data);
+
+    bool addCertificateException(const QString &host, bool publicKeyHash, const QByteArray &sha256, const QDateTime &expiry);
+    void removeCertificateExceptions(const QString &host);
+    void clearCertificateExceptions();
+    QByteArray exportCertificateExceptions();
+    bool importCertificateExceptions(const QByteArray &data);
+    bool rememberCertificateErrorDecisions();
+    void setRememberCertificateErrorDecisions(bool remember);
+
+    bool addHttpAuthCredentials(const QUrl &origin, const QString &realm, HttpAuthScheme scheme,
+                                const QString &user, const QString &password, bool preemptive);
+    void removeHttpAuthCredentials(const QUrl &origin);
+    void clearHttpAuthCredentials();
 
     QString httpAcceptLanguageWithoutQualities() const;
     QString httpAcceptLanguage() const;
@@ -174,9 +250,55 @@ public:
 
     void clearHttpCache();
 
+    void addWebContentsAdapter(WebContentsAdapter *adapter);
+    void removeWebContentsAdapter(WebContentsAdapter *adapter);
+
+    // Delay after which hidden pages are frozen, 0 disables automatic freezing.
+    int lifecycleFreezeDelay() const { return m_lifecycleFreezeDelay; }
+    void setLifecycleFreezeDelay(int msecs);
+    // Renderer memory in bytes above which hidden pages get discarded, 0 disables automatic discarding.
+    qint64 lifecycleMemoryBudget() const { return m_lifecycleMemoryBudget; }
+    void setLifecycleMemoryBudget(qint64 bytes);
+
+    // Requests |count| pre-launched render processes for the next navigations needing a new process.
+    void warmUpRenderProcesses(int count);
+    int maximumSpareRenderProcesses() const { return m_maximumSpareRenderProcesses; }
+    void setMaximumSpareRenderProcesses(int count);
+    int spareRenderProcessHitCount() const { return m_spareRenderProcessHits; }
+    int spareRenderProcessMissCount() const { return m_spareRenderProcessMisses; }
+    void renderProcessAssigned(content::RenderProcessHost *host);
+    void renderProcessWillLaunch(content::RenderProcessHost *host);
+
+    // Speculative network requests. The returned request ids are reported back to the
+    // clients through BrowserContextAdapterClient::networkPredictionFinished().
+    void preconnect(const QUrl &url, int numSockets);
+    quint64 prefetchHostName(const QString &hostName);
+    quint64 prefetch(const QUrl &url, PrefetchPriority priority);
+    void networkPredictionFinished(quint64 requestId, bool success);
+
+    // Asynchronous HTTP cache operations, reported to the clients with the returned request ids.
+    quint64 requestHttpCacheEntries();
+    quint64 requestHttpCacheStatistics();
+    quint64 insertHttpCacheEntry(const QUrl &url, const QByteArray &headers, const QByteArray &body);
+    quint64 removeHttpCacheEntry(const QUrl &url);
+    quint64 removeHttpCacheEntriesWithPrefix(const QString &urlPrefix);
+    void httpCacheEntriesReceived(quint64 requestId, const QVector<QWebEngineHttpCacheEntry> &entries);
+    void httpCacheStatisticsReceived(quint64 requestId, const QWebEngineHttpCacheStatistics &statistics);
+    void httpCacheEntryInserted(quint64 requestId, bool success);
+    void httpCacheEntriesRemoved(quint64 requestId, int count);
+
 private:
     void updateCustomUrlSchemeHandlers();
     void resetVisitedLinksManager();
+    void updatePersistentStoragePaths();
+    void updateLifecyclePolicy();
+    void applyLifecyclePolicy();
+    void sampleRendererMemory();
+    void rendererMemorySampled(qint64 usage);
+    content::RenderProcessHost *spareRenderProcess() const;
+    void startSpareRenderProcess();
+    void releaseSpareRenderProcess();
+    static void scheduleSpareRenderProcesses();
 
     QString m_name;
     bool m_offTheRecord;
@@ -197,6 +319,21 @@ private:
     QHash<QByteArray, QWebEngineUrlSchemeHandler *> m_customUrlSchemeHandlers;
     QList<BrowserContextAdapterClient*> m_clients;
     int m_httpCacheMaxSize;
+    StorageAccessPolicy m_storageAccessPolicy;
+    int m_downloadProgressInterval;
+    QVector<WebContentsAdapter *> m_webContentsAdapters;
+    int m_lifecycleFreezeDelay;
+    qint64 m_lifecycleMemoryBudget;
+    bool m_samplingRendererMemory;
+    QTimer m_lifecycleTimer;
+    int m_maximumSpareRenderProcesses;
+    int m_requestedSpareRenderProcesses;
+    int m_spareRenderProcessId;
+    bool m_launchingSpareRenderProcess;
+    int m_spareRenderProcessHits;
+    int m_spareRenderProcessMisses;
+    quint64 m_nextRequestId;
+    QScopedPointer<base::MemoryPressureListener> m_memoryPressureListener;
 
     Q_DISABLE_COPY(BrowserContextAdapter)
 };
@@ -41,8 +41,11 @@
 #define BROWSER_CONTEXT_ADAPTER_CLIENT_H
 
 #include "qtwebenginecoreglobal.h"
+#include "api/qwebenginehttpcacheentry.h"
+#include <QByteArray>
 #include <QString>
 #include <QUrl>
+#include <QVector>
 
 namespace QtWebEngineCore {
 
@@ -122,12 +125,20 @@ public:
         bool done;
         int downloadType;
         int downloadInterruptReason;
+        // Deliver the data through downloadDataReceived() instead of writing it to path.
+        bool inMemory;
     };
 
     virtual ~BrowserContextAdapterClient() { }
 
     virtual void downloadRequested(DownloadItemInfo &info) = 0;
     virtual void downloadUpdated(const DownloadItemInfo &info) = 0;
+    virtual void downloadDataReceived(quint32 downloadId, const QByteArray &data) = 0;
+    virtual void networkPredictionFinished(quint64 requestId, bool success) { Q_UNUSED(requestId); Q_UNUSED(success); }
+    virtual void httpCacheEntriesReceived(quint64 requestId, const QVector<QWebEngineHttpCacheEntry> &entries) { Q_UNUSED(requestId); Q_UNUSED(entries); }
+    virtual void httpCacheStatisticsReceived(quint64 requestId, const QWebEngineHttpCacheStatistics &statistics) { Q_UNUSED(requestId); Q_UNUSED(statistics); }
+    virtual void httpCacheEntryInserted(quint64 requestId, bool success) { Q_UNUSED(requestId); Q_UNUSED(success); }
+    virtual void httpCacheEntriesRemoved(quint64 requestId, int count) { Q_UNUSED(requestId); Q_UNUSED(count); }
     static QString downloadInterruptReasonToString(DownloadInterruptReason reason);
 };
 
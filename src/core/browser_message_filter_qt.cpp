@@ -112,7 +112,7 @@ void BrowserMessageFilterQt::OnAllowDatabase(int /*render_frame_id*/,
                                              bool* allowed)
 {
     NetworkDelegateQt *networkDelegate = static_cast<NetworkDelegateQt *>(m_profile->GetRequestContext()->GetURLRequestContext()->network_delegate());
-    *allowed = networkDelegate->canGetCookies(top_origin_url, origin_url);
+    *allowed = networkDelegate->canAccessStorage(top_origin_url, origin_url);
 }
 
 void BrowserMessageFilterQt::OnAllowDOMStorage(int /*render_frame_id*/,
@@ -122,7 +122,7 @@ void BrowserMessageFilterQt::OnAllowDOMStorage(int /*render_frame_id*/,
                                                bool *allowed)
 {
     NetworkDelegateQt *networkDelegate = static_cast<NetworkDelegateQt *>(m_profile->GetRequestContext()->GetURLRequestContext()->network_delegate());
-    *allowed = networkDelegate->canGetCookies(top_origin_url, origin_url);
+    *allowed = networkDelegate->canAccessStorage(top_origin_url, origin_url);
 }
 
 void BrowserMessageFilterQt::OnAllowIndexedDB(int /*render_frame_id*/,
@@ -132,7 +132,7 @@ void BrowserMessageFilterQt::OnAllowIndexedDB(int /*render_frame_id*/,
                                               bool *allowed)
 {
     NetworkDelegateQt *networkDelegate = static_cast<NetworkDelegateQt *>(m_profile->GetRequestContext()->GetURLRequestContext()->network_delegate());
-    *allowed = networkDelegate->canGetCookies(top_origin_url, origin_url);
+    *allowed = networkDelegate->canAccessStorage(top_origin_url, origin_url);
 }
 
 void BrowserMessageFilterQt::OnRequestFileSystemAccessSync(int render_frame_id,
@@ -186,7 +186,7 @@ void BrowserMessageFilterQt::OnRequestFileSystemAccess(int /*render_frame_id*/,
     DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
 
     NetworkDelegateQt *networkDelegate = static_cast<NetworkDelegateQt *>(m_profile->GetRequestContext()->GetURLRequestContext()->network_delegate());
-    bool allowed = networkDelegate->canGetCookies(top_origin_url, origin_url);
+    bool allowed = networkDelegate->canAccessStorage(top_origin_url, origin_url);
 
     callback.Run(allowed);
 }
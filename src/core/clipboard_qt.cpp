@@ -87,6 +87,44 @@ const char kMimeTypeWebCustomDataCopy[] = "chromium/x-web-custom-data";
 const char kMimeTypePepperCustomData[] = "chromium/x-pepper-custom-data";
 const char kMimeTypeWebkitSmartPaste[] = "chromium/x-webkit-paste";
 
+// Shares the pixels of |bitmap| with the returned image, the image keeps the pixel ref alive.
+QImage toSharedQImage(const SkBitmap &bitmap)
+{
+    const QImage image = toQImage(bitmap);
+    if (image.isNull())
+        return image;
+    return QImage(image.constBits(), image.width(), image.height(), bitmap.rowBytes(), image.format(),
+                  [](void *info) { delete static_cast<SkBitmap *>(info); }, new SkBitmap(bitmap));
+}
+
+// Shares the pixels of |image| with the returned bitmap when they already are
+// in the N32 layout, otherwise converts them once.
+SkBitmap toSharedSkBitmap(QImage image)
+{
+    SkAlphaType alphaType = kPremul_SkAlphaType;
+    switch (image.format()) {
+    case QImage::Format_RGB32:
+        alphaType = kOpaque_SkAlphaType;
+        break;
+    case QImage::Format_ARGB32_Premultiplied:
+        break;
+    default:
+        image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+        break;
+    }
+    if (image.isNull())
+        return SkBitmap();
+
+    SkBitmap bitmap;
+    QImage *owner = new QImage(image);
+    const SkImageInfo info = SkImageInfo::MakeN32(image.width(), image.height(), alphaType);
+    if (!bitmap.installPixels(info, const_cast<uchar *>(owner->constBits()), owner->bytesPerLine(),
+                              [](void *, void *context) { delete static_cast<QImage *>(context); }, owner))
+        return SkBitmap();
+    bitmap.setImmutable();
+    return bitmap;
+}
+
 QScopedPointer<QMimeData> uncommittedData;
 QMimeData *getUncommittedData()
 {
@@ -250,7 +288,7 @@ void ClipboardQt::WriteWebSmartPaste()
 
 void ClipboardQt::WriteBitmap(const SkBitmap& bitmap)
 {
-    getUncommittedData()->setImageData(toQImage(bitmap).copy());
+    getUncommittedData()->setImageData(toSharedQImage(bitmap));
 }
 
 void ClipboardQt::WriteBookmark(const char* title_data, size_t title_len, const char* url_data, size_t url_len)
@@ -294,12 +332,16 @@ void ClipboardQt::ReadAvailableTypes(ui::ClipboardType type, std::vector<base::s
     const QMimeData *mimeData = QGuiApplication::clipboard()->mimeData(type == ui::CLIPBOARD_TYPE_COPY_PASTE ? QClipboard::Clipboard : QClipboard::Selection);
     if (!mimeData)
         return;
-    if (mimeData->hasImage() && !mimeData->formats().contains(QStringLiteral("image/png")))
+    const QStringList formats = mimeData->formats();
+    if (mimeData->hasImage() && !formats.contains(QStringLiteral("image/png")))
         types->push_back(toString16(QStringLiteral("image/png")));
-    Q_FOREACH (const QString &mimeType, mimeData->formats())
+    for (const QString &mimeType : formats)
         types->push_back(toString16(mimeType));
     *contains_filenames = false;
 
+    // Only fetch the custom data when it is there, fetching may copy it from the platform clipboard.
+    if (!mimeData->hasFormat(QString::fromLatin1(kMimeTypeWebCustomDataCopy)))
+        return;
     const QByteArray customData = mimeData->data(QString::fromLatin1(kMimeTypeWebCustomDataCopy));
     ui::ReadCustomDataTypes(customData.constData(), customData.size(), types);
 }
@@ -308,8 +350,14 @@ void ClipboardQt::ReadAvailableTypes(ui::ClipboardType type, std::vector<base::s
 void ClipboardQt::ReadText(ui::ClipboardType type, base::string16* result) const
 {
     const QMimeData *mimeData = QGuiApplication::clipboard()->mimeData(type == ui::CLIPBOARD_TYPE_COPY_PASTE ? QClipboard::Clipboard : QClipboard::Selection);
-    if (mimeData)
-        *result = toString16(mimeData->text());
+    if (!mimeData)
+        return;
+    ReadCache &cache = readCache(type, mimeData);
+    if (!(cache.formats & CachedText)) {
+        cache.text = toString16(mimeData->text());
+        cache.formats |= CachedText;
+    }
+    *result = cache.text;
 }
 
 void ClipboardQt::ReadAsciiText(ui::ClipboardType type, std::string* result) const
@@ -330,7 +378,12 @@ void ClipboardQt::ReadHTML(ui::ClipboardType type, base::string16* markup, std::
     const QMimeData *mimeData = QGuiApplication::clipboard()->mimeData(type == ui::CLIPBOARD_TYPE_COPY_PASTE ? QClipboard::Clipboard : QClipboard::Selection);
     if (!mimeData)
         return;
-    *markup = toString16(mimeData->html());
+    ReadCache &cache = readCache(type, mimeData);
+    if (!(cache.formats & CachedHtml)) {
+        cache.html = toString16(mimeData->html());
+        cache.formats |= CachedHtml;
+    }
+    *markup = cache.html;
     *fragment_end = static_cast<uint32_t>(markup->length());
 }
 
@@ -348,24 +401,12 @@ SkBitmap ClipboardQt::ReadImage(ui::ClipboardType type) const
     const QMimeData *mimeData = QGuiApplication::clipboard()->mimeData(type == ui::CLIPBOARD_TYPE_COPY_PASTE ? QClipboard::Clipboard : QClipboard::Selection);
     if (!mimeData)
         return SkBitmap();
-    QImage image = qvariant_cast<QImage>(mimeData->imageData());
-
-    image = image.convertToFormat(QImage::Format_ARGB32);
-    SkBitmap bitmap;
-
-    bitmap.allocN32Pixels(image.width(), image.height(), true);
-    const size_t bytesPerRowDst = bitmap.rowBytes();
-    const size_t bytesPerLineSrc = static_cast<size_t>(image.bytesPerLine());
-    const size_t dataBytes = std::min(bytesPerRowDst, bytesPerLineSrc);
-    uchar *dst = static_cast<uchar *>(bitmap.getPixels());
-    const uchar *src = image.constBits();
-    for (int y = 0; y < image.height(); ++y) {
-        memcpy(dst, src, dataBytes);
-        dst += bytesPerRowDst;
-        src += bytesPerLineSrc;
+    ReadCache &cache = readCache(type, mimeData);
+    if (!(cache.formats & CachedImage)) {
+        cache.image = toSharedSkBitmap(qvariant_cast<QImage>(mimeData->imageData()));
+        cache.formats |= CachedImage;
     }
-
-    return bitmap;
+    return cache.image;
 }
 
 void ClipboardQt::ReadCustomData(ui::ClipboardType clipboard_type, const base::string16& type, base::string16* result) const
@@ -391,6 +432,18 @@ void ClipboardQt::ReadData(const FormatType& format, std::string* result) const
     *result = std::string(byteArray.constData(), byteArray.length());
 }
 
+ClipboardQt::ReadCache &ClipboardQt::readCache(ui::ClipboardType type, const QMimeData *mimeData) const
+{
+    ReadCache &cache = m_readCache[type == ui::CLIPBOARD_TYPE_COPY_PASTE ? 0 : 1];
+    const uint64_t sequenceNumber = GetSequenceNumber(type);
+    if (cache.sequenceNumber != sequenceNumber || cache.mimeData != mimeData) {
+        cache = ReadCache();
+        cache.sequenceNumber = sequenceNumber;
+        cache.mimeData = mimeData;
+    }
+    return cache;
+}
+
 uint64_t ClipboardQt::GetSequenceNumber(ui::ClipboardType type) const
 {
     return clipboardChangeObserver()->getSequenceNumber(type == ui::CLIPBOARD_TYPE_COPY_PASTE ? QClipboard::Clipboard : QClipboard::Selection);
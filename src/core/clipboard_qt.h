@@ -41,11 +41,14 @@
 #define CLIPBOARD_QT_H
 
 #include "ui/base/clipboard/clipboard.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 
 #include <QClipboard>
 #include <QMap>
 #include <QObject>
 
+QT_FORWARD_DECLARE_CLASS(QMimeData)
+
 namespace QtWebEngineCore {
 
 class ClipboardChangeObserver : public QObject {
@@ -93,6 +96,27 @@ protected:
     void WriteWebSmartPaste() override;
     void WriteBitmap(const SkBitmap& bitmap) override;
     void WriteData(const FormatType& format, const char* data_data, size_t data_len) override;
+
+private:
+    enum CachedFormat {
+        CachedImage = 0x1,
+        CachedText = 0x2,
+        CachedHtml = 0x4
+    };
+
+    // Conversions of the clipboard contents, reused while the sequence number is unchanged.
+    struct ReadCache {
+        uint64_t sequenceNumber = 0;
+        const QMimeData *mimeData = nullptr;
+        int formats = 0;
+        SkBitmap image;
+        base::string16 text;
+        base::string16 html;
+    };
+
+    ReadCache &readCache(ui::ClipboardType type, const QMimeData *mimeData) const;
+
+    mutable ReadCache m_readCache[2];
 };
 
 } // namespace QtWebEngineCore
@@ -4,12 +4,15 @@
 
 // Multiply-included file, no traditional include guard.
 
+#include "base/memory/shared_memory_handle.h"
 #include "base/optional.h"
 #include "media/media_features.h"
 #include "content/public/common/common_param_traits.h"
 #include "content/public/common/webplugininfo.h"
 #include "ipc/ipc_message_macros.h"
 #include "ppapi/features/features.h"
+#include "ui/gfx/ipc/geometry/gfx_param_traits.h"
+#include "ui/gfx/ipc/skia/gfx_skia_param_traits.h"
 #include "user_script_data.h"
 
 IPC_STRUCT_TRAITS_BEGIN(UserScriptData)
@@ -37,9 +40,23 @@ IPC_MESSAGE_ROUTED1(RenderViewObserverQt_FetchDocumentMarkup,
 IPC_MESSAGE_ROUTED1(RenderViewObserverQt_FetchDocumentInnerText,
                     uint64_t /* requestId */)
 
+IPC_MESSAGE_ROUTED4(RenderViewObserverQt_StreamDocumentContent,
+                    uint64_t /* requestId */,
+                    bool /* markup */,
+                    int64_t /* maxBytes, negative for no limit */,
+                    std::vector<std::string> /* subframeOrigins */)
+
+IPC_MESSAGE_ROUTED1(RenderViewObserverQt_DocumentContentChunkAck,
+                    uint64_t /* requestId */)
+
 IPC_MESSAGE_ROUTED1(RenderViewObserverQt_SetBackgroundColor,
                     uint32_t /* color */)
 
+IPC_MESSAGE_ROUTED3(RenderViewObserverQt_GrabImage,
+                    uint64_t /* requestId */,
+                    gfx::Rect /* rect in device-independent pixels, empty for the whole view */,
+                    float /* scale */)
+
 IPC_MESSAGE_ROUTED1(WebChannelIPCTransport_SetWorldId, base::Optional<uint> /* worldId */)
 IPC_MESSAGE_ROUTED2(WebChannelIPCTransport_Message, std::vector<char> /*binaryJSON*/, uint /* worldId */)
 
@@ -54,6 +71,12 @@ IPC_MESSAGE_CONTROL1(UserResourceController_AddScript, UserScriptData /* scriptC
 IPC_MESSAGE_CONTROL1(UserResourceController_RemoveScript, UserScriptData /* scriptContents */)
 IPC_MESSAGE_CONTROL0(UserResourceController_ClearScripts)
 
+// Snapshot of the profile's storage access policy, pushed to the renderer so that
+// storage permission checks can be answered without a synchronous round trip.
+IPC_MESSAGE_CONTROL2(QtWebEngineMsg_SetStorageAccessPolicy,
+                     int /* policy */,
+                     bool /* hasCookieFilter */)
+
 // Tells the renderer whether or not a file system access has been allowed.
 IPC_MESSAGE_ROUTED2(QtWebEngineMsg_RequestFileSystemAccessAsyncResponse,
                     int  /* request_id */,
@@ -72,6 +95,21 @@ IPC_MESSAGE_ROUTED2(RenderViewObserverHostQt_DidFetchDocumentInnerText,
                     uint64_t /* requestId */,
                     base::string16 /* innerText */)
 
+// The renderer writes each chunk into the shared memory announced when the stream starts, and
+// waits for RenderViewObserverQt_DocumentContentChunkAck before overwriting it with the next one.
+IPC_MESSAGE_ROUTED3(RenderViewObserverHostQt_DidStartDocumentContentStream,
+                    uint64_t /* requestId */,
+                    base::SharedMemoryHandle /* buffer */,
+                    uint32_t /* capacity */)
+
+IPC_MESSAGE_ROUTED2(RenderViewObserverHostQt_DidStreamDocumentContentChunk,
+                    uint64_t /* requestId */,
+                    uint32_t /* size, 0 when the stream is finished */)
+
+IPC_MESSAGE_ROUTED2(RenderViewObserverHostQt_DidGrabImage,
+                    uint64_t /* requestId */,
+                    SkBitmap /* image, empty on failure */)
+
 IPC_MESSAGE_ROUTED0(RenderViewObserverHostQt_DidFirstVisuallyNonEmptyLayout)
 
 IPC_MESSAGE_ROUTED1(WebChannelIPCTransportHost_SendMessage, std::vector<char> /*binaryJSON*/)
@@ -61,6 +61,7 @@
 #include "content/public/browser/render_process_host.h"
 #include "content/public/browser/render_view_host.h"
 #include "content/public/browser/resource_dispatcher_host.h"
+#include "content/public/browser/site_instance.h"
 #include "content/public/browser/storage_partition.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/browser/web_contents_user_data.h"
@@ -391,6 +392,8 @@ void ContentBrowserClientQt::RenderProcessWillLaunch(content::RenderProcessHost*
     // FIXME: Add a settings variable to enable/disable the file scheme.
     content::ChildProcessSecurityPolicy::GetInstance()->GrantScheme(id, url::kFileScheme);
     static_cast<ProfileQt*>(host->GetBrowserContext())->m_adapter->userResourceController()->renderProcessStartedWithHost(host);
+    static_cast<ProfileQt*>(host->GetBrowserContext())->m_adapter->sendStorageAccessPolicy(host);
+    static_cast<ProfileQt*>(host->GetBrowserContext())->m_adapter->renderProcessWillLaunch(host);
     host->AddFilter(new BrowserMessageFilterQt(id, profile));
 #if defined(Q_OS_MACOS) && BUILDFLAG(ENABLE_SPELLCHECK) && BUILDFLAG(USE_BROWSER_SPELLCHECKER)
   host->AddFilter(new SpellCheckMessageFilterPlatform(id));
@@ -400,6 +403,11 @@ void ContentBrowserClientQt::RenderProcessWillLaunch(content::RenderProcessHost*
 #endif // BUILDFLAG(ENABLE_BASIC_PRINTING)
 }
 
+void ContentBrowserClientQt::SiteInstanceGotProcess(content::SiteInstance *siteInstance)
+{
+    static_cast<ProfileQt*>(siteInstance->GetBrowserContext())->m_adapter->renderProcessAssigned(siteInstance->GetProcess());
+}
+
 void ContentBrowserClientQt::ResourceDispatcherHostCreated()
 {
     m_resourceDispatcherHostDelegate.reset(new ResourceDispatcherHostDelegateQt);
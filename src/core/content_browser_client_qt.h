@@ -87,6 +87,7 @@ public:
     ~ContentBrowserClientQt();
     content::BrowserMainParts* CreateBrowserMainParts(const content::MainFunctionParams&) override;
     void RenderProcessWillLaunch(content::RenderProcessHost* host) override;
+    void SiteInstanceGotProcess(content::SiteInstance *siteInstance) override;
     void ResourceDispatcherHostCreated() override;
     gl::GLShareGroup* GetInProcessGpuShareGroup() override;
     content::MediaObserver* GetMediaObserver() override;
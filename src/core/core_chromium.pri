@@ -59,6 +59,7 @@ SOURCES = \
         devtools_frontend_qt.cpp \
         devtools_manager_delegate_qt.cpp \
         download_manager_delegate_qt.cpp \
+        download_stream_qt.cpp \
         favicon_manager.cpp \
         file_picker_controller.cpp \
         gl_context_qt.cpp \
@@ -67,13 +68,20 @@ SOURCES = \
         javascript_dialog_manager_qt.cpp \
         media_capture_devices_dispatcher.cpp \
         native_web_keyboard_event_qt.cpp \
+        net/cert_verifier_qt.cpp \
+        net/certificate_exception_store_qt.cpp \
         net/cookie_monster_delegate_qt.cpp \
         net/custom_protocol_handler.cpp \
+        net/http_auth_credential_store_qt.cpp \
+        net/http_cache_controller_qt.cpp \
         net/network_delegate_qt.cpp \
+        net/network_metrics_qt.cpp \
+        net/network_predictor_qt.cpp \
         net/proxy_config_service_qt.cpp \
         net/qrc_protocol_handler_qt.cpp \
         net/ssl_host_state_delegate_qt.cpp \
         net/url_request_context_getter_qt.cpp \
+        net/url_request_content_job_qt.cpp \
         net/url_request_custom_job.cpp \
         net/url_request_custom_job_delegate.cpp \
         net/url_request_custom_job_proxy.cpp \
@@ -86,6 +94,7 @@ SOURCES = \
         ozone/ozone_platform_qt.cpp \
         ozone/platform_window_qt.cpp \
         ozone/surface_factory_qt.cpp \
+        origin_pattern.cpp \
         permission_manager_qt.cpp \
         process_main.cpp \
         profile_qt.cpp \
@@ -100,6 +109,7 @@ SOURCES = \
         renderer/content_settings_observer_qt.cpp \
         renderer/render_frame_observer_qt.cpp \
         renderer/render_view_observer_qt.cpp \
+        renderer/storage_access_policy_qt.cpp \
         renderer/user_resource_controller.cpp \
         renderer/web_channel_ipc_transport.cpp \
         renderer_host/resource_dispatcher_host_delegate_qt.cpp \
@@ -145,6 +155,7 @@ HEADERS = \
         devtools_frontend_qt.h \
         devtools_manager_delegate_qt.h \
         download_manager_delegate_qt.h \
+        download_stream_qt.h \
         chromium_gpu_helper.h \
         favicon_manager.h \
         file_picker_controller.h \
@@ -155,12 +166,19 @@ HEADERS = \
         javascript_dialog_controller.h \
         javascript_dialog_manager_qt.h \
         media_capture_devices_dispatcher.h \
+        net/cert_verifier_qt.h \
+        net/certificate_exception_store_qt.h \
         net/cookie_monster_delegate_qt.h \
         net/custom_protocol_handler.h \
+        net/http_auth_credential_store_qt.h \
+        net/http_cache_controller_qt.h \
         net/network_delegate_qt.h \
+        net/network_metrics_qt.h \
+        net/network_predictor_qt.h \
         net/qrc_protocol_handler_qt.h \
         net/ssl_host_state_delegate_qt.h \
         net/url_request_context_getter_qt.h \
+        net/url_request_content_job_qt.h \
         net/url_request_custom_job.h \
         net/url_request_custom_job_delegate.h \
         net/url_request_custom_job_proxy.h \
@@ -173,6 +191,7 @@ HEADERS = \
         ozone/ozone_platform_qt.h \
         ozone/platform_window_qt.h \
         ozone/surface_factory_qt.h \
+        origin_pattern.h \
         permission_manager_qt.h \
         process_main.h \
         profile_qt.h \
@@ -191,6 +210,7 @@ HEADERS = \
         renderer/content_settings_observer_qt.h \
         renderer/render_frame_observer_qt.h \
         renderer/render_view_observer_qt.h \
+        renderer/storage_access_policy_qt.h \
         renderer/user_resource_controller.h \
         renderer/web_channel_ipc_transport.h \
         renderer_host/resource_dispatcher_host_delegate_qt.h \
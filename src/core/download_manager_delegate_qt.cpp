@@ -39,6 +39,7 @@
 
 #include "download_manager_delegate_qt.h"
 
+#include "base/threading/thread_task_runner_handle.h"
 #include "content/public/browser/download_manager.h"
 #include "content/public/browser/download_item.h"
 #include "content/public/browser/save_page_type.h"
@@ -54,6 +55,7 @@
 
 #include "browser_context_adapter_client.h"
 #include "browser_context_adapter.h"
+#include "download_stream_qt.h"
 #include "profile_qt.h"
 #include "qtwebenginecoreglobal.h"
 #include "type_conversion.h"
@@ -86,6 +88,12 @@ void DownloadManagerDelegateQt::cancelDownload(const content::DownloadTargetCall
 
 void DownloadManagerDelegateQt::cancelDownload(quint32 downloadId)
 {
+    auto stream = m_streams.find(downloadId);
+    if (stream != m_streams.end()) {
+        stream->second->cancel();
+        return;
+    }
+
     content::DownloadManager* dlm = content::BrowserContext::GetDownloadManager(m_contextAdapter->browserContext());
     content::DownloadItem *download = dlm->GetDownload(downloadId);
     if (download)
@@ -94,6 +102,12 @@ void DownloadManagerDelegateQt::cancelDownload(quint32 downloadId)
 
 void DownloadManagerDelegateQt::pauseDownload(quint32 downloadId)
 {
+    auto stream = m_streams.find(downloadId);
+    if (stream != m_streams.end()) {
+        stream->second->pause();
+        return;
+    }
+
     content::DownloadManager* dlm = content::BrowserContext::GetDownloadManager(m_contextAdapter->browserContext());
     content::DownloadItem *download = dlm->GetDownload(downloadId);
     if (download)
@@ -102,6 +116,12 @@ void DownloadManagerDelegateQt::pauseDownload(quint32 downloadId)
 
 void DownloadManagerDelegateQt::resumeDownload(quint32 downloadId)
 {
+    auto stream = m_streams.find(downloadId);
+    if (stream != m_streams.end()) {
+        stream->second->resume();
+        return;
+    }
+
     content::DownloadManager* dlm = content::BrowserContext::GetDownloadManager(m_contextAdapter->browserContext());
     content::DownloadItem *download = dlm->GetDownload(downloadId);
     if (download)
@@ -181,13 +201,31 @@ bool DownloadManagerDelegateQt::DetermineDownloadTarget(content::DownloadItem* i
             false /* paused */,
             false /* done */,
             downloadType,
-            item->GetLastReason()
+            item->GetLastReason(),
+            false /* inMemory */
         };
 
+        BrowserContextAdapterClient *owner = nullptr;
         Q_FOREACH (BrowserContextAdapterClient *client, clients) {
             client->downloadRequested(info);
-            if (info.accepted)
+            if (info.accepted) {
+                owner = client;
                 break;
+            }
+        }
+
+        if (info.accepted && info.inMemory) {
+            // Chromium's download can only be written to a file, so it writes to a private
+            // temporary file whose data is handed to the client as it arrives.
+            m_downloadOwners.insert(item->GetId(), owner);
+            const base::FilePath temporaryFilePath = DownloadStreamQt::temporaryFilePath();
+            m_streams[item->GetId()].reset(new DownloadStreamQt(this, item, mimeTypeString, temporaryFilePath));
+            callback.Run(temporaryFilePath,
+                         content::DownloadItem::TARGET_DISPOSITION_OVERWRITE,
+                         content::DOWNLOAD_DANGER_TYPE_NOT_DANGEROUS,
+                         temporaryFilePath,
+                         content::DOWNLOAD_INTERRUPT_REASON_NONE);
+            return true;
         }
 
         suggestedFile.setFile(info.path);
@@ -202,6 +240,7 @@ bool DownloadManagerDelegateQt::DetermineDownloadTarget(content::DownloadItem* i
             return true;
         }
 
+        m_downloadOwners.insert(item->GetId(), owner);
         base::FilePath filePathForCallback(toFilePathString(suggestedFile.absoluteFilePath()));
         callback.Run(filePathForCallback,
                      content::DownloadItem::TARGET_DISPOSITION_OVERWRITE,
@@ -276,13 +315,16 @@ void DownloadManagerDelegateQt::ChooseSavePath(content::WebContents *web_content
         false, /* paused */
         false, /* done */
         BrowserContextAdapterClient::SavePage,
-        BrowserContextAdapterClient::NoReason
+        BrowserContextAdapterClient::NoReason,
+        false /* inMemory */
     };
 
     Q_FOREACH (BrowserContextAdapterClient *client, clients) {
         client->downloadRequested(info);
-        if (info.accepted)
+        if (info.accepted) {
+            m_downloadOwners.insert(info.id, client);
             break;
+        }
     }
 
     if (!info.accepted)
@@ -321,33 +363,133 @@ void DownloadManagerDelegateQt::savePackageDownloadCreated(content::DownloadItem
 
 void DownloadManagerDelegateQt::OnDownloadUpdated(content::DownloadItem *download)
 {
-    QList<BrowserContextAdapterClient*> clients = m_contextAdapter->clients();
-    if (!clients.isEmpty()) {
+    // Streamed downloads report their progress from the DownloadStreamQt.
+    auto stream = m_streams.find(download->GetId());
+    if (stream != m_streams.end()) {
+        stream->second->downloadUpdated();
+        return;
+    }
+
+    BrowserContextAdapterClient *client = downloadOwner(download->GetId());
+    if (!client || shouldThrottleUpdate(download))
+        return;
+
+    BrowserContextAdapterClient::DownloadItemInfo info = {
+        download->GetId(),
+        toQt(download->GetURL()),
+        download->GetState(),
+        download->GetTotalBytes(),
+        download->GetReceivedBytes(),
+        toQt(download->GetMimeType()),
+        QString(),
+        BrowserContextAdapterClient::UnknownSavePageFormat,
+        true /* accepted */,
+        download->IsPaused(),
+        download->IsDone(),
+        0 /* downloadType (unused) */,
+        download->GetLastReason(),
+        false /* inMemory */
+    };
+
+    if (download->IsDone()) {
+        m_downloadOwners.remove(download->GetId());
+        m_lastUpdates.remove(download->GetId());
+    }
+    client->downloadUpdated(info);
+}
+
+BrowserContextAdapterClient *DownloadManagerDelegateQt::downloadOwner(quint32 downloadId) const
+{
+    BrowserContextAdapterClient *client = m_downloadOwners.value(downloadId);
+    // The client may have been removed from the profile since it accepted the download.
+    if (!client || !m_contextAdapter->clients().contains(client))
+        return nullptr;
+    return client;
+}
+
+bool DownloadManagerDelegateQt::shouldThrottleUpdate(content::DownloadItem *download)
+{
+    const int interval = m_contextAdapter->downloadProgressInterval();
+    if (interval <= 0 || download->IsDone())
+        return false;
+
+    const base::TimeTicks now = base::TimeTicks::Now();
+    auto lastUpdate = m_lastUpdates.find(download->GetId());
+    if (lastUpdate != m_lastUpdates.end()
+            && lastUpdate->paused == download->IsPaused()
+            && now - lastUpdate->time < base::TimeDelta::FromMilliseconds(interval))
+        return true;
+
+    m_lastUpdates.insert(download->GetId(), LastUpdate{ now, download->IsPaused() });
+    return false;
+}
+
+void DownloadManagerDelegateQt::downloadStreamUpdated(DownloadStreamQt *stream)
+{
+    const quint32 id = stream->id();
+    const bool done = stream->state() != content::DownloadItem::IN_PROGRESS;
+    BrowserContextAdapterClient *client = downloadOwner(id);
+
+    if (client && (done || !m_lastUpdates.contains(id) || m_contextAdapter->downloadProgressInterval() <= 0
+                   || base::TimeTicks::Now() - m_lastUpdates.value(id).time
+                        >= base::TimeDelta::FromMilliseconds(m_contextAdapter->downloadProgressInterval()))) {
+        m_lastUpdates.insert(id, LastUpdate{ base::TimeTicks::Now(), false });
         BrowserContextAdapterClient::DownloadItemInfo info = {
-            download->GetId(),
-            toQt(download->GetURL()),
-            download->GetState(),
-            download->GetTotalBytes(),
-            download->GetReceivedBytes(),
-            toQt(download->GetMimeType()),
+            id,
+            toQt(stream->url()),
+            stream->state(),
+            stream->totalBytes(),
+            stream->receivedBytes(),
+            stream->mimeType(),
             QString(),
             BrowserContextAdapterClient::UnknownSavePageFormat,
             true /* accepted */,
-            download->IsPaused(),
-            download->IsDone(),
+            stream->isPaused(),
+            done,
             0 /* downloadType (unused) */,
-            download->GetLastReason()
+            stream->interruptReason(),
+            true /* inMemory */
         };
+        client->downloadUpdated(info);
+    }
 
-        Q_FOREACH (BrowserContextAdapterClient *client, clients) {
-            client->downloadUpdated(info);
-        }
+    if (done) {
+        m_downloadOwners.remove(id);
+        m_lastUpdates.remove(id);
+        // Take the stream out of the map first, the download item may be updated while it is destroyed.
+        std::unique_ptr<DownloadStreamQt> finished = std::move(m_streams[id]);
+        m_streams.erase(id);
+        // The item may be notifying its observers, so it is removed later.
+        base::ThreadTaskRunnerHandle::Get()->PostTask(FROM_HERE, base::Bind(&DownloadManagerDelegateQt::removeDownload,
+                                                                            m_weakPtrFactory.GetWeakPtr(), id));
     }
 }
 
+void DownloadManagerDelegateQt::removeDownload(quint32 downloadId)
+{
+    content::DownloadManager* dlm = content::BrowserContext::GetDownloadManager(m_contextAdapter->browserContext());
+    if (content::DownloadItem *download = dlm->GetDownload(downloadId))
+        download->Remove();
+}
+
+void DownloadManagerDelegateQt::downloadStreamDataReceived(DownloadStreamQt *stream, const QByteArray &data)
+{
+    if (BrowserContextAdapterClient *client = downloadOwner(stream->id()))
+        client->downloadDataReceived(stream->id(), data);
+    else
+        stream->cancel();
+}
+
 void DownloadManagerDelegateQt::OnDownloadDestroyed(content::DownloadItem *download)
 {
     download->RemoveObserver(this);
+    auto stream = m_streams.find(download->GetId());
+    if (stream != m_streams.end()) {
+        std::unique_ptr<DownloadStreamQt> destroyed = std::move(stream->second);
+        m_streams.erase(stream);
+        m_downloadOwners.remove(download->GetId());
+        m_lastUpdates.remove(download->GetId());
+    }
     download->Cancel(/* user_cancel */ false);
 }
 
@@ -42,9 +42,14 @@
 
 #include "content/public/browser/download_manager_delegate.h"
 #include <base/memory/weak_ptr.h>
+#include <base/time/time.h>
 
+#include <QHash>
 #include <QtGlobal>
 
+#include <map>
+#include <memory>
+
 namespace base {
 class FilePath;
 }
@@ -57,7 +62,9 @@ class WebContents;
 
 namespace QtWebEngineCore {
 class BrowserContextAdapter;
+class BrowserContextAdapterClient;
 class DownloadManagerDelegateInstance;
+class DownloadStreamQt;
 class DownloadTargetHelper;
 
 class DownloadManagerDelegateQt
@@ -90,6 +97,9 @@ public:
 
     void markNextDownloadAsUserRequested() { m_nextDownloadIsUserRequested = true; }
 
+    void downloadStreamUpdated(DownloadStreamQt *stream);
+    void downloadStreamDataReceived(DownloadStreamQt *stream, const QByteArray &data);
+
     // Inherited from content::DownloadItem::Observer
     void OnDownloadUpdated(content::DownloadItem *download) override;
     void OnDownloadDestroyed(content::DownloadItem *download) override;
@@ -97,8 +107,20 @@ public:
 private:
     void cancelDownload(const content::DownloadTargetCallback& callback);
     void savePackageDownloadCreated(content::DownloadItem *download);
+    void removeDownload(quint32 downloadId);
+    BrowserContextAdapterClient *downloadOwner(quint32 downloadId) const;
+    bool shouldThrottleUpdate(content::DownloadItem *download);
     BrowserContextAdapter *m_contextAdapter;
 
+    // Progress of a download is only reported to the client that accepted it.
+    QHash<quint32, BrowserContextAdapterClient *> m_downloadOwners;
+    struct LastUpdate {
+        base::TimeTicks time;
+        bool paused;
+    };
+    QHash<quint32, LastUpdate> m_lastUpdates;
+    std::map<quint32, std::unique_ptr<DownloadStreamQt>> m_streams;
+
     uint64_t m_currentId;
     base::WeakPtrFactory<DownloadManagerDelegateQt> m_weakPtrFactory;
     bool m_nextDownloadIsUserRequested;
@@ -0,0 +1,244 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "download_stream_qt.h"
+
+#include "base/files/file.h"
+#include "base/files/file_util.h"
+#include "base/task_runner_util.h"
+#include "base/task_scheduler/post_task.h"
+#include "base/unguessable_token.h"
+#include "content/public/browser/download_interrupt_reasons.h"
+#include "content/public/browser/download_item.h"
+
+#include "browser_context_adapter_client.h"
+#include "download_manager_delegate_qt.h"
+#include "type_conversion.h"
+
+#include <QDir>
+
+#include <algorithm>
+
+namespace QtWebEngineCore {
+
+// Data is handed out in chunks of at most this size, one read at a time.
+static const qint64 kChunkSize = 64 * 1024;
+// The download is paused while this much data is waiting to be read, and
+// resumed once the client has caught up to half of it.
+static const qint64 kMaxBufferedBytes = 8 * 1024 * 1024;
+
+// Only used on the file task runner. The file is opened once for the whole download,
+// the handle keeps following it when Chromium moves it to its target path.
+class DownloadStreamQt::FileReader {
+public:
+    QByteArray read(const base::FilePath &path, qint64 offset, int size)
+    {
+        if (!m_file.IsValid()) {
+            // The file may not have been created yet, the next read tries again.
+            m_file.Initialize(path, base::File::FLAG_OPEN | base::File::FLAG_READ | base::File::FLAG_SHARE_DELETE);
+            if (!m_file.IsValid())
+                return QByteArray();
+        }
+        QByteArray data(size, Qt::Uninitialized);
+        const int read = m_file.Read(offset, data.data(), size);
+        if (read <= 0)
+            return QByteArray();
+        data.truncate(read);
+        return data;
+    }
+
+private:
+    base::File m_file;
+};
+
+DownloadStreamQt::DownloadStreamQt(DownloadManagerDelegateQt *delegate, content::DownloadItem *item,
+                                   const QString &mimeType, const base::FilePath &path)
+    : m_delegate(delegate)
+    , m_item(item)
+    , m_id(item->GetId())
+    , m_url(item->GetURL())
+    , m_mimeType(mimeType)
+    , m_path(path)
+    , m_fileTaskRunner(base::CreateSequencedTaskRunnerWithTraits({ base::MayBlock(), base::TaskPriority::USER_VISIBLE }))
+    , m_fileReader(new FileReader, base::OnTaskRunnerDeleter(m_fileTaskRunner))
+    , m_state(content::DownloadItem::IN_PROGRESS)
+    , m_totalBytes(-1)
+    , m_receivedBytes(0)
+    , m_interruptReason(BrowserContextAdapterClient::NoReason)
+    , m_reading(false)
+    , m_pausedByClient(false)
+    , m_pausedForBackPressure(false)
+    , m_weakPtrFactory(this)
+{
+}
+
+DownloadStreamQt::~DownloadStreamQt()
+{
+    // The delegate removes the download item, Chromium only deletes the file of unfinished downloads.
+    // The file is closed first.
+    m_fileReader.reset();
+    m_fileTaskRunner->PostTask(FROM_HERE, base::Bind(base::IgnoreResult(&base::DeleteFile), m_path, false));
+}
+
+base::FilePath DownloadStreamQt::temporaryFilePath()
+{
+    const QString fileName = QStringLiteral("qtwebengine-download-") + QString::fromStdString(base::UnguessableToken::Create().ToString());
+    return toFilePath(QDir(QDir::tempPath()).absoluteFilePath(fileName));
+}
+
+void DownloadStreamQt::pause()
+{
+    m_pausedByClient = true;
+    m_item->Pause();
+}
+
+void DownloadStreamQt::resume()
+{
+    m_pausedByClient = false;
+    if (!m_pausedForBackPressure)
+        m_item->Resume();
+}
+
+void DownloadStreamQt::downloadUpdated()
+{
+    if (m_state != content::DownloadItem::IN_PROGRESS)
+        return;
+
+    m_totalBytes = m_item->GetTotalBytes();
+
+    switch (m_item->GetState()) {
+    case content::DownloadItem::CANCELLED:
+        finish(content::DownloadItem::CANCELLED, m_item->GetLastReason());
+        return;
+    case content::DownloadItem::INTERRUPTED:
+        finish(content::DownloadItem::INTERRUPTED, m_item->GetLastReason());
+        return;
+    default:
+        break;
+    }
+
+    base::WeakPtr<DownloadStreamQt> self = m_weakPtrFactory.GetWeakPtr();
+    readMore();
+    if (self && m_state == content::DownloadItem::IN_PROGRESS)
+        m_delegate->downloadStreamUpdated(this);
+}
+
+void DownloadStreamQt::cancel()
+{
+    if (m_state != content::DownloadItem::IN_PROGRESS)
+        return;
+    finish(content::DownloadItem::CANCELLED, BrowserContextAdapterClient::UserCanceled);
+}
+
+void DownloadStreamQt::readMore()
+{
+    if (m_reading || m_state != content::DownloadItem::IN_PROGRESS)
+        return;
+
+    // Pausing and resuming the item updates it, which can already start a read.
+    updateBackPressure();
+    if (m_reading)
+        return;
+
+    const qint64 available = m_item->GetReceivedBytes() - m_receivedBytes;
+    if (available <= 0) {
+        if (m_item->GetState() == content::DownloadItem::COMPLETE)
+            finish(content::DownloadItem::COMPLETE, BrowserContextAdapterClient::NoReason);
+        return;
+    }
+
+    // Chromium may still be moving the file to its target path, so the current
+    // path of the item is read. A failed read is retried on the next update.
+    const base::FilePath path = m_item->GetFullPath().empty() ? m_path : m_item->GetFullPath();
+    m_reading = true;
+    // The reader is deleted on the file task runner, after any read posted before.
+    base::PostTaskAndReplyWithResult(m_fileTaskRunner.get(), FROM_HERE,
+                                     base::Bind(&FileReader::read, base::Unretained(m_fileReader.get()),
+                                                path, m_receivedBytes, int(std::min(available, kChunkSize))),
+                                     base::Bind(&DownloadStreamQt::onChunkRead, m_weakPtrFactory.GetWeakPtr()));
+}
+
+void DownloadStreamQt::onChunkRead(const QByteArray &data)
+{
+    m_reading = false;
+    if (m_state != content::DownloadItem::IN_PROGRESS)
+        return;
+
+    if (data.isEmpty()) {
+        // Once the download is complete, its file does not move anymore.
+        if (m_item->GetState() == content::DownloadItem::COMPLETE)
+            finish(content::DownloadItem::INTERRUPTED, BrowserContextAdapterClient::FileFailed);
+        return;
+    }
+
+    m_receivedBytes += data.size();
+    base::WeakPtr<DownloadStreamQt> self = m_weakPtrFactory.GetWeakPtr();
+    // May cancel and delete this.
+    m_delegate->downloadStreamDataReceived(this, data);
+    if (self)
+        readMore();
+}
+
+void DownloadStreamQt::updateBackPressure()
+{
+    if (m_item->GetState() != content::DownloadItem::IN_PROGRESS)
+        return;
+
+    const qint64 buffered = m_item->GetReceivedBytes() - m_receivedBytes;
+    if (!m_pausedForBackPressure && buffered >= kMaxBufferedBytes) {
+        m_pausedForBackPressure = true;
+        if (!m_pausedByClient)
+            m_item->Pause();
+    } else if (m_pausedForBackPressure && buffered < kMaxBufferedBytes / 2) {
+        m_pausedForBackPressure = false;
+        if (!m_pausedByClient)
+            m_item->Resume();
+    }
+}
+
+void DownloadStreamQt::finish(int state, int interruptReason)
+{
+    m_state = state;
+    m_interruptReason = interruptReason;
+    m_weakPtrFactory.InvalidateWeakPtrs();
+    // May delete this.
+    m_delegate->downloadStreamUpdated(this);
+}
+
+} // namespace QtWebEngineCore
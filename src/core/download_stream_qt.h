@@ -0,0 +1,120 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef DOWNLOAD_STREAM_QT_H
+#define DOWNLOAD_STREAM_QT_H
+
+#include "base/files/file_path.h"
+#include "base/memory/ref_counted.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequenced_task_runner.h"
+#include "url/gurl.h"
+
+#include <QByteArray>
+#include <QString>
+
+#include <memory>
+
+namespace content {
+class DownloadItem;
+}
+
+namespace QtWebEngineCore {
+
+class DownloadManagerDelegateQt;
+
+// Hands the data of an accepted in-memory download to the DownloadManagerDelegateQt.
+// The download itself keeps running in Chromium and writes to a private temporary
+// file, which is read back chunk by chunk through one file handle as the data arrives
+// and deleted afterwards.
+class DownloadStreamQt
+{
+public:
+    DownloadStreamQt(DownloadManagerDelegateQt *delegate, content::DownloadItem *item,
+                     const QString &mimeType, const base::FilePath &path);
+    ~DownloadStreamQt();
+
+    static base::FilePath temporaryFilePath();
+
+    // Called by the delegate whenever the Chromium download item is updated.
+    void downloadUpdated();
+    void cancel();
+    void pause();
+    void resume();
+
+    quint32 id() const { return m_id; }
+    const GURL &url() const { return m_url; }
+    const QString &mimeType() const { return m_mimeType; }
+    int state() const { return m_state; }
+    bool isPaused() const { return m_pausedByClient; }
+    qint64 totalBytes() const { return m_totalBytes; }
+    qint64 receivedBytes() const { return m_receivedBytes; }
+    int interruptReason() const { return m_interruptReason; }
+
+private:
+    class FileReader;
+
+    void readMore();
+    void onChunkRead(const QByteArray &data);
+    void updateBackPressure();
+    void finish(int state, int interruptReason);
+
+    DownloadManagerDelegateQt *m_delegate;
+    content::DownloadItem *m_item;
+    const quint32 m_id;
+    const GURL m_url;
+    const QString m_mimeType;
+    const base::FilePath m_path;
+    scoped_refptr<base::SequencedTaskRunner> m_fileTaskRunner;
+    std::unique_ptr<FileReader, base::OnTaskRunnerDeleter> m_fileReader;
+    int m_state;
+    qint64 m_totalBytes;
+    qint64 m_receivedBytes;
+    int m_interruptReason;
+    bool m_reading;
+    bool m_pausedByClient;
+    bool m_pausedForBackPressure;
+    base::WeakPtrFactory<DownloadStreamQt> m_weakPtrFactory;
+
+    DISALLOW_COPY_AND_ASSIGN(DownloadStreamQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // DOWNLOAD_STREAM_QT_H
@@ -44,6 +44,7 @@
 
 #include "media_capture_devices_dispatcher.h"
 
+#include "browser_context_adapter.h"
 #include "javascript_dialog_manager_qt.h"
 #include "type_conversion.h"
 #include "web_contents_view_qt.h"
@@ -317,8 +318,31 @@ void MediaCaptureDevicesDispatcher::processMediaAccessRequest(WebContentsAdapter
     }
 
     enqueueMediaAccessRequest(webContents, request, callback);
+
+    const QUrl securityOrigin = toQt(request.security_origin);
+    const WebContentsAdapterClient::MediaRequestFlags requestFlags = mediaRequestFlagsForRequest(request);
+    if (m_pendingRequests[webContents].size() == 1) {
+        // Answer without asking when the profile has a decision for every requested device.
+        BrowserContextAdapter *contextAdapter = adapterClient->browserContextAdapter();
+        BrowserContextAdapter::PermissionState audioState = BrowserContextAdapter::GrantedPermission;
+        BrowserContextAdapter::PermissionState videoState = BrowserContextAdapter::GrantedPermission;
+        if (requestFlags & (WebContentsAdapterClient::MediaDesktopAudioCapture | WebContentsAdapterClient::MediaDesktopVideoCapture))
+            audioState = videoState = BrowserContextAdapter::AskPermission;
+        if (requestFlags & WebContentsAdapterClient::MediaAudioCapture)
+            audioState = contextAdapter->permissionState(securityOrigin, BrowserContextAdapter::AudioCapturePermission);
+        if (requestFlags & WebContentsAdapterClient::MediaVideoCapture)
+            videoState = contextAdapter->permissionState(securityOrigin, BrowserContextAdapter::VideoCapturePermission);
+        if (audioState != BrowserContextAdapter::AskPermission && videoState != BrowserContextAdapter::AskPermission) {
+            WebContentsAdapterClient::MediaRequestFlags grantedFlags = WebContentsAdapterClient::MediaNone;
+            if (audioState == BrowserContextAdapter::GrantedPermission && videoState == BrowserContextAdapter::GrantedPermission)
+                grantedFlags = requestFlags;
+            handleMediaAccessPermissionResponse(webContents, securityOrigin, grantedFlags);
+            return;
+        }
+    }
+
     // We might not require this approval for pepper requests.
-    adapterClient->runMediaAccessPermissionRequest(toQt(request.security_origin), mediaRequestFlagsForRequest(request));
+    adapterClient->runMediaAccessPermissionRequest(securityOrigin, requestFlags);
 }
 
 void MediaCaptureDevicesDispatcher::processDesktopCaptureAccessRequest(content::WebContents *webContents, const content::MediaStreamRequest &request
@@ -0,0 +1,84 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "cert_verifier_qt.h"
+
+#include "certificate_exception_store_qt.h"
+
+#include "net/base/net_errors.h"
+#include "net/cert/cert_verify_result.h"
+#include "net/cert/x509_certificate.h"
+
+namespace QtWebEngineCore {
+
+CertVerifierQt::CertVerifierQt(std::unique_ptr<net::CertVerifier> verifier,
+                               scoped_refptr<CertificateExceptionStoreQt> exceptionStore)
+    : m_verifier(std::move(verifier))
+    , m_exceptionStore(std::move(exceptionStore))
+{
+}
+
+CertVerifierQt::~CertVerifierQt()
+{
+}
+
+int CertVerifierQt::Verify(const RequestParams &params,
+                           net::CRLSet *crl_set,
+                           net::CertVerifyResult *verify_result,
+                           const net::CompletionCallback &callback,
+                           std::unique_ptr<Request> *out_req,
+                           const net::NetLogWithSource &net_log)
+{
+    net::HashValueVector publicKeyHashes;
+    if (m_exceptionStore && m_exceptionStore->isTrusted(params.hostname(), *params.certificate(), &publicKeyHashes)) {
+        verify_result->Reset();
+        verify_result->verified_cert = params.certificate();
+        verify_result->public_key_hashes = publicKeyHashes;
+        return net::OK;
+    }
+    return m_verifier->Verify(params, crl_set, verify_result, callback, out_req, net_log);
+}
+
+bool CertVerifierQt::SupportsOCSPStapling()
+{
+    return m_verifier->SupportsOCSPStapling();
+}
+
+} // namespace QtWebEngineCore
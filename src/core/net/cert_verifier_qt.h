@@ -0,0 +1,80 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef CERT_VERIFIER_QT_H
+#define CERT_VERIFIER_QT_H
+
+#include "base/memory/ref_counted.h"
+#include "net/cert/cert_verifier.h"
+
+#include <memory>
+
+namespace QtWebEngineCore {
+
+class CertificateExceptionStoreQt;
+
+// Wraps the default certificate verifier, and accepts certificates for which the profile
+// has an exception allowing all errors without verifying them, so that such hosts never
+// reach the certificateError() handlers.
+class CertVerifierQt : public net::CertVerifier {
+public:
+    CertVerifierQt(std::unique_ptr<net::CertVerifier> verifier,
+                   scoped_refptr<CertificateExceptionStoreQt> exceptionStore);
+    ~CertVerifierQt() override;
+
+    // net::CertVerifier implementation:
+    int Verify(const RequestParams &params,
+               net::CRLSet *crl_set,
+               net::CertVerifyResult *verify_result,
+               const net::CompletionCallback &callback,
+               std::unique_ptr<Request> *out_req,
+               const net::NetLogWithSource &net_log) override;
+    bool SupportsOCSPStapling() override;
+
+private:
+    std::unique_ptr<net::CertVerifier> m_verifier;
+    scoped_refptr<CertificateExceptionStoreQt> m_exceptionStore;
+
+    DISALLOW_COPY_AND_ASSIGN(CertVerifierQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // CERT_VERIFIER_QT_H
@@ -0,0 +1,350 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "certificate_exception_store_qt.h"
+
+#include "crypto/sha2.h"
+#include "net/cert/asn1_util.h"
+#include "net/cert/x509_certificate.h"
+
+#include <QDateTime>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <cstring>
+
+namespace QtWebEngineCore {
+
+static const int kExceptionsFormatVersion = 1;
+
+static QString hashTypeName(CertificateExceptionStoreQt::HashType type)
+{
+    switch (type) {
+    case CertificateExceptionStoreQt::CertificateHash:
+        return QStringLiteral("certificate");
+    case CertificateExceptionStoreQt::PublicKeyHash:
+        return QStringLiteral("publicKey");
+    case CertificateExceptionStoreQt::ChainHash:
+        break;
+    }
+    return QStringLiteral("chain");
+}
+
+static bool hashTypeFromName(const QString &name, CertificateExceptionStoreQt::HashType *type)
+{
+    if (name == QLatin1String("certificate"))
+        *type = CertificateExceptionStoreQt::CertificateHash;
+    else if (name == QLatin1String("publicKey"))
+        *type = CertificateExceptionStoreQt::PublicKeyHash;
+    else if (name == QLatin1String("chain"))
+        *type = CertificateExceptionStoreQt::ChainHash;
+    else
+        return false;
+    return true;
+}
+
+bool CertificateExceptionStoreQt::Exception::matches(const net::X509Certificate &cert) const
+{
+    switch (type) {
+    case CertificateHash:
+        return hash == certificateHash(cert);
+    case PublicKeyHash: {
+        net::SHA256HashValue keyHash;
+        return publicKeyHash(cert, &keyHash) && hash == keyHash;
+    }
+    case ChainHash:
+        return hash == cert.CalculateChainFingerprint256();
+    }
+    return false;
+}
+
+CertificateExceptionStoreQt::CertificateExceptionStoreQt()
+{
+}
+
+CertificateExceptionStoreQt::~CertificateExceptionStoreQt()
+{
+}
+
+net::SHA256HashValue CertificateExceptionStoreQt::certificateHash(const net::X509Certificate &cert)
+{
+    return net::X509Certificate::CalculateFingerprint256(cert.os_cert_handle());
+}
+
+static bool spkiHash(net::X509Certificate::OSCertHandle handle, net::SHA256HashValue *hash)
+{
+    std::string der;
+    base::StringPiece spki;
+    if (!net::X509Certificate::GetDEREncoded(handle, &der) || !net::asn1::ExtractSPKIFromDERCert(der, &spki))
+        return false;
+    crypto::SHA256HashString(spki, hash->data, sizeof(hash->data));
+    return true;
+}
+
+// The hash of the server certificate's own key, the only one an exception can match.
+bool CertificateExceptionStoreQt::publicKeyHash(const net::X509Certificate &cert, net::SHA256HashValue *hash)
+{
+    return spkiHash(cert.os_cert_handle(), hash);
+}
+
+// The hashes of all keys in the presented chain, as reported in the verification result.
+net::HashValueVector CertificateExceptionStoreQt::publicKeyHashes(const net::X509Certificate &cert)
+{
+    net::HashValueVector hashes;
+    net::SHA256HashValue hash;
+    if (spkiHash(cert.os_cert_handle(), &hash))
+        hashes.push_back(net::HashValue(hash));
+    for (net::X509Certificate::OSCertHandle handle : cert.GetIntermediateCertificates()) {
+        if (spkiHash(handle, &hash))
+            hashes.push_back(net::HashValue(hash));
+    }
+    return hashes;
+}
+
+bool CertificateExceptionStoreQt::addException(const std::string &host, HashType type, const net::SHA256HashValue &hash,
+                                              net::CertStatus errors, base::Time expiry, bool persistent)
+{
+    QMutexLocker lock(&m_mutex);
+    return addExceptionLocked(host, { type, hash, errors, expiry, persistent });
+}
+
+bool CertificateExceptionStoreQt::addExceptionLocked(const std::string &host, const Exception &exception)
+{
+    if (host.empty())
+        return false;
+    std::vector<Exception> &exceptions = m_exceptions[host];
+    for (Exception &existing : exceptions) {
+        if (existing.type == exception.type && existing.hash == exception.hash) {
+            // Widen the existing exception rather than keeping several for the same hash.
+            existing.errors = (existing.errors && exception.errors) ? (existing.errors | exception.errors) : 0;
+            existing.expiry = exception.expiry;
+            existing.persistent = existing.persistent || exception.persistent;
+            return true;
+        }
+    }
+    exceptions.push_back(exception);
+    return true;
+}
+
+void CertificateExceptionStoreQt::allowCertificate(const std::string &host, const net::X509Certificate &cert,
+                                                   net::CertStatus errors, base::Time expiry, bool persistent)
+{
+    addException(host, ChainHash, cert.CalculateChainFingerprint256(), errors, expiry, persistent);
+}
+
+void CertificateExceptionStoreQt::removeExpiredLocked(std::vector<Exception> *exceptions, base::Time now)
+{
+    exceptions->erase(std::remove_if(exceptions->begin(), exceptions->end(), [now](const Exception &exception) {
+        return !exception.expiry.is_null() && exception.expiry <= now;
+    }), exceptions->end());
+}
+
+// For an allowance, we consider a given |cert| to be a match to a saved
+// allowed cert if the |errors| are an exact match to or subset of the errors
+// allowed by the exception.
+CertificateExceptionStoreQt::QueryResult CertificateExceptionStoreQt::query(const std::string &host,
+                                                                            const net::X509Certificate &cert,
+                                                                            net::CertStatus errors)
+{
+    QMutexLocker lock(&m_mutex);
+    auto it = m_exceptions.find(host);
+    if (it == m_exceptions.end())
+        return NoException;
+
+    const base::Time now = base::Time::Now();
+    bool expired = false;
+    for (const Exception &exception : it->second) {
+        if (!exception.matches(cert))
+            continue;
+        if (!exception.expiry.is_null() && exception.expiry <= now) {
+            expired = true;
+            continue;
+        }
+        if (!exception.errors || (errors && (exception.errors & errors) == errors))
+            return Allowed;
+    }
+    if (expired) {
+        removeExpiredLocked(&it->second, now);
+        if (it->second.empty())
+            m_exceptions.erase(it);
+    }
+    return expired ? Expired : NoException;
+}
+
+// Looks for an exception allowing every error for |cert|, called while verifying
+// certificates on the IO thread. Certificates are only hashed for hosts with exceptions.
+bool CertificateExceptionStoreQt::isTrusted(const std::string &host, const net::X509Certificate &cert,
+                                            net::HashValueVector *publicKeyHashesOut)
+{
+    QMutexLocker lock(&m_mutex);
+    auto it = m_exceptions.find(host);
+    if (it == m_exceptions.end())
+        return false;
+    const bool hasUnconditional = std::any_of(it->second.begin(), it->second.end(), [](const Exception &exception) {
+        return !exception.errors;
+    });
+    if (!hasUnconditional)
+        return false;
+
+    const base::Time now = base::Time::Now();
+    for (const Exception &exception : it->second) {
+        if (exception.errors || (!exception.expiry.is_null() && exception.expiry <= now))
+            continue;
+        if (exception.matches(cert)) {
+            if (publicKeyHashesOut)
+                *publicKeyHashesOut = publicKeyHashes(cert);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool CertificateExceptionStoreQt::hasException(const std::string &host) const
+{
+    QMutexLocker lock(&m_mutex);
+    auto it = m_exceptions.find(host);
+    return it != m_exceptions.end() && !it->second.empty();
+}
+
+bool CertificateExceptionStoreQt::isEmpty() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_exceptions.empty();
+}
+
+void CertificateExceptionStoreQt::removeExceptions(const std::string &host)
+{
+    QMutexLocker lock(&m_mutex);
+    m_exceptions.erase(host);
+}
+
+void CertificateExceptionStoreQt::clear(const base::Callback<bool(const std::string &)> &hostFilter)
+{
+    QMutexLocker lock(&m_mutex);
+    if (hostFilter.is_null()) {
+        m_exceptions.clear();
+        return;
+    }
+    for (auto it = m_exceptions.begin(); it != m_exceptions.end();) {
+        if (hostFilter.Run(it->first))
+            it = m_exceptions.erase(it);
+        else
+            ++it;
+    }
+}
+
+QByteArray CertificateExceptionStoreQt::exportExceptions() const
+{
+    QMutexLocker lock(&m_mutex);
+    const base::Time now = base::Time::Now();
+    QJsonArray entries;
+    for (const auto &hostExceptions : m_exceptions) {
+        for (const Exception &exception : hostExceptions.second) {
+            if (!exception.persistent || (!exception.expiry.is_null() && exception.expiry <= now))
+                continue;
+            QJsonObject entry;
+            entry.insert(QStringLiteral("host"), QString::fromStdString(hostExceptions.first));
+            entry.insert(QStringLiteral("type"), hashTypeName(exception.type));
+            entry.insert(QStringLiteral("hash"), QString::fromStdString(net::HashValue(exception.hash).ToString()));
+            if (exception.errors)
+                entry.insert(QStringLiteral("errors"), static_cast<qint64>(exception.errors));
+            if (!exception.expiry.is_null())
+                entry.insert(QStringLiteral("expires"),
+                             QDateTime::fromMSecsSinceEpoch(exception.expiry.ToJavaTime(), Qt::UTC).toString(Qt::ISODate));
+            entries.append(entry);
+        }
+    }
+    QJsonObject root;
+    root.insert(QStringLiteral("version"), kExceptionsFormatVersion);
+    root.insert(QStringLiteral("exceptions"), entries);
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+bool CertificateExceptionStoreQt::importExceptions(const QByteArray &data, bool *changed)
+{
+    if (changed)
+        *changed = false;
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(data, &error);
+    if (error.error != QJsonParseError::NoError || !document.isObject())
+        return false;
+    const QJsonObject root = document.object();
+    if (root.value(QStringLiteral("version")).toInt() != kExceptionsFormatVersion)
+        return false;
+
+    QMutexLocker lock(&m_mutex);
+    bool valid = true;
+    const QJsonArray entries = root.value(QStringLiteral("exceptions")).toArray();
+    for (const QJsonValue &value : entries) {
+        const QJsonObject entry = value.toObject();
+        Exception exception;
+        exception.persistent = true;
+        net::HashValue hash;
+        if (!hashTypeFromName(entry.value(QStringLiteral("type")).toString(), &exception.type)
+                || !hash.FromString(entry.value(QStringLiteral("hash")).toString().toStdString())
+                || hash.tag != net::HASH_VALUE_SHA256) {
+            valid = false;
+            continue;
+        }
+        memcpy(exception.hash.data, hash.data(), sizeof(exception.hash.data));
+        exception.errors = static_cast<net::CertStatus>(entry.value(QStringLiteral("errors")).toDouble());
+        const QJsonValue expires = entry.value(QStringLiteral("expires"));
+        if (expires.isString()) {
+            const QDateTime expiry = QDateTime::fromString(expires.toString(), Qt::ISODate);
+            if (!expiry.isValid()) {
+                valid = false;
+                continue;
+            }
+            exception.expiry = base::Time::FromJavaTime(expiry.toMSecsSinceEpoch());
+        }
+        if (!addExceptionLocked(entry.value(QStringLiteral("host")).toString().toLower().toStdString(), exception)) {
+            valid = false;
+            continue;
+        }
+        if (changed)
+            *changed = true;
+    }
+    return valid;
+}
+
+} // namespace QtWebEngineCore
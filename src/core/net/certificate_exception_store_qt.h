@@ -0,0 +1,135 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef CERTIFICATE_EXCEPTION_STORE_QT_H
+#define CERTIFICATE_EXCEPTION_STORE_QT_H
+
+#include "base/callback.h"
+#include "base/memory/ref_counted.h"
+#include "base/time/time.h"
+#include "net/base/hash_value.h"
+#include "net/cert/cert_status_flags.h"
+
+#include <QtCore/QByteArray>
+#include <QtCore/QMutex>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace net {
+class X509Certificate;
+}
+
+namespace QtWebEngineCore {
+
+// Certificate error exceptions of a profile, keyed by host.
+// An exception matches either the SHA-256 hash of the server certificate, the SHA-256
+// hash of its subject public key info, or the SHA-256 fingerprint of the whole presented
+// chain. Only the server certificate itself is matched by key, any intermediate can be
+// sent by an attacker along with their own certificate.
+// Exceptions that allow every error are applied on the IO thread while the certificate
+// is verified, the others when content asks the SSLHostStateDelegate about an error.
+// Exceptions that are not persistent last for the session only and are never exported.
+// All functions are thread-safe.
+class CertificateExceptionStoreQt : public base::RefCountedThreadSafe<CertificateExceptionStoreQt> {
+public:
+    enum HashType {
+        CertificateHash,
+        PublicKeyHash,
+        ChainHash
+    };
+
+    enum QueryResult {
+        NoException,
+        Allowed,
+        Expired
+    };
+
+    CertificateExceptionStoreQt();
+
+    // A |errors| value of 0 allows all certificate errors. A null |expiry| never expires.
+    bool addException(const std::string &host, HashType type, const net::SHA256HashValue &hash,
+                      net::CertStatus errors, base::Time expiry, bool persistent = true);
+    // Records a decision about |errors| of the chain of |cert|, like accepting a certificate error.
+    void allowCertificate(const std::string &host, const net::X509Certificate &cert,
+                          net::CertStatus errors, base::Time expiry, bool persistent);
+    QueryResult query(const std::string &host, const net::X509Certificate &cert, net::CertStatus errors);
+    bool isTrusted(const std::string &host, const net::X509Certificate &cert,
+                   net::HashValueVector *publicKeyHashes);
+    bool hasException(const std::string &host) const;
+    bool isEmpty() const;
+    void removeExceptions(const std::string &host);
+    void clear(const base::Callback<bool(const std::string &)> &hostFilter);
+
+    QByteArray exportExceptions() const;
+    // Adds the exceptions of |data|, returns false if any of them was invalid.
+    bool importExceptions(const QByteArray &data, bool *changed = nullptr);
+
+    static net::SHA256HashValue certificateHash(const net::X509Certificate &cert);
+    static bool publicKeyHash(const net::X509Certificate &cert, net::SHA256HashValue *hash);
+    static net::HashValueVector publicKeyHashes(const net::X509Certificate &cert);
+
+private:
+    friend class base::RefCountedThreadSafe<CertificateExceptionStoreQt>;
+    ~CertificateExceptionStoreQt();
+
+    struct Exception {
+        HashType type;
+        net::SHA256HashValue hash;
+        net::CertStatus errors;
+        base::Time expiry;
+        bool persistent;
+
+        bool matches(const net::X509Certificate &cert) const;
+    };
+
+    bool addExceptionLocked(const std::string &host, const Exception &exception);
+    void removeExpiredLocked(std::vector<Exception> *exceptions, base::Time now);
+
+    std::map<std::string, std::vector<Exception>> m_exceptions;
+    mutable QMutex m_mutex;
+
+    DISALLOW_COPY_AND_ASSIGN(CertificateExceptionStoreQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // CERTIFICATE_EXCEPTION_STORE_QT_H
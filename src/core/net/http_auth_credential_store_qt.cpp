@@ -0,0 +1,150 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "http_auth_credential_store_qt.h"
+
+#include "net/http/http_auth.h"
+
+#include <QMutexLocker>
+
+#include <algorithm>
+#include <iterator>
+
+namespace QtWebEngineCore {
+
+HttpAuthCredentialStoreQt::HttpAuthCredentialStoreQt()
+{
+}
+
+HttpAuthCredentialStoreQt::~HttpAuthCredentialStoreQt()
+{
+}
+
+bool HttpAuthCredentialStoreQt::add(const url::Origin &origin, const std::string &realm, const std::string &scheme,
+                                    const net::AuthCredentials &credentials, bool preemptive)
+{
+    if (origin.unique())
+        return false;
+    QMutexLocker lock(&m_mutex);
+    std::vector<Entry> &entries = m_entries[origin];
+    for (Entry &existing : entries) {
+        if (existing.realm == realm && existing.scheme == scheme) {
+            existing.credentials = credentials;
+            existing.preemptive = preemptive;
+            return true;
+        }
+    }
+    entries.push_back({ origin, realm, scheme, credentials, preemptive });
+    return true;
+}
+
+// Prefers the entry naming both the realm and the scheme of the challenge,
+// then the realm only, then the scheme only, then one matching anything.
+bool HttpAuthCredentialStoreQt::lookup(const net::AuthChallengeInfo &challenge, net::AuthCredentials *credentials) const
+{
+    QMutexLocker lock(&m_mutex);
+    auto it = m_entries.find(challenge.challenger);
+    if (it == m_entries.end())
+        return false;
+
+    const Entry *best = nullptr;
+    int bestScore = -1;
+    for (const Entry &entry : it->second) {
+        if ((!entry.realm.empty() && entry.realm != challenge.realm)
+                || (!entry.scheme.empty() && entry.scheme != challenge.scheme))
+            continue;
+        const int score = (entry.realm.empty() ? 0 : 2) + (entry.scheme.empty() ? 0 : 1);
+        if (score > bestScore) {
+            best = &entry;
+            bestScore = score;
+        }
+    }
+    if (!best)
+        return false;
+    *credentials = best->credentials;
+    return true;
+}
+
+bool HttpAuthCredentialStoreQt::isEmpty() const
+{
+    QMutexLocker lock(&m_mutex);
+    return m_entries.empty();
+}
+
+// Only Basic credentials for a known realm can be sent without a challenge,
+// the other schemes need data from the server's challenge first. As Basic
+// credentials are sent in the clear, this is only done when asked for.
+bool HttpAuthCredentialStoreQt::isPreemptive(const Entry &entry)
+{
+    return entry.preemptive && !entry.realm.empty()
+            && entry.scheme == net::HttpAuth::SchemeToString(net::HttpAuth::AUTH_SCHEME_BASIC);
+}
+
+std::vector<HttpAuthCredentialStoreQt::Entry> HttpAuthCredentialStoreQt::preemptiveEntries() const
+{
+    QMutexLocker lock(&m_mutex);
+    std::vector<Entry> result;
+    for (const auto &hostEntries : m_entries)
+        std::copy_if(hostEntries.second.begin(), hostEntries.second.end(), std::back_inserter(result), isPreemptive);
+    return result;
+}
+
+std::vector<HttpAuthCredentialStoreQt::Entry> HttpAuthCredentialStoreQt::remove(const url::Origin &origin)
+{
+    QMutexLocker lock(&m_mutex);
+    std::vector<Entry> removed;
+    auto it = m_entries.find(origin);
+    if (it != m_entries.end()) {
+        removed.swap(it->second);
+        m_entries.erase(it);
+    }
+    return removed;
+}
+
+std::vector<HttpAuthCredentialStoreQt::Entry> HttpAuthCredentialStoreQt::clear()
+{
+    QMutexLocker lock(&m_mutex);
+    std::vector<Entry> removed;
+    for (auto &hostEntries : m_entries)
+        std::move(hostEntries.second.begin(), hostEntries.second.end(), std::back_inserter(removed));
+    m_entries.clear();
+    return removed;
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,97 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef HTTP_AUTH_CREDENTIAL_STORE_QT_H
+#define HTTP_AUTH_CREDENTIAL_STORE_QT_H
+
+#include "base/memory/ref_counted.h"
+#include "net/base/auth.h"
+#include "url/origin.h"
+
+#include <QtCore/QMutex>
+
+#include <map>
+#include <string>
+#include <vector>
+
+namespace QtWebEngineCore {
+
+// HTTP authentication credentials of a profile, keyed by the origin of the server or proxy,
+// realm and scheme. Challenges are answered from here on the IO thread before asking the page.
+// An empty realm or scheme matches any realm or scheme of a challenge from the origin.
+// All functions are thread-safe.
+class HttpAuthCredentialStoreQt : public base::RefCountedThreadSafe<HttpAuthCredentialStoreQt> {
+public:
+    struct Entry {
+        url::Origin origin;
+        std::string realm;
+        std::string scheme;
+        net::AuthCredentials credentials;
+        bool preemptive;
+    };
+
+    HttpAuthCredentialStoreQt();
+
+    // |scheme| is a lower-case scheme name as used by net::AuthChallengeInfo, like "basic".
+    // |preemptive| asks for Basic credentials with a realm to be sent without a challenge.
+    bool add(const url::Origin &origin, const std::string &realm, const std::string &scheme,
+             const net::AuthCredentials &credentials, bool preemptive);
+    bool lookup(const net::AuthChallengeInfo &challenge, net::AuthCredentials *credentials) const;
+    bool isEmpty() const;
+    // Entries that can be put into the HTTP auth cache before they are challenged for.
+    std::vector<Entry> preemptiveEntries() const;
+    // The remove functions return the removed entries.
+    std::vector<Entry> remove(const url::Origin &origin);
+    std::vector<Entry> clear();
+
+    static bool isPreemptive(const Entry &entry);
+
+private:
+    friend class base::RefCountedThreadSafe<HttpAuthCredentialStoreQt>;
+    ~HttpAuthCredentialStoreQt();
+
+    std::map<url::Origin, std::vector<Entry>> m_entries;
+    mutable QMutex m_mutex;
+
+    DISALLOW_COPY_AND_ASSIGN(HttpAuthCredentialStoreQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // HTTP_AUTH_CREDENTIAL_STORE_QT_H
@@ -0,0 +1,498 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "http_cache_controller_qt.h"
+
+#include "api/qwebenginehttpcacheentry_p.h"
+#include "type_conversion.h"
+
+#include "base/bind.h"
+#include "base/pickle.h"
+#include "base/strings/string_util.h"
+#include "net/base/completion_callback.h"
+#include "net/base/io_buffer.h"
+#include "net/base/net_errors.h"
+#include "net/disk_cache/disk_cache.h"
+#include "net/http/http_cache.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_response_info.h"
+#include "net/http/http_transaction_factory.h"
+#include "net/http/http_util.h"
+#include "net/url_request/url_request_context.h"
+
+#include <vector>
+
+namespace QtWebEngineCore {
+
+// Stream indices used by net::HttpCache for the response info and the body.
+enum {
+    kResponseInfoIndex = 0,
+    kResponseContentIndex = 1
+};
+
+// Operations own themselves until they have finished. The completion callbacks given to
+// the backend only hold weak pointers to them, and own the out parameters the backend
+// writes into, so that a job can be finished while a call is still pending.
+class HttpCacheControllerQt::Job : public base::SupportsWeakPtr<Job> {
+public:
+    explicit Job(HttpCacheControllerQt *controller)
+        : m_controller(controller->m_weakPtrFactory.GetWeakPtr())
+    {
+    }
+
+    virtual ~Job()
+    {
+        if (m_controller)
+            m_controller->m_jobs.erase(this);
+    }
+
+    void start(net::HttpCache *cache)
+    {
+        if (!cache) {
+            finish(net::ERR_CACHE_MISS);
+            return;
+        }
+        disk_cache::Backend **backend = new disk_cache::Backend *(nullptr);
+        const net::CompletionCallback callback = base::Bind(&Job::backendReady, AsWeakPtr(), base::Owned(backend));
+        const int result = cache->GetBackend(backend, callback);
+        if (result != net::ERR_IO_PENDING)
+            callback.Run(result);
+    }
+
+    // The backend may be gone after this, so the job reports net::ERR_ABORTED right away.
+    void cancel() { finish(net::ERR_ABORTED); }
+
+protected:
+    // Runs the operation once the backend is available.
+    virtual void run() = 0;
+    // Reports |result| and deletes the job.
+    virtual void finish(int result) = 0;
+
+    // Returns a completion callback for a backend call opening or creating an entry, which
+    // calls |method| of |job| with the entry stored in |*entry|. An entry the backend opens
+    // after the job has finished is closed.
+    template <typename T>
+    static net::CompletionCallback entryCallback(T *job, void (T::*method)(disk_cache::Entry *, int),
+                                                 disk_cache::Entry ***entry)
+    {
+        *entry = new disk_cache::Entry *(nullptr);
+        return base::Bind(&Job::entryReady<T>, base::AsWeakPtr(job), method, base::Owned(*entry));
+    }
+
+    disk_cache::Backend *m_backend = nullptr;
+
+private:
+    void backendReady(disk_cache::Backend **backend, int result)
+    {
+        m_backend = *backend;
+        if (result != net::OK || !m_backend) {
+            finish(result != net::OK ? result : net::ERR_FAILED);
+            return;
+        }
+        run();
+    }
+
+    template <typename T>
+    static void entryReady(const base::WeakPtr<T> &job, void (T::*method)(disk_cache::Entry *, int),
+                           disk_cache::Entry **entry, int result)
+    {
+        if (!job) {
+            if (result == net::OK && *entry)
+                (*entry)->Close();
+            return;
+        }
+        (job.get()->*method)(result == net::OK ? *entry : nullptr, result);
+    }
+
+    base::WeakPtr<HttpCacheControllerQt> m_controller;
+};
+
+// Lists the entries of the cache or dooms a set of them.
+class HttpCacheControllerQt::EnumerationJob : public Job {
+public:
+    enum Mode {
+        ListEntries,
+        RemoveEntriesWithPrefix,
+        RemoveEntry
+    };
+
+    EnumerationJob(HttpCacheControllerQt *controller, const EntriesCallback &callback)
+        : Job(controller)
+        , m_mode(ListEntries)
+        , m_entriesCallback(callback)
+    {
+    }
+
+    // |argument| is the URL prefix or the key of the entry to remove.
+    EnumerationJob(HttpCacheControllerQt *controller, Mode mode, const std::string &argument,
+                   const ResultCallback &callback)
+        : Job(controller)
+        , m_mode(mode)
+        , m_resultCallback(callback)
+    {
+        if (mode == RemoveEntry)
+            m_keysToRemove.push_back(argument);
+        else
+            m_urlPrefix = argument;
+    }
+
+protected:
+    void run() override
+    {
+        if (m_mode == RemoveEntry) {
+            removeNextEntry();
+            return;
+        }
+        m_iterator = m_backend->CreateIterator();
+        openNextEntry();
+    }
+
+    void finish(int result) override
+    {
+        if (m_entry)
+            m_entry->Close();
+        m_iterator.reset();
+        if (m_mode == ListEntries)
+            m_entriesCallback.Run(result == net::OK ? m_entries : QVector<QWebEngineHttpCacheEntry>());
+        else
+            m_resultCallback.Run(result == net::OK ? m_removedEntries : result);
+        delete this;
+    }
+
+private:
+    void openNextEntry()
+    {
+        for (;;) {
+            disk_cache::Entry **entry;
+            const net::CompletionCallback callback = entryCallback(this, &EnumerationJob::entryOpened, &entry);
+            const int result = m_iterator->OpenNextEntry(entry, callback);
+            if (result == net::ERR_IO_PENDING || !readEntry(result == net::OK ? *entry : nullptr, result))
+                return;
+        }
+    }
+
+    void entryOpened(disk_cache::Entry *entry, int result)
+    {
+        if (readEntry(entry, result))
+            openNextEntry();
+    }
+
+    // Returns whether the enumeration continues.
+    bool readEntry(disk_cache::Entry *entry, int result)
+    {
+        m_entry = entry;
+        if (result != net::OK) {
+            // The iterator fails after the last entry.
+            m_iterator.reset();
+            if (m_mode == ListEntries)
+                finish(net::OK);
+            else
+                removeNextEntry();
+            return false;
+        }
+
+        const std::string key = m_entry->GetKey();
+        const GURL url = urlForKey(key);
+        if (m_mode == ListEntries) {
+            const qint64 size = qint64(m_entry->GetDataSize(kResponseInfoIndex))
+                              + m_entry->GetDataSize(kResponseContentIndex);
+            m_entries.append(makeEntry(url, size, m_entry->GetLastUsed()));
+        } else if (url.is_valid() && base::StartsWith(url.spec(), m_urlPrefix, base::CompareCase::SENSITIVE)) {
+            // Entries are doomed after the enumeration, dooming them now would invalidate the iterator.
+            m_keysToRemove.push_back(key);
+        }
+        m_entry->Close();
+        m_entry = nullptr;
+        return true;
+    }
+
+    void removeNextEntry()
+    {
+        while (!m_keysToRemove.empty()) {
+            const std::string key = m_keysToRemove.back();
+            m_keysToRemove.pop_back();
+            const int result = m_backend->DoomEntry(key, base::Bind(&EnumerationJob::entryRemoved,
+                                                                    base::AsWeakPtr(this)));
+            if (result == net::ERR_IO_PENDING)
+                return;
+            if (result == net::OK)
+                ++m_removedEntries;
+        }
+        finish(net::OK);
+    }
+
+    void entryRemoved(int result)
+    {
+        if (result == net::OK)
+            ++m_removedEntries;
+        removeNextEntry();
+    }
+
+    const Mode m_mode;
+    EntriesCallback m_entriesCallback;
+    ResultCallback m_resultCallback;
+    std::string m_urlPrefix;
+    std::unique_ptr<disk_cache::Backend::Iterator> m_iterator;
+    disk_cache::Entry *m_entry = nullptr;
+    QVector<QWebEngineHttpCacheEntry> m_entries;
+    std::vector<std::string> m_keysToRemove;
+    int m_removedEntries = 0;
+};
+
+// Stores a response the way net::HttpCache does: the serialized response info in the
+// first stream and the body in the second one.
+class HttpCacheControllerQt::InsertJob : public Job {
+public:
+    InsertJob(HttpCacheControllerQt *controller, const std::string &key, const std::string &rawHeaders,
+              const std::string &body, const ResultCallback &callback)
+        : Job(controller)
+        , m_key(key)
+        , m_body(new net::StringIOBuffer(body))
+        , m_callback(callback)
+    {
+        // Headers without a status line describe a successful response.
+        std::string headers = rawHeaders;
+        if (!base::StartsWith(headers, "HTTP/", base::CompareCase::INSENSITIVE_ASCII))
+            headers.insert(0, "HTTP/1.1 200 OK\r\n");
+        net::HttpResponseInfo responseInfo;
+        responseInfo.headers = new net::HttpResponseHeaders(
+                    net::HttpUtil::AssembleRawHeaders(headers.data(), headers.size()));
+        responseInfo.request_time = base::Time::Now();
+        responseInfo.response_time = responseInfo.request_time;
+        base::Pickle pickle;
+        responseInfo.Persist(&pickle, /* skip_transient_headers */ true, /* response_truncated */ false);
+        m_responseInfo = new net::StringIOBuffer(std::string(static_cast<const char *>(pickle.data()),
+                                                             pickle.size()));
+    }
+
+protected:
+    void run() override
+    {
+        // Replace an existing entry instead of mixing its streams with the new ones.
+        const int result = m_backend->DoomEntry(m_key, base::Bind(&InsertJob::oldEntryRemoved,
+                                                                  base::AsWeakPtr(this)));
+        if (result != net::ERR_IO_PENDING)
+            oldEntryRemoved(result);
+    }
+
+    void finish(int result) override
+    {
+        if (m_entry) {
+            // Partially written entries must not be served.
+            if (result != net::OK)
+                m_entry->Doom();
+            m_entry->Close();
+        }
+        m_callback.Run(result == net::OK ? 1 : result);
+        delete this;
+    }
+
+private:
+    void oldEntryRemoved(int)
+    {
+        disk_cache::Entry **entry;
+        const net::CompletionCallback callback = entryCallback(this, &InsertJob::entryCreated, &entry);
+        const int result = m_backend->CreateEntry(m_key, entry, callback);
+        if (result != net::ERR_IO_PENDING)
+            callback.Run(result);
+    }
+
+    void entryCreated(disk_cache::Entry *entry, int result)
+    {
+        m_entry = entry;
+        if (result != net::OK) {
+            finish(result);
+            return;
+        }
+        result = m_entry->WriteData(kResponseInfoIndex, 0, m_responseInfo.get(), m_responseInfo->size(),
+                                    base::Bind(&InsertJob::responseInfoWritten, base::AsWeakPtr(this)), true);
+        if (result != net::ERR_IO_PENDING)
+            responseInfoWritten(result);
+    }
+
+    void responseInfoWritten(int result)
+    {
+        if (result != m_responseInfo->size()) {
+            finish(result < 0 ? result : net::ERR_FAILED);
+            return;
+        }
+        result = m_entry->WriteData(kResponseContentIndex, 0, m_body.get(), m_body->size(),
+                                    base::Bind(&InsertJob::bodyWritten, base::AsWeakPtr(this)), true);
+        if (result != net::ERR_IO_PENDING)
+            bodyWritten(result);
+    }
+
+    void bodyWritten(int result)
+    {
+        if (result != m_body->size()) {
+            finish(result < 0 ? result : net::ERR_FAILED);
+            return;
+        }
+        finish(net::OK);
+    }
+
+    const std::string m_key;
+    scoped_refptr<net::StringIOBuffer> m_responseInfo;
+    scoped_refptr<net::StringIOBuffer> m_body;
+    ResultCallback m_callback;
+    disk_cache::Entry *m_entry = nullptr;
+};
+
+class HttpCacheControllerQt::StatisticsJob : public Job {
+public:
+    StatisticsJob(HttpCacheControllerQt *controller, const StatisticsCallback &callback)
+        : Job(controller)
+        , m_callback(callback)
+    {
+    }
+
+protected:
+    void run() override
+    {
+        m_entryCount = m_backend->GetEntryCount();
+        const int result = m_backend->CalculateSizeOfAllEntries(base::Bind(&StatisticsJob::finish,
+                                                                           base::AsWeakPtr(this)));
+        if (result != net::ERR_IO_PENDING)
+            finish(result);
+    }
+
+    void finish(int result) override
+    {
+        m_callback.Run(result >= 0 ? makeStatistics(m_entryCount, result) : QWebEngineHttpCacheStatistics());
+        delete this;
+    }
+
+private:
+    StatisticsCallback m_callback;
+    qint64 m_entryCount = 0;
+};
+
+HttpCacheControllerQt::HttpCacheControllerQt(net::URLRequestContext *context)
+    : m_context(context)
+    , m_weakPtrFactory(this)
+{
+}
+
+HttpCacheControllerQt::~HttpCacheControllerQt()
+{
+    cancelAll();
+}
+
+void HttpCacheControllerQt::listEntries(const EntriesCallback &callback)
+{
+    startJob(new EnumerationJob(this, callback));
+}
+
+void HttpCacheControllerQt::computeStatistics(const StatisticsCallback &callback)
+{
+    startJob(new StatisticsJob(this, callback));
+}
+
+void HttpCacheControllerQt::insertEntry(const GURL &url, const std::string &rawHeaders, const std::string &body,
+                                        const ResultCallback &callback)
+{
+    if (!url.is_valid() || !url.SchemeIsHTTPOrHTTPS()) {
+        callback.Run(net::ERR_INVALID_URL);
+        return;
+    }
+    // The cache key of a GET request is its URL without the fragment.
+    startJob(new InsertJob(this, url.GetWithoutRef().spec(), rawHeaders, body, callback));
+}
+
+void HttpCacheControllerQt::removeEntry(const GURL &url, const ResultCallback &callback)
+{
+    if (!url.is_valid()) {
+        callback.Run(net::ERR_INVALID_URL);
+        return;
+    }
+    startJob(new EnumerationJob(this, EnumerationJob::RemoveEntry, url.GetWithoutRef().spec(), callback));
+}
+
+void HttpCacheControllerQt::removeEntriesWithPrefix(const std::string &urlPrefix, const ResultCallback &callback)
+{
+    startJob(new EnumerationJob(this, EnumerationJob::RemoveEntriesWithPrefix, urlPrefix, callback));
+}
+
+void HttpCacheControllerQt::cancelAll()
+{
+    // Finished jobs remove themselves from m_jobs.
+    const std::set<Job *> jobs = m_jobs;
+    for (Job *job : jobs)
+        job->cancel();
+    Q_ASSERT(m_jobs.empty());
+}
+
+void HttpCacheControllerQt::startJob(Job *job)
+{
+    m_jobs.insert(job);
+    net::HttpTransactionFactory *transactionFactory = m_context->http_transaction_factory();
+    job->start(transactionFactory ? transactionFactory->GetCache() : nullptr);
+}
+
+// Keys of responses to requests with an upload body are prefixed with an upload identifier,
+// see net::HttpCache::GenerateCacheKey().
+GURL HttpCacheControllerQt::urlForKey(const std::string &key)
+{
+    size_t slash = key.find('/');
+    if (slash != std::string::npos && slash > 0
+            && key.find_first_not_of("0123456789") == slash)
+        return GURL(key.substr(slash + 1));
+    return GURL(key);
+}
+
+QWebEngineHttpCacheEntry HttpCacheControllerQt::makeEntry(const GURL &url, qint64 size, const base::Time &lastUsed)
+{
+    QWebEngineHttpCacheEntryPrivate *p = new QWebEngineHttpCacheEntryPrivate;
+    p->url = toQt(url);
+    p->size = size;
+    p->lastUsed = toQt(lastUsed);
+    return QWebEngineHttpCacheEntry(p);
+}
+
+QWebEngineHttpCacheStatistics HttpCacheControllerQt::makeStatistics(qint64 entryCount, qint64 totalSize)
+{
+    QWebEngineHttpCacheStatisticsPrivate *p = new QWebEngineHttpCacheStatisticsPrivate;
+    p->valid = true;
+    p->entryCount = entryCount;
+    p->totalSize = totalSize;
+    return QWebEngineHttpCacheStatistics(p);
+}
+
+} // namespace QtWebEngineCore
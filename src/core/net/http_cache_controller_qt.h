@@ -0,0 +1,108 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef HTTP_CACHE_CONTROLLER_QT_H
+#define HTTP_CACHE_CONTROLLER_QT_H
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "base/memory/weak_ptr.h"
+
+#include "api/qwebenginehttpcacheentry.h"
+
+#include <QtCore/QVector>
+
+#include <set>
+#include <string>
+
+class GURL;
+
+namespace net {
+class URLRequestContext;
+}
+
+namespace QtWebEngineCore {
+
+// Inspects and modifies the HTTP cache of a URL request context on the IO thread.
+// The callbacks are run on the IO thread when the operation has finished.
+class HttpCacheControllerQt {
+public:
+    typedef base::Callback<void(const QVector<QWebEngineHttpCacheEntry> &entries)> EntriesCallback;
+    typedef base::Callback<void(const QWebEngineHttpCacheStatistics &statistics)> StatisticsCallback;
+    // Receives the number of affected entries, or a negative net error code.
+    typedef base::Callback<void(int result)> ResultCallback;
+
+    explicit HttpCacheControllerQt(net::URLRequestContext *context);
+    ~HttpCacheControllerQt();
+
+    void listEntries(const EntriesCallback &callback);
+    void computeStatistics(const StatisticsCallback &callback);
+    void insertEntry(const GURL &url, const std::string &rawHeaders, const std::string &body,
+                     const ResultCallback &callback);
+    void removeEntry(const GURL &url, const ResultCallback &callback);
+    void removeEntriesWithPrefix(const std::string &urlPrefix, const ResultCallback &callback);
+
+    // Finishes the running operations with net::ERR_ABORTED, for example before
+    // the HTTP cache is replaced.
+    void cancelAll();
+
+    static GURL urlForKey(const std::string &key);
+
+private:
+    class Job;
+    class EnumerationJob;
+    class InsertJob;
+    class StatisticsJob;
+
+    static QWebEngineHttpCacheEntry makeEntry(const GURL &url, qint64 size, const base::Time &lastUsed);
+    static QWebEngineHttpCacheStatistics makeStatistics(qint64 entryCount, qint64 totalSize);
+
+    void startJob(Job *job);
+
+    net::URLRequestContext *m_context;
+    std::set<Job *> m_jobs;
+    base::WeakPtrFactory<HttpCacheControllerQt> m_weakPtrFactory;
+
+    DISALLOW_COPY_AND_ASSIGN(HttpCacheControllerQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // HTTP_CACHE_CONTROLLER_QT_H
@@ -47,11 +47,14 @@
 #include "ui/base/page_transition_types.h"
 #include "profile_io_data_qt.h"
 #include "net/base/load_flags.h"
+#include "net/http/http_request_headers.h"
 #include "net/url_request/url_request.h"
+#include "network_metrics_qt.h"
 #include "qwebengineurlrequestinfo.h"
 #include "qwebengineurlrequestinfo_p.h"
 #include "qwebengineurlrequestinterceptor.h"
 #include "type_conversion.h"
+#include "url_request_content_job_qt.h"
 #include "web_contents_adapter_client.h"
 #include "web_contents_view_qt.h"
 
@@ -200,6 +203,35 @@ private:
 
 const char URLRequestNotification::UserData::key[] = "QtWebEngineCore::URLRequestNotification";
 
+// Remembers which counters a URLRequest is accounted to, so the page lookup
+// only happens once per request.
+class URLRequestMetrics : public base::SupportsUserData::Data {
+public:
+    URLRequestMetrics(NetworkMetricsQt *profile, NetworkMetricsQt *page)
+        : m_profile(profile), m_page(page) {}
+
+    static const char key[];
+
+    static URLRequestMetrics *forRequest(const net::URLRequest *request)
+    {
+        return static_cast<URLRequestMetrics *>(request->GetUserData(key));
+    }
+
+    template <typename Function>
+    void apply(Function function)
+    {
+        function(m_profile.get());
+        if (m_page)
+            function(m_page.get());
+    }
+
+private:
+    scoped_refptr<NetworkMetricsQt> m_profile;
+    scoped_refptr<NetworkMetricsQt> m_page;
+};
+
+const char URLRequestMetrics::key[] = "QtWebEngineCore::URLRequestMetrics";
+
 } // namespace
 
 NetworkDelegateQt::NetworkDelegateQt(ProfileIODataQt *data)
@@ -212,6 +244,22 @@ int NetworkDelegateQt::OnBeforeURLRequest(net::URLRequest *request, const net::C
     Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
     Q_ASSERT(m_profileIOData);
 
+    if (!URLRequestMetrics::forRequest(request))
+        request->SetUserData(URLRequestMetrics::key,
+                             std::make_unique<URLRequestMetrics>(m_profileIOData->networkMetrics(),
+                                                                 m_profileIOData->frameMetricsForRequest(request)));
+
+    // Content set with setContent() was not requested from the network, do not report it
+    // to request interceptors or as a navigation request, just like the data: URLs it replaces.
+    // Any other request carrying the header, like a fetch() of the page, loses it here.
+    if (!ContentResourceRegistryQt::token(request).empty()) {
+        if (m_profileIOData->contentResourceRegistry()->canServe(request))
+            return net::OK;
+        net::HttpRequestHeaders headers = request->extra_request_headers();
+        headers.RemoveHeader(kContentResourceHeaderQt);
+        request->SetExtraRequestHeaders(headers);
+    }
+
     const content::ResourceRequestInfo *resourceInfo = content::ResourceRequestInfo::ForRequest(request);
 
     content::ResourceType resourceType = content::RESOURCE_TYPE_LAST_TYPE;
@@ -275,8 +323,15 @@ void NetworkDelegateQt::OnURLRequestDestroyed(net::URLRequest*)
 {
 }
 
-void NetworkDelegateQt::OnCompleted(net::URLRequest */*request*/, bool /*started*/, int /*net_error*/)
+void NetworkDelegateQt::OnCompleted(net::URLRequest *request, bool /*started*/, int net_error)
 {
+    URLRequestMetrics *metrics = URLRequestMetrics::forRequest(request);
+    if (!metrics)
+        return;
+    const content::ResourceRequestInfo *resourceInfo = content::ResourceRequestInfo::ForRequest(request);
+    const QWebEngineUrlRequestInfo::ResourceType resourceType =
+            resourceInfo ? toQt(resourceInfo->GetResourceType()) : QWebEngineUrlRequestInfo::ResourceTypeUnknown;
+    metrics->apply([=](NetworkMetricsQt *m) { m->addCompletedRequest(resourceType, net_error); });
 }
 
 bool NetworkDelegateQt::OnCanSetCookie(const net::URLRequest& request,
@@ -308,6 +363,12 @@ bool NetworkDelegateQt::canGetCookies(const GURL &first_party, const GURL &url)
     return m_profileIOData->m_cookieDelegate->canGetCookies(toQt(first_party), toQt(url));
 }
 
+bool NetworkDelegateQt::canAccessStorage(const GURL &first_party, const GURL &url) const
+{
+    Q_ASSERT(m_profileIOData);
+    return m_profileIOData->canAccessStorage(first_party, url);
+}
+
 int NetworkDelegateQt::OnBeforeStartTransaction(net::URLRequest *request, const net::CompletionCallback &callback, net::HttpRequestHeaders *headers)
 {
     return net::OK;
@@ -331,16 +392,23 @@ void NetworkDelegateQt::OnBeforeRedirect(net::URLRequest*, const GURL&)
 {
 }
 
-void NetworkDelegateQt::OnResponseStarted(net::URLRequest*, int)
+void NetworkDelegateQt::OnResponseStarted(net::URLRequest *request, int net_error)
 {
+    URLRequestMetrics *metrics = URLRequestMetrics::forRequest(request);
+    if (metrics && net_error == net::OK)
+        metrics->apply([=](NetworkMetricsQt *m) { m->addResponseStarted(request); });
 }
 
-void NetworkDelegateQt::OnNetworkBytesReceived(net::URLRequest*, int64_t)
+void NetworkDelegateQt::OnNetworkBytesReceived(net::URLRequest *request, int64_t bytes_received)
 {
+    if (URLRequestMetrics *metrics = URLRequestMetrics::forRequest(request))
+        metrics->apply([=](NetworkMetricsQt *m) { m->addBytesReceived(bytes_received); });
 }
 
-void NetworkDelegateQt::OnNetworkBytesSent(net::URLRequest*, int64_t)
+void NetworkDelegateQt::OnNetworkBytesSent(net::URLRequest *request, int64_t bytes_sent)
 {
+    if (URLRequestMetrics *metrics = URLRequestMetrics::forRequest(request))
+        metrics->apply([=](NetworkMetricsQt *m) { m->addBytesSent(bytes_sent); });
 }
 
 void NetworkDelegateQt::OnPACScriptError(int, const base::string16&)
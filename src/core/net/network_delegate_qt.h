@@ -88,6 +88,7 @@ public:
 
     bool canSetCookies(const GURL &first_party, const GURL &url, const std::string &cookie_line) const;
     bool canGetCookies(const GURL &first_party, const GURL &url) const;
+    bool canAccessStorage(const GURL &first_party, const GURL &url) const;
 };
 
 } // namespace QtWebEngineCore
@@ -0,0 +1,119 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "network_metrics_qt.h"
+
+#include "api/qwebenginenetworkmetrics_p.h"
+#include "net/base/load_timing_info.h"
+#include "net/base/net_errors.h"
+#include "net/url_request/url_request.h"
+
+namespace QtWebEngineCore {
+
+NetworkMetricsQt::NetworkMetricsQt()
+{
+    reset();
+}
+
+void NetworkMetricsQt::addBytesReceived(qint64 bytes)
+{
+    m_bytesReceived.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void NetworkMetricsQt::addBytesSent(qint64 bytes)
+{
+    m_bytesSent.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void NetworkMetricsQt::addResponseStarted(const net::URLRequest *request)
+{
+    if (request->was_cached())
+        m_cacheHits.fetch_add(1, std::memory_order_relaxed);
+
+    net::LoadTimingInfo timing;
+    request->GetLoadTimingInfo(&timing);
+    if (timing.request_start.is_null() || timing.receive_headers_end.is_null())
+        return;
+    const qint64 usecs = (timing.receive_headers_end - timing.request_start).InMicroseconds();
+    if (usecs < 0)
+        return;
+    m_timeToFirstByteTotal.fetch_add(usecs, std::memory_order_relaxed);
+    m_timeToFirstByteCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void NetworkMetricsQt::addCompletedRequest(QWebEngineUrlRequestInfo::ResourceType type, int netError)
+{
+    const int slot = type < QWebEngineUrlRequestInfo::ResourceTypeLast ? int(type) : int(QWebEngineUrlRequestInfo::ResourceTypeLast);
+    m_requests[slot].fetch_add(1, std::memory_order_relaxed);
+
+    if (netError == net::ERR_ABORTED)
+        m_cancelledRequests.fetch_add(1, std::memory_order_relaxed);
+    else if (netError != net::OK)
+        m_failedRequests.fetch_add(1, std::memory_order_relaxed);
+}
+
+QWebEngineNetworkMetrics NetworkMetricsQt::snapshot() const
+{
+    QWebEngineNetworkMetricsPrivate *d = new QWebEngineNetworkMetricsPrivate;
+    d->bytesReceived = m_bytesReceived.load(std::memory_order_relaxed);
+    d->bytesSent = m_bytesSent.load(std::memory_order_relaxed);
+    for (int i = 0; i < ResourceTypeSlots; ++i)
+        d->requests[i] = m_requests[i].load(std::memory_order_relaxed);
+    d->cacheHits = m_cacheHits.load(std::memory_order_relaxed);
+    d->failedRequests = m_failedRequests.load(std::memory_order_relaxed);
+    d->cancelledRequests = m_cancelledRequests.load(std::memory_order_relaxed);
+    d->timeToFirstByteTotal = m_timeToFirstByteTotal.load(std::memory_order_relaxed);
+    d->timeToFirstByteCount = m_timeToFirstByteCount.load(std::memory_order_relaxed);
+    return QWebEngineNetworkMetrics(d);
+}
+
+void NetworkMetricsQt::reset()
+{
+    m_bytesReceived.store(0, std::memory_order_relaxed);
+    m_bytesSent.store(0, std::memory_order_relaxed);
+    for (int i = 0; i < ResourceTypeSlots; ++i)
+        m_requests[i].store(0, std::memory_order_relaxed);
+    m_cacheHits.store(0, std::memory_order_relaxed);
+    m_failedRequests.store(0, std::memory_order_relaxed);
+    m_cancelledRequests.store(0, std::memory_order_relaxed);
+    m_timeToFirstByteTotal.store(0, std::memory_order_relaxed);
+    m_timeToFirstByteCount.store(0, std::memory_order_relaxed);
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,91 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef NETWORK_METRICS_QT_H
+#define NETWORK_METRICS_QT_H
+
+#include "base/memory/ref_counted.h"
+
+#include "api/qwebenginenetworkmetrics.h"
+#include "api/qwebengineurlrequestinfo.h"
+
+#include <atomic>
+
+namespace net {
+class URLRequest;
+}
+
+namespace QtWebEngineCore {
+
+// Traffic counters of a profile or a page. They are updated by NetworkDelegateQt on
+// the IO thread and read from the UI thread, so every counter is a relaxed atomic
+// and a snapshot is not guaranteed to be consistent across counters.
+class NetworkMetricsQt : public base::RefCountedThreadSafe<NetworkMetricsQt> {
+public:
+    NetworkMetricsQt();
+
+    void addBytesReceived(qint64 bytes);
+    void addBytesSent(qint64 bytes);
+    void addResponseStarted(const net::URLRequest *request);
+    void addCompletedRequest(QWebEngineUrlRequestInfo::ResourceType type, int netError);
+
+    QWebEngineNetworkMetrics snapshot() const;
+    void reset();
+
+private:
+    friend class base::RefCountedThreadSafe<NetworkMetricsQt>;
+    ~NetworkMetricsQt() {}
+
+    enum { ResourceTypeSlots = QWebEngineUrlRequestInfo::ResourceTypeLast + 1 };
+
+    std::atomic<qint64> m_bytesReceived;
+    std::atomic<qint64> m_bytesSent;
+    std::atomic<qint64> m_requests[ResourceTypeSlots];
+    std::atomic<qint64> m_cacheHits;
+    std::atomic<qint64> m_failedRequests;
+    std::atomic<qint64> m_cancelledRequests;
+    std::atomic<qint64> m_timeToFirstByteTotal; // in microseconds
+    std::atomic<qint64> m_timeToFirstByteCount;
+
+    DISALLOW_COPY_AND_ASSIGN(NetworkMetricsQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // NETWORK_METRICS_QT_H
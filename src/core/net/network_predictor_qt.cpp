@@ -0,0 +1,232 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "network_predictor_qt.h"
+
+#include "base/bind.h"
+#include "net/base/io_buffer.h"
+#include "net/base/load_flags.h"
+#include "net/base/net_errors.h"
+#include "net/base/network_delegate.h"
+#include "net/http/http_network_session.h"
+#include "net/http/http_request_info.h"
+#include "net/http/http_stream_factory.h"
+#include "net/http/http_transaction_factory.h"
+#include "net/proxy/proxy_info.h"
+#include "net/proxy/proxy_service.h"
+#include "net/traffic_annotation/network_traffic_annotation.h"
+#include "net/url_request/http_user_agent_settings.h"
+#include "net/url_request/url_request.h"
+#include "net/url_request/url_request_context.h"
+
+namespace QtWebEngineCore {
+
+static const int kPrefetchBufferSize = 32 * 1024;
+
+// Reads a resource to the end, so that the HTTP cache stores it, and drops the data.
+class NetworkPredictorQt::PrefetchJob : public net::URLRequest::Delegate {
+public:
+    PrefetchJob(NetworkPredictorQt *predictor, quint64 requestId, net::URLRequestContext *context,
+                const GURL &url, net::RequestPriority priority)
+        : m_predictor(predictor)
+        , m_requestId(requestId)
+        , m_buffer(new net::IOBuffer(kPrefetchBufferSize))
+    {
+        net::NetworkTrafficAnnotationTag trafficAnnotation =
+            net::DefineNetworkTrafficAnnotation(
+                "qtwebengine_profile_prefetch", R"(
+                semantics {
+                  sender: "QWebEngineProfile"
+                  description:
+                    "The application asked to load a resource into the HTTP cache "
+                    "before a page of the profile requests it."
+                  trigger: "QWebEngineProfile::prefetch() is called."
+                  data: "None, a plain GET request."
+                  destination: OTHER
+                }
+                policy {
+                  cookies_allowed: YES
+                  cookies_store: "user"
+                  setting:
+                    "It is only used when the application calls it."
+                })");
+        m_request = context->CreateRequest(url, priority, this, trafficAnnotation);
+        m_request->SetLoadFlags(net::LOAD_PREFETCH);
+        // Treat the request as a top level load of the URL, like the navigation it prepares for.
+        m_request->set_site_for_cookies(url);
+    }
+
+    void start() { m_request->Start(); }
+
+    void OnResponseStarted(net::URLRequest *, int netError) override
+    {
+        if (netError != net::OK) {
+            finish(false);
+            return;
+        }
+        readMore();
+    }
+
+    void OnReadCompleted(net::URLRequest *, int bytesRead) override
+    {
+        if (bytesRead > 0)
+            readMore();
+        else
+            finish(bytesRead == 0);
+    }
+
+private:
+    void readMore()
+    {
+        int bytesRead;
+        do {
+            bytesRead = m_request->Read(m_buffer.get(), kPrefetchBufferSize);
+        } while (bytesRead > 0);
+        if (bytesRead != net::ERR_IO_PENDING)
+            finish(bytesRead == 0);
+    }
+
+    void finish(bool success)
+    {
+        const int responseCode = m_request->GetResponseCode();
+        // Deletes this.
+        m_predictor->prefetchFinished(m_requestId, success && responseCode >= 200 && responseCode < 300);
+    }
+
+    NetworkPredictorQt *m_predictor;
+    const quint64 m_requestId;
+    scoped_refptr<net::IOBuffer> m_buffer;
+    std::unique_ptr<net::URLRequest> m_request;
+};
+
+NetworkPredictorQt::NetworkPredictorQt(net::URLRequestContext *context, const FinishedCallback &finishedCallback)
+    : m_context(context)
+    , m_finishedCallback(finishedCallback)
+{
+}
+
+NetworkPredictorQt::~NetworkPredictorQt()
+{
+}
+
+void NetworkPredictorQt::preconnect(const GURL &url, int numSockets)
+{
+    net::HttpTransactionFactory *transactionFactory = m_context->http_transaction_factory();
+    if (!url.is_valid() || numSockets <= 0 || !transactionFactory || !transactionFactory->GetSession())
+        return;
+
+    // Based on chrome/browser/net/preconnect.cc
+    net::HttpRequestInfo requestInfo;
+    requestInfo.url = url;
+    requestInfo.method = "GET";
+    if (m_context->http_user_agent_settings())
+        requestInfo.extra_headers.SetHeader(net::HttpRequestHeaders::kUserAgent,
+                                            m_context->http_user_agent_settings()->GetUserAgent());
+    // Sockets of origins not allowed to use cookies are only reused by requests in privacy mode.
+    net::NetworkDelegate *networkDelegate = m_context->network_delegate();
+    if (networkDelegate && networkDelegate->CanEnablePrivacyMode(url, url))
+        requestInfo.privacy_mode = net::PRIVACY_MODE_ENABLED;
+
+    // The stream factory resolves the proxy of the URL and connects to it instead.
+    transactionFactory->GetSession()->http_stream_factory()->PreconnectStreams(numSockets, requestInfo);
+}
+
+void NetworkPredictorQt::resolveHostName(quint64 requestId, const std::string &hostName)
+{
+    // Hosts reached through a proxy are resolved by the proxy.
+    net::ProxyInfo proxyInfo;
+    if (m_context->proxy_service()
+            && m_context->proxy_service()->TryResolveProxySynchronously(GURL("http://" + hostName + "/"), std::string(),
+                                                                        &proxyInfo, nullptr, net::NetLogWithSource())
+            && !proxyInfo.is_direct()) {
+        m_finishedCallback.Run(requestId, true);
+        return;
+    }
+
+    std::unique_ptr<HostResolution> resolution(new HostResolution);
+    net::HostResolver::RequestInfo requestInfo(net::HostPortPair(hostName, 80));
+    requestInfo.set_is_speculative(true);
+    const int result = m_context->host_resolver()->Resolve(
+                requestInfo, net::IDLE, &resolution->addresses,
+                base::Bind(&NetworkPredictorQt::hostNameResolved, base::Unretained(this), requestId),
+                &resolution->request, net::NetLogWithSource());
+    if (result == net::ERR_IO_PENDING) {
+        m_hostResolutions[requestId] = std::move(resolution);
+        return;
+    }
+    m_finishedCallback.Run(requestId, result == net::OK);
+}
+
+void NetworkPredictorQt::hostNameResolved(quint64 requestId, int result)
+{
+    m_hostResolutions.erase(requestId);
+    m_finishedCallback.Run(requestId, result == net::OK);
+}
+
+void NetworkPredictorQt::prefetch(quint64 requestId, const GURL &url, net::RequestPriority priority)
+{
+    if (!url.is_valid() || !url.SchemeIsHTTPOrHTTPS()) {
+        m_finishedCallback.Run(requestId, false);
+        return;
+    }
+    PrefetchJob *job = new PrefetchJob(this, requestId, m_context, url, priority);
+    m_prefetchJobs[requestId].reset(job);
+    job->start();
+}
+
+void NetworkPredictorQt::prefetchFinished(quint64 requestId, bool success)
+{
+    m_prefetchJobs.erase(requestId);
+    m_finishedCallback.Run(requestId, success);
+}
+
+void NetworkPredictorQt::cancelAll()
+{
+    std::map<quint64, std::unique_ptr<HostResolution>> hostResolutions;
+    std::map<quint64, std::unique_ptr<PrefetchJob>> prefetchJobs;
+    hostResolutions.swap(m_hostResolutions);
+    prefetchJobs.swap(m_prefetchJobs);
+    for (const auto &resolution : hostResolutions)
+        m_finishedCallback.Run(resolution.first, false);
+    for (const auto &job : prefetchJobs)
+        m_finishedCallback.Run(job.first, false);
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,101 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef NETWORK_PREDICTOR_QT_H
+#define NETWORK_PREDICTOR_QT_H
+
+#include "base/callback.h"
+#include "base/macros.h"
+#include "net/base/address_list.h"
+#include "net/base/request_priority.h"
+#include "net/dns/host_resolver.h"
+#include "url/gurl.h"
+
+#include <QtGlobal>
+
+#include <map>
+#include <memory>
+
+namespace net {
+class URLRequestContext;
+}
+
+namespace QtWebEngineCore {
+
+// Warms up the network stack of a profile ahead of navigations: opens sockets,
+// resolves host names and fetches resources into the HTTP cache. Lives on the IO
+// thread, owned by ProfileIODataQt. Requests go through the profile's URL request
+// context, so its proxy settings, network delegate and cookie policy apply.
+class NetworkPredictorQt {
+public:
+    // Reports the outcome of a request, called on the IO thread.
+    typedef base::Callback<void(quint64 requestId, bool success)> FinishedCallback;
+
+    NetworkPredictorQt(net::URLRequestContext *context, const FinishedCallback &finishedCallback);
+    ~NetworkPredictorQt();
+
+    void preconnect(const GURL &url, int numSockets);
+    void resolveHostName(quint64 requestId, const std::string &hostName);
+    void prefetch(quint64 requestId, const GURL &url, net::RequestPriority priority);
+
+    // Fails all pending requests, must be called before the request context changes.
+    void cancelAll();
+
+private:
+    class PrefetchJob;
+    struct HostResolution {
+        net::AddressList addresses;
+        std::unique_ptr<net::HostResolver::Request> request;
+    };
+
+    void hostNameResolved(quint64 requestId, int result);
+    void prefetchFinished(quint64 requestId, bool success);
+
+    net::URLRequestContext *m_context;
+    FinishedCallback m_finishedCallback;
+    std::map<quint64, std::unique_ptr<HostResolution>> m_hostResolutions;
+    std::map<quint64, std::unique_ptr<PrefetchJob>> m_prefetchJobs;
+
+    DISALLOW_COPY_AND_ASSIGN(NetworkPredictorQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // NETWORK_PREDICTOR_QT_H
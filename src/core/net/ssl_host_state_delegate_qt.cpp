@@ -37,71 +37,194 @@
 **
 ****************************************************************************/
 
+#include "base/bind.h"
 #include "base/callback.h"
+#include "base/files/file_util.h"
+#include "base/task_runner_util.h"
+#include "base/task_scheduler/post_task.h"
+#include "net/cert/x509_certificate.h"
 
 #include "ssl_host_state_delegate_qt.h"
 
+#include "certificate_exception_store_qt.h"
 #include "type_conversion.h"
 
+#include <QDir>
+
+#include <cstring>
+
 namespace QtWebEngineCore {
 
-// Mirrors implementation in aw_ssl_host_state_delegate.cc
+static const char kCertificateExceptionsFileName[] = "CertificateExceptions";
+// How long exceptions made in response to certificateError() are remembered when they are saved.
+static const int kUserDecisionLifetimeDays = 7;
 
-CertPolicy::CertPolicy()
+SSLHostStateDelegateQt::SSLHostStateDelegateQt(BrowserContextAdapter *contextAdapter)
+    : m_exceptionStore(new CertificateExceptionStoreQt)
+    , m_rememberUserDecisions(false)
+    , m_loadingExceptions(false)
+    , m_changedWhileLoading(false)
+    , m_weakPtrFactory(this)
 {
+    setPersistentStoragePath(contextAdapter->dataPath());
 }
 
-CertPolicy::~CertPolicy()
+SSLHostStateDelegateQt::~SSLHostStateDelegateQt()
 {
+    if (m_persistentWriter && m_persistentWriter->HasPendingWrite())
+        m_persistentWriter->DoScheduledWrite();
 }
 
-// For an allowance, we consider a given |cert| to be a match to a saved
-// allowed cert if the |error| is an exact match to or subset of the errors
-// in the saved CertStatus.
-bool CertPolicy::Check(const net::X509Certificate &cert, net::CertStatus error) const
+void SSLHostStateDelegateQt::setPersistentStoragePath(const QString &path)
 {
-    net::SHA256HashValue fingerprint = cert.CalculateChainFingerprint256();
-    auto allowed_iter = m_allowed.find(fingerprint);
-    if ((allowed_iter != m_allowed.end()) && (allowed_iter->second & error) && ((allowed_iter->second & error) == error))
-        return true;
-    return false;
+    const QString fileName = path.isEmpty() ? QString() : QDir(path).filePath(QLatin1String(kCertificateExceptionsFileName));
+    const base::FilePath filePath = toFilePath(fileName);
+    if (!m_persistentWriter && filePath.empty())
+        return;
+    if (m_persistentWriter) {
+        if (m_persistentWriter->path() == filePath)
+            return;
+        if (m_persistentWriter->HasPendingWrite())
+            m_persistentWriter->DoScheduledWrite();
+        m_persistentWriter.reset();
+    }
+
+    cancelLoadingExceptions();
+    m_exceptionStore->clear(base::Callback<bool(const std::string &)>());
+    if (filePath.empty())
+        return;
+
+    // Reads and writes share a sequence, so the file is read before it is first written.
+    m_fileTaskRunner = base::CreateSequencedTaskRunnerWithTraits({base::MayBlock(), base::TaskPriority::BACKGROUND,
+                                                                  base::TaskShutdownBehavior::BLOCK_SHUTDOWN});
+    m_persistentWriter.reset(new base::ImportantFileWriter(filePath, m_fileTaskRunner));
+    loadExceptions(fileName);
 }
 
-void CertPolicy::Allow(const net::X509Certificate& cert, net::CertStatus error)
+static std::string readExceptionsFile(const base::FilePath &filePath)
 {
-    net::SHA256HashValue fingerprint = cert.CalculateChainFingerprint256();
-    m_allowed[fingerprint] |= error;
+    std::string data;
+    base::ReadFileToString(filePath, &data);
+    return data;
 }
 
-SSLHostStateDelegateQt::SSLHostStateDelegateQt()
+void SSLHostStateDelegateQt::loadExceptions(const QString &filePath)
 {
+    m_loadingExceptions = true;
+    base::PostTaskAndReplyWithResult(m_fileTaskRunner.get(), FROM_HERE,
+                                     base::Bind(&readExceptionsFile, toFilePath(filePath)),
+                                     base::Bind(&SSLHostStateDelegateQt::exceptionsLoaded,
+                                                m_weakPtrFactory.GetWeakPtr(), filePath));
 }
 
-SSLHostStateDelegateQt::~SSLHostStateDelegateQt()
+// Certificates verified before the file has been read only see the exceptions made in this
+// session. The saved exceptions are merged with those, minus the ones removed meanwhile.
+void SSLHostStateDelegateQt::exceptionsLoaded(const QString &filePath, const std::string &data)
 {
+    const bool changed = m_changedWhileLoading;
+    const std::vector<base::Callback<bool(const std::string &)>> removals = std::move(m_removalsWhileLoading);
+    cancelLoadingExceptions();
+
+    if (!data.empty()) {
+        scoped_refptr<CertificateExceptionStoreQt> saved(new CertificateExceptionStoreQt);
+        if (!saved->importExceptions(QByteArray::fromStdString(data)))
+            qWarning("Ignoring invalid entries of the certificate exceptions file %s", qPrintable(filePath));
+        for (const auto &removal : removals)
+            saved->clear(removal);
+        m_exceptionStore->importExceptions(saved->exportExceptions());
+    }
+    if (changed)
+        schedulePersistentWrite();
 }
 
-void SSLHostStateDelegateQt::AllowCert(const std::string &host, const net::X509Certificate &cert, net::CertStatus error)
+void SSLHostStateDelegateQt::cancelLoadingExceptions()
 {
-    m_certPolicyforHost[host].Allow(cert, error);
+    m_weakPtrFactory.InvalidateWeakPtrs();
+    m_loadingExceptions = false;
+    m_changedWhileLoading = false;
+    m_removalsWhileLoading.clear();
 }
 
-// Clear all allow preferences.
-void SSLHostStateDelegateQt::Clear(const base::Callback<bool(const std::string&)>& host_filter)
+void SSLHostStateDelegateQt::schedulePersistentWrite()
 {
-    if (host_filter.is_null()) {
-        m_certPolicyforHost.clear();
+    // Writing before the file has been read would drop the exceptions saved in it.
+    if (m_loadingExceptions) {
+        m_changedWhileLoading = true;
         return;
     }
+    if (m_persistentWriter)
+        m_persistentWriter->ScheduleWrite(this);
+}
 
-    for (auto it = m_certPolicyforHost.begin(); it != m_certPolicyforHost.end();) {
-        auto next_it = std::next(it);
+bool SSLHostStateDelegateQt::SerializeData(std::string *data)
+{
+    *data = m_exceptionStore->exportExceptions().toStdString();
+    return true;
+}
 
-        if (host_filter.Run(it->first))
-            m_certPolicyforHost.erase(it);
+bool SSLHostStateDelegateQt::addCertificateException(const QString &host, bool publicKeyHash,
+                                                     const QByteArray &sha256, const QDateTime &expiry)
+{
+    net::SHA256HashValue hash;
+    if (host.isEmpty() || sha256.size() != int(sizeof(hash.data)))
+        return false;
+    memcpy(hash.data, sha256.constData(), sizeof(hash.data));
+    const base::Time expiryTime = expiry.isValid() ? base::Time::FromJavaTime(expiry.toMSecsSinceEpoch()) : base::Time();
+    if (!m_exceptionStore->addException(host.toLower().toStdString(),
+                                        publicKeyHash ? CertificateExceptionStoreQt::PublicKeyHash
+                                                      : CertificateExceptionStoreQt::CertificateHash,
+                                        hash, 0, expiryTime))
+        return false;
+    schedulePersistentWrite();
+    return true;
+}
 
-        it = next_it;
+void SSLHostStateDelegateQt::removeCertificateExceptions(const QString &host)
+{
+    RevokeUserAllowExceptions(host.toLower().toStdString());
+}
+
+void SSLHostStateDelegateQt::clearCertificateExceptions()
+{
+    Clear(base::Callback<bool(const std::string &)>());
+}
+
+QByteArray SSLHostStateDelegateQt::exportCertificateExceptions() const
+{
+    return m_exceptionStore->exportExceptions();
+}
+
+bool SSLHostStateDelegateQt::importCertificateExceptions(const QByteArray &data)
+{
+    bool changed = false;
+    const bool valid = m_exceptionStore->importExceptions(data, &changed);
+    if (changed)
+        schedulePersistentWrite();
+    return valid;
+}
+
+// Decisions made by accepting a certificate error last for the session, like the
+// decisions of a browser, unless the embedder asked for them to be remembered.
+void SSLHostStateDelegateQt::AllowCert(const std::string &host, const net::X509Certificate &cert, net::CertStatus error)
+{
+    if (!m_rememberUserDecisions) {
+        m_exceptionStore->allowCertificate(host, cert, error, base::Time(), false);
+        return;
     }
+    m_exceptionStore->allowCertificate(host, cert, error,
+                                       base::Time::Now() + base::TimeDelta::FromDays(kUserDecisionLifetimeDays), true);
+    schedulePersistentWrite();
+}
+
+// Clear all allow preferences.
+void SSLHostStateDelegateQt::Clear(const base::Callback<bool(const std::string&)>& host_filter)
+{
+    if (host_filter.is_null())
+        cancelLoadingExceptions();
+    else if (m_loadingExceptions)
+        m_removalsWhileLoading.push_back(host_filter);
+    m_exceptionStore->clear(host_filter);
+    schedulePersistentWrite();
 }
 
 // Queries whether |cert| is allowed for |host| and |error|. Returns true in
@@ -111,7 +234,12 @@ content::SSLHostStateDelegate::CertJudgment SSLHostStateDelegateQt::QueryPolicy(
                                                        const std::string &host, const net::X509Certificate &cert,
                                                        net::CertStatus error,bool *expired_previous_decision)
 {
-    return m_certPolicyforHost[host].Check(cert, error) ? SSLHostStateDelegate::ALLOWED : SSLHostStateDelegate::DENIED;
+    const CertificateExceptionStoreQt::QueryResult result = m_exceptionStore->query(host, cert, error);
+    if (expired_previous_decision)
+        *expired_previous_decision = result == CertificateExceptionStoreQt::Expired;
+    if (result == CertificateExceptionStoreQt::Expired)
+        schedulePersistentWrite();
+    return result == CertificateExceptionStoreQt::Allowed ? SSLHostStateDelegate::ALLOWED : SSLHostStateDelegate::DENIED;
 }
 
 // Records that a host has run insecure content.
@@ -125,11 +253,19 @@ bool SSLHostStateDelegateQt::DidHostRunInsecureContent(const std::string &host,
     return false;
 }
 
+static bool isHost(const std::string &host, const std::string &candidate)
+{
+    return candidate == host;
+}
+
 // Revokes all SSL certificate error allow exceptions made by the user for
 // |host|.
 void SSLHostStateDelegateQt::RevokeUserAllowExceptions(const std::string &host)
 {
-    m_certPolicyforHost.erase(host);
+    if (m_loadingExceptions)
+        m_removalsWhileLoading.push_back(base::Bind(&isHost, host));
+    m_exceptionStore->removeExceptions(host);
+    schedulePersistentWrite();
 }
 
 // Returns whether the user has allowed a certificate error exception for
@@ -138,9 +274,7 @@ void SSLHostStateDelegateQt::RevokeUserAllowExceptions(const std::string &host)
 // error combination exception is allowed, use QueryPolicy().
 bool SSLHostStateDelegateQt::HasAllowException(const std::string &host) const
 {
-    auto policy_iterator = m_certPolicyforHost.find(host);
-    return policy_iterator != m_certPolicyforHost.end() &&
-           policy_iterator->second.HasAllowException();
+    return m_exceptionStore->hasException(host);
 }
 
 
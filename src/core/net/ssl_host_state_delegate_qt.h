@@ -40,29 +40,43 @@
 #ifndef SSL_HOST_STATE_DELEGATE_QT_H
 #define SSL_HOST_STATE_DELEGATE_QT_H
 
+#include "base/files/important_file_writer.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequenced_task_runner.h"
 #include "content/public/browser/ssl_host_state_delegate.h"
 #include "browser_context_adapter.h"
 
-namespace QtWebEngineCore {
+#include <QtCore/QDateTime>
 
-class CertPolicy {
-public:
-    CertPolicy();
-    ~CertPolicy();
-    bool Check(const net::X509Certificate& cert, net::CertStatus error) const;
-    void Allow(const net::X509Certificate& cert, net::CertStatus error);
-    bool HasAllowException() const { return m_allowed.size() > 0; }
+#include <vector>
 
-private:
-    std::map<net::SHA256HashValue, net::CertStatus> m_allowed;
-};
+namespace QtWebEngineCore {
 
-class SSLHostStateDelegateQt : public content::SSLHostStateDelegate {
+class CertificateExceptionStoreQt;
+
+// Answers content's certificate error queries from the profile's certificate exceptions.
+// Exceptions of profiles with a data path are saved to the "CertificateExceptions" file in it.
+// The file is read on a background sequence, saved exceptions only apply once it has been read.
+class SSLHostStateDelegateQt : public content::SSLHostStateDelegate
+                             , public base::ImportantFileWriter::DataSerializer {
 
 public:
-    SSLHostStateDelegateQt();
+    SSLHostStateDelegateQt(BrowserContextAdapter *contextAdapter);
     ~SSLHostStateDelegateQt();
 
+    CertificateExceptionStoreQt *exceptionStore() const { return m_exceptionStore.get(); }
+    bool addCertificateException(const QString &host, bool publicKeyHash, const QByteArray &sha256, const QDateTime &expiry);
+    void removeCertificateExceptions(const QString &host);
+    void clearCertificateExceptions();
+    QByteArray exportCertificateExceptions() const;
+    bool importCertificateExceptions(const QByteArray &data);
+    void setPersistentStoragePath(const QString &path);
+    bool rememberUserDecisions() const { return m_rememberUserDecisions; }
+    void setRememberUserDecisions(bool remember) { m_rememberUserDecisions = remember; }
+
+    // base::ImportantFileWriter::DataSerializer implementation:
+    bool SerializeData(std::string *data) override;
+
     // content::SSLHostStateDelegate implementation:
     void AllowCert(const std::string &, const net::X509Certificate &cert, net::CertStatus error) override;
     void Clear(const base::Callback<bool(const std::string&)>& host_filter) override;
@@ -74,7 +88,21 @@ public:
     bool HasAllowException(const std::string &host) const override;
 
 private:
-    std::map<std::string, CertPolicy> m_certPolicyforHost;
+    void loadExceptions(const QString &filePath);
+    void exceptionsLoaded(const QString &filePath, const std::string &data);
+    void cancelLoadingExceptions();
+    void schedulePersistentWrite();
+
+    scoped_refptr<CertificateExceptionStoreQt> m_exceptionStore;
+    scoped_refptr<base::SequencedTaskRunner> m_fileTaskRunner;
+    std::unique_ptr<base::ImportantFileWriter> m_persistentWriter;
+    bool m_rememberUserDecisions;
+    bool m_loadingExceptions;
+    bool m_changedWhileLoading;
+    // Removals made while the file is being read, applied to the saved exceptions once it has been read.
+    std::vector<base::Callback<bool(const std::string &)>> m_removalsWhileLoading;
+
+    base::WeakPtrFactory<SSLHostStateDelegateQt> m_weakPtrFactory;
 };
 
 } // namespace QtWebEngineCore
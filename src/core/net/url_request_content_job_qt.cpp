@@ -0,0 +1,219 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#include "url_request_content_job_qt.h"
+
+#include "base/memory/ref_counted_memory.h"
+#include "base/unguessable_token.h"
+#include "content/public/browser/resource_request_info.h"
+#include "net/base/net_errors.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_util.h"
+#include "net/url_request/url_request.h"
+#include "net/url_request/url_request_simple_job.h"
+
+#include <QMutexLocker>
+
+namespace QtWebEngineCore {
+
+const char kContentResourceHeaderQt[] = "X-QtWebEngine-Content-Resource";
+
+namespace {
+
+// Shares the bytes of a QByteArray instead of copying them.
+class RefCountedQByteArray : public base::RefCountedMemory {
+public:
+    explicit RefCountedQByteArray(const QByteArray &data) : m_data(data) { }
+
+    const unsigned char *front() const override
+    {
+        return reinterpret_cast<const unsigned char *>(m_data.constData());
+    }
+    size_t size() const override { return m_data.size(); }
+
+private:
+    ~RefCountedQByteArray() override { }
+
+    const QByteArray m_data;
+};
+
+class URLRequestContentJobQt : public net::URLRequestSimpleJob {
+public:
+    URLRequestContentJobQt(net::URLRequest *request, net::NetworkDelegate *networkDelegate,
+                           const QByteArray &data, const std::string &mimeType, const std::string &charset)
+        : net::URLRequestSimpleJob(request, networkDelegate)
+        , m_data(data)
+        , m_mimeType(mimeType)
+        , m_charset(charset)
+    { }
+
+    int GetRefCountedData(std::string *mimeType, std::string *charset,
+                          scoped_refptr<base::RefCountedMemory> *data,
+                          const net::CompletionCallback &) const override
+    {
+        *mimeType = m_mimeType;
+        *charset = m_charset;
+        *data = new RefCountedQByteArray(m_data);
+        return net::OK;
+    }
+
+private:
+    ~URLRequestContentJobQt() override { }
+
+    const QByteArray m_data;
+    const std::string m_mimeType;
+    const std::string m_charset;
+};
+
+} // namespace
+
+ContentResourceRegistryQt::ContentResourceRegistryQt()
+{
+}
+
+ContentResourceRegistryQt::~ContentResourceRegistryQt()
+{
+}
+
+std::string ContentResourceRegistryQt::add(const QByteArray &data, const QString &mimeType, int frameTreeNodeId)
+{
+    Resource resource;
+    resource.data = data;
+    resource.frameTreeNodeId = frameTreeNodeId;
+    if (mimeType.isEmpty()) {
+        resource.mimeType = "text/plain";
+        resource.charset = "US-ASCII";
+    } else {
+        bool hadCharset = false;
+        net::HttpUtil::ParseContentType(mimeType.toStdString(), &resource.mimeType, &resource.charset,
+                                        &hadCharset, nullptr);
+    }
+
+    const std::string token = base::UnguessableToken::Create().ToString();
+    QMutexLocker lock(&m_mutex);
+    m_resources[token] = resource;
+    return token;
+}
+
+void ContentResourceRegistryQt::remove(const std::string &token)
+{
+    QMutexLocker lock(&m_mutex);
+    m_resources.erase(token);
+}
+
+void ContentResourceRegistryQt::reassign(int fromFrameTreeNodeId, int toFrameTreeNodeId)
+{
+    QMutexLocker lock(&m_mutex);
+    for (auto &it : m_resources) {
+        if (it.second.frameTreeNodeId == fromFrameTreeNodeId)
+            it.second.frameTreeNodeId = toFrameTreeNodeId;
+    }
+}
+
+// Pages can put any header on their own requests, so the token alone does not entitle
+// a request to a resource. Browser-initiated navigations have no initiator.
+const ContentResourceRegistryQt::Resource *ContentResourceRegistryQt::findLocked(const net::URLRequest *request) const
+{
+    const std::string requestToken = token(request);
+    if (requestToken.empty() || request->initiator().has_value())
+        return nullptr;
+    const content::ResourceRequestInfo *info = content::ResourceRequestInfo::ForRequest(request);
+    if (!info || info->GetResourceType() != content::RESOURCE_TYPE_MAIN_FRAME)
+        return nullptr;
+    auto it = m_resources.find(requestToken);
+    if (it == m_resources.end() || it->second.frameTreeNodeId != info->GetFrameTreeNodeId())
+        return nullptr;
+    return &it->second;
+}
+
+bool ContentResourceRegistryQt::canServe(const net::URLRequest *request) const
+{
+    QMutexLocker lock(&m_mutex);
+    return findLocked(request);
+}
+
+bool ContentResourceRegistryQt::find(const net::URLRequest *request, QByteArray *data, std::string *mimeType,
+                                     std::string *charset) const
+{
+    QMutexLocker lock(&m_mutex);
+    const Resource *resource = findLocked(request);
+    if (!resource)
+        return false;
+    *data = resource->data;
+    *mimeType = resource->mimeType;
+    *charset = resource->charset;
+    return true;
+}
+
+std::string ContentResourceRegistryQt::token(const net::URLRequest *request)
+{
+    std::string value;
+    request->extra_request_headers().GetHeader(kContentResourceHeaderQt, &value);
+    return value;
+}
+
+std::string ContentResourceRegistryQt::token(const std::string &extraHeaders)
+{
+    net::HttpRequestHeaders headers;
+    headers.AddHeadersFromString(extraHeaders);
+    std::string value;
+    headers.GetHeader(kContentResourceHeaderQt, &value);
+    return value;
+}
+
+ContentResourceInterceptorQt::ContentResourceInterceptorQt(scoped_refptr<ContentResourceRegistryQt> registry)
+    : m_registry(std::move(registry))
+{
+}
+
+// The network delegate has already removed the header from requests that may not use it.
+net::URLRequestJob *ContentResourceInterceptorQt::MaybeInterceptRequest(net::URLRequest *request,
+                                                                        net::NetworkDelegate *networkDelegate) const
+{
+    QByteArray data;
+    std::string mimeType;
+    std::string charset;
+    if (!m_registry->find(request, &data, &mimeType, &charset))
+        return nullptr;
+
+    return new URLRequestContentJobQt(request, networkDelegate, data, mimeType, charset);
+}
+
+} // namespace QtWebEngineCore
@@ -0,0 +1,120 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+
+#ifndef URL_REQUEST_CONTENT_JOB_QT_H_
+#define URL_REQUEST_CONTENT_JOB_QT_H_
+
+#include "base/memory/ref_counted.h"
+#include "net/url_request/url_request_interceptor.h"
+
+#include <QByteArray>
+#include <QMutex>
+#include <QString>
+
+#include <map>
+#include <string>
+
+namespace net {
+class URLRequest;
+}
+
+namespace QtWebEngineCore {
+
+// Name of the request header that carries the token of the in-memory resource
+// a navigation started by WebContentsAdapter::setContent() is served from.
+extern const char kContentResourceHeaderQt[];
+
+// Keeps the payloads passed to WebContentsAdapter::setContent() in one profile so that
+// they can be served from the IO thread without being encoded into a data: URL.
+// Resources are keyed by unguessable tokens and only served to browser-initiated
+// main frame navigations of the frame tree that added them. All functions are thread-safe.
+class ContentResourceRegistryQt : public base::RefCountedThreadSafe<ContentResourceRegistryQt> {
+public:
+    ContentResourceRegistryQt();
+
+    std::string add(const QByteArray &data, const QString &mimeType, int frameTreeNodeId);
+    void remove(const std::string &token);
+    // Moves the resources of a page to the main frame of its new WebContents.
+    void reassign(int fromFrameTreeNodeId, int toFrameTreeNodeId);
+
+    // Returns whether \a request may be served from a resource of this registry. Requests
+    // carrying a token they may not use are treated like any other request.
+    bool canServe(const net::URLRequest *request) const;
+    bool find(const net::URLRequest *request, QByteArray *data, std::string *mimeType, std::string *charset) const;
+
+    // Returns the token carried by \a request or by the extra headers of a navigation entry,
+    // or an empty string if there is none.
+    static std::string token(const net::URLRequest *request);
+    static std::string token(const std::string &extraHeaders);
+
+private:
+    friend class base::RefCountedThreadSafe<ContentResourceRegistryQt>;
+    ~ContentResourceRegistryQt();
+
+    struct Resource {
+        QByteArray data;
+        std::string mimeType;
+        std::string charset;
+        int frameTreeNodeId;
+    };
+
+    const Resource *findLocked(const net::URLRequest *request) const;
+
+    mutable QMutex m_mutex;
+    std::map<std::string, Resource> m_resources;
+
+    DISALLOW_COPY_AND_ASSIGN(ContentResourceRegistryQt);
+};
+
+// Serves navigation requests for resources in a ContentResourceRegistryQt.
+class ContentResourceInterceptorQt : public net::URLRequestInterceptor {
+public:
+    explicit ContentResourceInterceptorQt(scoped_refptr<ContentResourceRegistryQt> registry);
+
+    net::URLRequestJob *MaybeInterceptRequest(net::URLRequest *request,
+                                              net::NetworkDelegate *networkDelegate) const override;
+
+private:
+    scoped_refptr<ContentResourceRegistryQt> m_registry;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // URL_REQUEST_CONTENT_JOB_QT_H_
@@ -42,29 +42,166 @@
 #include "type_conversion.h"
 
 #include "base/pending_task.h"
+#include "base/strings/string_split.h"
+#include "base/strings/stringprintf.h"
 #include "base/threading/thread_task_runner_handle.h"
 #include "net/base/net_errors.h"
 #include "net/base/io_buffer.h"
+#include "net/http/http_request_headers.h"
+#include "net/http/http_response_headers.h"
+#include "net/http/http_response_info.h"
+#include "net/http/http_util.h"
 
-#include <QUrl>
+#include <QCache>
+#include <QCryptographicHash>
+#include <QDateTime>
 #include <QFileInfo>
+#include <QLocale>
 #include <QMimeDatabase>
 #include <QMimeType>
+#include <QMutex>
+#include <QResource>
+#include <QUrl>
 
 using namespace net;
 namespace QtWebEngineCore {
 
+namespace {
+
+// Resources can be cached for this long by the renderer before they have to be revalidated.
+const int kQrcMaxAgeSeconds = 3600;
+// Total size of the decompressed resources kept around, in KiB.
+const int kQrcCacheMaxCost = 32 * 1024;
+
+} // namespace
+
+struct QrcResource {
+    // Where the resource was registered, to notice when it has been unregistered or replaced.
+    const uchar *source = nullptr;
+    qint64 sourceSize = 0;
+    QDateTime sourceLastModified;
+    bool compressed = false;
+    // The decompressed data, or the registered data itself for uncompressed resources.
+    QByteArray data;
+    std::string mimeType;
+    std::string etag;
+    base::Time lastModified;
+    std::string lastModifiedHeader;
+};
+
+namespace {
+
+// Caches the MIME type and the validators of qrc resources, and the decompressed data of
+// compressed ones. Entries are checked against the registered resource on every lookup and
+// replaced when it has changed.
+class QrcResourceCache {
+public:
+    QrcResourceCache() : m_cache(kQrcCacheMaxCost) {}
+    bool find(const QString &path, QrcResource *resource);
+    bool read(const QString &path, const QrcResource &resource, qint64 offset, char *dest, int size);
+
+private:
+    QMutex m_mutex;
+    QCache<QString, QrcResource> m_cache;
+    QMimeDatabase m_mimeDatabase;
+};
+
+Q_GLOBAL_STATIC(QrcResourceCache, s_qrcResourceCache)
+
+bool QrcResourceCache::find(const QString &path, QrcResource *resource)
+{
+    QScopedPointer<QrcResource> entry(new QrcResource);
+    {
+        QMutexLocker lock(&m_mutex);
+        // Missing resources are not cached, they might still be registered later.
+        QResource qrc(path);
+        if (!qrc.isValid() || qrc.isDir()) {
+            m_cache.remove(path);
+            return false;
+        }
+
+        entry->source = qrc.data();
+        entry->sourceSize = qrc.size();
+        entry->sourceLastModified = qrc.lastModified();
+        entry->compressed = qrc.isCompressed();
+        if (QrcResource *cached = m_cache.object(path)) {
+            if (cached->source == entry->source && cached->sourceSize == entry->sourceSize
+                    && cached->sourceLastModified == entry->sourceLastModified) {
+                *resource = *cached;
+                return true;
+            }
+        }
+    }
+
+    // Decompressing and hashing a large resource must not hold up the other qrc requests.
+    if (entry->compressed) {
+        entry->data = qUncompress(entry->source, int(entry->sourceSize));
+        if (entry->data.isNull())
+            return false;
+    } else {
+        // Served straight from the registered resource, see read().
+        entry->data = QByteArray::fromRawData(reinterpret_cast<const char *>(entry->source), int(entry->sourceSize));
+    }
+    entry->mimeType = m_mimeDatabase.mimeTypeForFile(QFileInfo(path)).name().toStdString();
+
+    const QDateTime &lastModified = entry->sourceLastModified;
+    if (lastModified.isValid()) {
+        entry->lastModified = base::Time::FromJavaTime(lastModified.toMSecsSinceEpoch());
+        entry->lastModifiedHeader = QLocale::c().toString(lastModified.toUTC(), QStringLiteral("ddd, dd MMM yyyy hh:mm:ss 'GMT'")).toStdString();
+        entry->etag = base::StringPrintf("\"%llx-%x\"", static_cast<unsigned long long>(lastModified.toMSecsSinceEpoch()),
+                                         entry->data.size());
+    } else {
+        const QByteArray hash = QCryptographicHash::hash(entry->data, QCryptographicHash::Md5).toHex();
+        entry->etag = '"' + hash.toStdString() + '"';
+    }
+
+    // Only decompressed data takes up memory of its own.
+    const int cost = entry->compressed ? 1 + entry->data.size() / 1024 : 0;
+    *resource = *entry;
+    QMutexLocker lock(&m_mutex);
+    m_cache.insert(path, entry.take(), cost);
+    return true;
+}
+
+// Copies |size| bytes of the data of |resource| at |offset| to |dest|. Data served from the
+// registered resource is only read while the resource is still registered where it was found.
+bool QrcResourceCache::read(const QString &path, const QrcResource &resource, qint64 offset, char *dest, int size)
+{
+    if (resource.compressed) {
+        memcpy(dest, resource.data.constData() + offset, size);
+        return true;
+    }
+    QMutexLocker lock(&m_mutex);
+    QResource qrc(path);
+    if (!qrc.isValid() || qrc.data() != resource.source || qrc.size() != resource.sourceSize
+            || qrc.lastModified() != resource.sourceLastModified)
+        return false;
+    memcpy(dest, resource.data.constData() + offset, size);
+    return true;
+}
+
+bool etagMatches(const std::string &ifNoneMatch, const std::string &etag)
+{
+    for (const std::string &candidate : base::SplitString(ifNoneMatch, ",", base::TRIM_WHITESPACE, base::SPLIT_WANT_NONEMPTY)) {
+        if (candidate == "*" || candidate == etag || candidate == "W/" + etag)
+            return true;
+    }
+    return false;
+}
+
+} // namespace
+
 URLRequestQrcJobQt::URLRequestQrcJobQt(URLRequest *request, NetworkDelegate *networkDelegate)
     : URLRequestJob(request, networkDelegate)
+    , m_readOffset(0)
     , m_remainingBytes(0)
+    , m_multipleRanges(false)
     , m_weakFactory(this)
 {
 }
 
 URLRequestQrcJobQt::~URLRequestQrcJobQt()
 {
-    if (m_file.isOpen())
-        m_file.close();
 }
 
 void URLRequestQrcJobQt::Start()
@@ -74,13 +211,29 @@ void URLRequestQrcJobQt::Start()
 
 void URLRequestQrcJobQt::Kill()
 {
-    if (m_file.isOpen())
-        m_file.close();
     m_weakFactory.InvalidateWeakPtrs();
 
     URLRequestJob::Kill();
 }
 
+void URLRequestQrcJobQt::SetExtraRequestHeaders(const HttpRequestHeaders &headers)
+{
+    headers.GetHeader(HttpRequestHeaders::kIfNoneMatch, &m_ifNoneMatch);
+    headers.GetHeader(HttpRequestHeaders::kIfModifiedSince, &m_ifModifiedSince);
+
+    std::string rangeHeader;
+    if (headers.GetHeader(HttpRequestHeaders::kRange, &rangeHeader)) {
+        std::vector<HttpByteRange> ranges;
+        if (HttpUtil::ParseRangeHeader(rangeHeader, &ranges)) {
+            // Like the file job, only single ranges are served.
+            if (ranges.size() == 1)
+                m_byteRange = ranges[0];
+            else
+                m_multipleRanges = true;
+        }
+    }
+}
+
 bool URLRequestQrcJobQt::GetMimeType(std::string *mimeType) const
 {
     DCHECK(request_);
@@ -91,6 +244,11 @@ bool URLRequestQrcJobQt::GetMimeType(std::string *mimeType) const
     return false;
 }
 
+void URLRequestQrcJobQt::GetResponseInfo(HttpResponseInfo *info)
+{
+    info->headers = m_responseHeaders;
+}
+
 int URLRequestQrcJobQt::ReadRawData(IOBuffer *buf, int bufSize)
 {
     DCHECK_GE(m_remainingBytes, 0);
@@ -100,34 +258,72 @@ int URLRequestQrcJobQt::ReadRawData(IOBuffer *buf, int bufSize)
     }
     if (m_remainingBytes < bufSize)
         bufSize = static_cast<int>(m_remainingBytes);
-    qint64 rv = m_file.read(buf->data(), bufSize);
-    if (rv >= 0) {
-        m_remainingBytes -= rv;
-        DCHECK_GE(m_remainingBytes, 0);
-        return static_cast<int>(rv);
-    }
-    return static_cast<int>(rv);
+    if (!s_qrcResourceCache()->read(m_path, *m_resource, m_readOffset, buf->data(), bufSize))
+        return ERR_FAILED;
+    m_readOffset += bufSize;
+    m_remainingBytes -= bufSize;
+    return bufSize;
 }
 
 void URLRequestQrcJobQt::startGetHead()
 {
     // Get qrc file path.
-    QString qrcFilePath = ':' + toQt(request_->url()).path();
-    m_file.setFileName(qrcFilePath);
-    QFileInfo qrcFileInfo(m_file);
-    // Get qrc file mime type.
-    QMimeDatabase mimeDatabase;
-    QMimeType mimeType = mimeDatabase.mimeTypeForFile(qrcFileInfo);
-    m_mimeType = mimeType.name().toStdString();
-    // Open file
-    if (m_file.open(QIODevice::ReadOnly)) {
-        m_remainingBytes = m_file.size();
-        set_expected_content_size(m_remainingBytes);
-        // Notify that the headers are complete
-        NotifyHeadersComplete();
-    } else {
+    m_path = ':' + toQt(request_->url()).path();
+    m_resource.reset(new QrcResource);
+    if (!s_qrcResourceCache()->find(m_path, m_resource.get())) {
         NotifyStartError(URLRequestStatus(URLRequestStatus::FAILED, ERR_INVALID_URL));
+        return;
+    }
+    const QrcResource &resource = *m_resource;
+    m_mimeType = resource.mimeType;
+
+    bool notModified = false;
+    if (!m_ifNoneMatch.empty()) {
+        notModified = etagMatches(m_ifNoneMatch, resource.etag);
+    } else if (!m_ifModifiedSince.empty() && !resource.lastModified.is_null()) {
+        base::Time ifModifiedSince;
+        // HTTP dates have a resolution of seconds.
+        notModified = base::Time::FromString(m_ifModifiedSince.c_str(), &ifModifiedSince)
+                && resource.lastModified - ifModifiedSince < base::TimeDelta::FromSeconds(1);
+    }
+
+    const qint64 size = resource.data.size();
+    std::string statusLine = "HTTP/1.1 200 OK";
+    bool partial = false;
+    if (notModified) {
+        statusLine = "HTTP/1.1 304 Not Modified";
+        m_remainingBytes = 0;
+    } else if (m_byteRange.IsValid() && !m_multipleRanges) {
+        if (!m_byteRange.ComputeBounds(size)) {
+            NotifyStartError(URLRequestStatus(URLRequestStatus::FAILED, ERR_REQUEST_RANGE_NOT_SATISFIABLE));
+            return;
+        }
+        statusLine = "HTTP/1.1 206 Partial Content";
+        partial = true;
+        m_readOffset = m_byteRange.first_byte_position();
+        m_remainingBytes = m_byteRange.last_byte_position() - m_byteRange.first_byte_position() + 1;
+    } else {
+        m_remainingBytes = size;
     }
+
+    m_responseHeaders = new HttpResponseHeaders(HttpUtil::AssembleRawHeaders(statusLine.c_str(), statusLine.size()));
+    if (!m_mimeType.empty())
+        m_responseHeaders->AddHeader("Content-Type: " + m_mimeType);
+    m_responseHeaders->AddHeader(base::StringPrintf("Content-Length: %lld", static_cast<long long>(m_remainingBytes)));
+    if (partial)
+        m_responseHeaders->AddHeader(base::StringPrintf("Content-Range: bytes %lld-%lld/%lld",
+                                                        static_cast<long long>(m_readOffset),
+                                                        static_cast<long long>(m_readOffset + m_remainingBytes - 1),
+                                                        static_cast<long long>(size)));
+    m_responseHeaders->AddHeader("Accept-Ranges: bytes");
+    m_responseHeaders->AddHeader("ETag: " + resource.etag);
+    if (!resource.lastModifiedHeader.empty())
+        m_responseHeaders->AddHeader("Last-Modified: " + resource.lastModifiedHeader);
+    m_responseHeaders->AddHeader(base::StringPrintf("Cache-Control: max-age=%d", kQrcMaxAgeSeconds));
+
+    set_expected_content_size(m_remainingBytes);
+    // Notify that the headers are complete
+    NotifyHeadersComplete();
 }
 
 } // namespace QtWebEngineCore
@@ -40,32 +40,52 @@
 #ifndef URL_REQUEST_QRC_JOB_QT_H_
 #define URL_REQUEST_QRC_JOB_QT_H_
 
+#include "net/http/http_byte_range.h"
 #include "net/url_request/url_request.h"
 #include "net/url_request/url_request_job.h"
 
-#include <QFile>
+#include <QString>
+
+#include <memory>
+
+namespace net {
+class HttpResponseHeaders;
+}
 
 namespace QtWebEngineCore {
 
-// A request job that handles reading qrc file URLs
+struct QrcResource;
+
+// A request job that handles reading qrc file URLs.
+// Responses carry HTTP-like headers, so that byte ranges and conditional requests
+// using the ETag or the modification time of the resource can be answered.
 class URLRequestQrcJobQt : public net::URLRequestJob {
 
 public:
     URLRequestQrcJobQt(net::URLRequest *request, net::NetworkDelegate *networkDelegate);
     void Start() override;
     void Kill() override;
-    int ReadRawData(net::IOBuffer* buf, int buf_size)  override;;
+    void SetExtraRequestHeaders(const net::HttpRequestHeaders &headers) override;
+    int ReadRawData(net::IOBuffer* buf, int buf_size) override;
     bool GetMimeType(std::string *mimeType) const override;
+    void GetResponseInfo(net::HttpResponseInfo *info) override;
 
 protected:
     virtual ~URLRequestQrcJobQt();
-    // Get file mime type and try open file on a background thread.
+    // Look up the resource and build the response headers.
     void startGetHead();
 
 private:
+    QString m_path;
+    std::unique_ptr<QrcResource> m_resource;
+    qint64 m_readOffset;
     qint64 m_remainingBytes;
-    QFile m_file;
     std::string m_mimeType;
+    std::string m_ifNoneMatch;
+    std::string m_ifModifiedSince;
+    net::HttpByteRange m_byteRange;
+    bool m_multipleRanges;
+    scoped_refptr<net::HttpResponseHeaders> m_responseHeaders;
     base::WeakPtrFactory<URLRequestQrcJobQt> m_weakFactory;
 
     DISALLOW_COPY_AND_ASSIGN(URLRequestQrcJobQt);
@@ -0,0 +1,107 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "origin_pattern.h"
+
+namespace QtWebEngineCore {
+
+bool OriginPattern::matches(const QUrl &origin) const
+{
+    if (!scheme.isEmpty() && origin.scheme() != scheme)
+        return false;
+    if (port == -1 ? origin.port() != -1 : (port && origin.port() != port))
+        return false;
+    if (host.isEmpty())
+        return true;
+    const QString originHost = origin.host();
+    if (originHost == host)
+        return true;
+    return includeSubdomains && originHost.endsWith(host)
+            && originHost.at(originHost.length() - host.length() - 1) == QLatin1Char('.');
+}
+
+bool OriginPattern::parse(const QString &text, OriginPattern *pattern)
+{
+    const int schemeEnd = text.indexOf(QLatin1String("://"));
+    if (schemeEnd <= 0)
+        return false;
+    QString scheme = text.left(schemeEnd).toLower();
+    QString hostAndPort = text.mid(schemeEnd + 3);
+    if (hostAndPort.endsWith(QLatin1Char('/')))
+        hostAndPort.chop(1);
+    if (hostAndPort.isEmpty() || hostAndPort.contains(QLatin1Char('/')))
+        return false;
+
+    int port = -1;
+    const int portStart = hostAndPort.lastIndexOf(QLatin1Char(':'));
+    if (portStart != -1 && !hostAndPort.endsWith(QLatin1Char(']'))) {
+        const QString portText = hostAndPort.mid(portStart + 1);
+        hostAndPort.truncate(portStart);
+        if (portText == QLatin1String("*")) {
+            port = 0;
+        } else {
+            bool ok = false;
+            port = portText.toInt(&ok);
+            if (!ok || port <= 0 || port > 65535)
+                return false;
+        }
+    }
+
+    QString host = hostAndPort.toLower();
+    bool includeSubdomains = false;
+    if (host == QLatin1String("*")) {
+        host.clear();
+    } else if (host.startsWith(QLatin1String("*."))) {
+        host.remove(0, 2);
+        includeSubdomains = true;
+    }
+    if (host.contains(QLatin1Char('*')) || (scheme.contains(QLatin1Char('*')) && scheme != QLatin1String("*")))
+        return false;
+    if (scheme == QLatin1String("*"))
+        scheme.clear();
+
+    pattern->pattern = text;
+    pattern->scheme = scheme;
+    pattern->host = host;
+    pattern->includeSubdomains = includeSubdomains;
+    pattern->port = port;
+    return true;
+}
+
+} // namespace QtWebEngineCore
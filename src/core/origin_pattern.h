@@ -0,0 +1,64 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef ORIGIN_PATTERN_H
+#define ORIGIN_PATTERN_H
+
+#include <QString>
+#include <QUrl>
+
+namespace QtWebEngineCore {
+
+// Matches security origins against patterns of the form "scheme://host:port", where the
+// scheme, the host and the port can be "*", and the host can start with "*." to include
+// all of its subdomains, like "https://*.example.com" or "*://intranet:*".
+struct OriginPattern {
+    QString pattern;
+    QString scheme; // empty matches any scheme
+    QString host; // empty matches any host
+    bool includeSubdomains = false;
+    int port = -1; // -1 matches the default port of the scheme, 0 any port
+
+    static bool parse(const QString &text, OriginPattern *pattern);
+    bool matches(const QUrl &origin) const;
+};
+
+} // namespace QtWebEngineCore
+
+#endif // ORIGIN_PATTERN_H
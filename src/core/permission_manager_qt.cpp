@@ -39,6 +39,10 @@
 
 #include "permission_manager_qt.h"
 
+#include "base/bind.h"
+#include "base/files/file_util.h"
+#include "base/task_runner_util.h"
+#include "base/task_scheduler/post_task.h"
 #include "content/browser/renderer_host/render_view_host_delegate.h"
 #include "content/public/browser/permission_type.h"
 #include "content/public/browser/render_frame_host.h"
@@ -48,8 +52,65 @@
 #include "type_conversion.h"
 #include "web_contents_delegate_qt.h"
 
+#include <QDir>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSet>
+
+#include <algorithm>
+
 namespace QtWebEngineCore {
 
+static const char kPermissionsFileName[] = "Permissions";
+static const int kPermissionsFormatVersion = 1;
+
+static const struct {
+    BrowserContextAdapter::PermissionType type;
+    const char *name;
+} kPermissionNames[] = {
+    { BrowserContextAdapter::GeolocationPermission, "geolocation" },
+    { BrowserContextAdapter::AudioCapturePermission, "audioCapture" },
+    { BrowserContextAdapter::VideoCapturePermission, "videoCapture" },
+};
+
+static QString permissionName(BrowserContextAdapter::PermissionType type)
+{
+    for (const auto &entry : kPermissionNames) {
+        if (entry.type == type)
+            return QLatin1String(entry.name);
+    }
+    return QString();
+}
+
+static BrowserContextAdapter::PermissionType permissionFromName(const QString &name)
+{
+    for (const auto &entry : kPermissionNames) {
+        if (name == QLatin1String(entry.name))
+            return entry.type;
+    }
+    return BrowserContextAdapter::UnsupportedPermission;
+}
+
+// Keys of exact decisions are serialized origins, as they are handed to us by Chromium.
+static QUrl normalizedOrigin(const QUrl &origin)
+{
+    return toQt(toGurl(origin).GetOrigin());
+}
+
+static blink::mojom::PermissionStatus toBlink(BrowserContextAdapter::PermissionState state)
+{
+    switch (state) {
+    case BrowserContextAdapter::GrantedPermission:
+        return blink::mojom::PermissionStatus::GRANTED;
+    case BrowserContextAdapter::DeniedPermission:
+        return blink::mojom::PermissionStatus::DENIED;
+    case BrowserContextAdapter::AskPermission:
+        break;
+    }
+    return blink::mojom::PermissionStatus::ASK;
+}
+
 BrowserContextAdapter::PermissionType toQt(content::PermissionType type)
 {
     switch (type) {
@@ -76,20 +137,274 @@ BrowserContextAdapter::PermissionType toQt(content::PermissionType type)
     return BrowserContextAdapter::UnsupportedPermission;
 }
 
-PermissionManagerQt::PermissionManagerQt()
-    : m_requestIdCount(0)
+PermissionManagerQt::PermissionManagerQt(BrowserContextAdapter *contextAdapter)
+    : m_loadingPermissions(false)
+    , m_requestIdCount(0)
     , m_subscriberIdCount(0)
+    , m_weakPtrFactory(this)
 {
+    setPersistentStoragePath(contextAdapter->dataPath());
 }
 
 PermissionManagerQt::~PermissionManagerQt()
 {
+    if (m_persistentWriter && m_persistentWriter->HasPendingWrite())
+        m_persistentWriter->DoScheduledWrite();
+}
+
+void PermissionManagerQt::setPersistentStoragePath(const QString &path)
+{
+    const QString fileName = path.isEmpty() ? QString() : QDir(path).filePath(QLatin1String(kPermissionsFileName));
+    const base::FilePath filePath = toFilePath(fileName);
+    if (!m_persistentWriter && filePath.empty())
+        return;
+    if (m_persistentWriter) {
+        if (m_persistentWriter->path() == filePath)
+            return;
+        if (m_persistentWriter->HasPendingWrite())
+            m_persistentWriter->DoScheduledWrite();
+        m_persistentWriter.reset();
+    }
+
+    // Like other persistent data of the profile, decisions do not follow it to a new location.
+    m_weakPtrFactory.InvalidateWeakPtrs();
+    m_loadingPermissions = false;
+    m_changesWhileLoading.clear();
+    m_permissions.clear();
+    m_patternRules.clear();
+    if (filePath.empty())
+        return;
+
+    // Reads and writes share a sequence, so the file is read before it is first written.
+    m_fileTaskRunner = base::CreateSequencedTaskRunnerWithTraits({base::MayBlock(), base::TaskPriority::BACKGROUND,
+                                                                  base::TaskShutdownBehavior::BLOCK_SHUTDOWN});
+    m_persistentWriter.reset(new base::ImportantFileWriter(filePath, m_fileTaskRunner));
+    loadPermissions(fileName);
+}
+
+static std::string readPermissionsFile(const base::FilePath &filePath)
+{
+    std::string data;
+    base::ReadFileToString(filePath, &data);
+    return data;
+}
+
+void PermissionManagerQt::loadPermissions(const QString &filePath)
+{
+    m_loadingPermissions = true;
+    base::PostTaskAndReplyWithResult(m_fileTaskRunner.get(), FROM_HERE,
+                                     base::Bind(&readPermissionsFile, toFilePath(filePath)),
+                                     base::Bind(&PermissionManagerQt::permissionsLoaded,
+                                                m_weakPtrFactory.GetWeakPtr(), filePath));
+}
+
+// Until the file has been read, checks are answered from the decisions made in this
+// session only. Requests that the saved decisions answer are answered once it is read.
+void PermissionManagerQt::permissionsLoaded(const QString &filePath, const std::string &data)
+{
+    const SubscriberStates previousStates = subscriberStates();
+    m_loadingPermissions = false;
+    const QVector<PendingChange> changes = m_changesWhileLoading;
+    m_changesWhileLoading.clear();
+    m_permissions.clear();
+    m_patternRules.clear();
+
+    QSet<PermissionType> changedTypes;
+    if (!data.empty() && !readPermissions(QByteArray::fromStdString(data), &changedTypes))
+        qWarning("Ignoring invalid entries of the permissions file %s", qPrintable(filePath));
+    for (const PendingChange &change : changes)
+        setPermissionInternal(change.originPattern, change.type, change.state);
+    if (!changes.isEmpty())
+        schedulePersistentWrite();
+
+    notifySubscribers(previousStates);
+    answerPendingRequests();
+}
+
+void PermissionManagerQt::schedulePersistentWrite()
+{
+    // Writing before the file has been read would drop the decisions saved in it.
+    if (m_persistentWriter && !m_loadingPermissions)
+        m_persistentWriter->ScheduleWrite(this);
+}
+
+bool PermissionManagerQt::SerializeData(std::string *data)
+{
+    *data = exportPermissions().toStdString();
+    return true;
+}
+
+QByteArray PermissionManagerQt::exportPermissions() const
+{
+    QJsonArray permissions;
+    for (auto it = m_permissions.constBegin(); it != m_permissions.constEnd(); ++it) {
+        QJsonObject entry;
+        entry.insert(QStringLiteral("origin"), it.key().first.toString(QUrl::StripTrailingSlash));
+        entry.insert(QStringLiteral("permission"), permissionName(it.key().second));
+        entry.insert(QStringLiteral("granted"), it.value());
+        permissions.append(entry);
+    }
+    for (const PatternRule &rule : m_patternRules) {
+        QJsonObject entry;
+        entry.insert(QStringLiteral("origin"), rule.pattern.pattern);
+        entry.insert(QStringLiteral("permission"), permissionName(rule.type));
+        entry.insert(QStringLiteral("granted"), rule.granted);
+        permissions.append(entry);
+    }
+    QJsonObject root;
+    root.insert(QStringLiteral("version"), kPermissionsFormatVersion);
+    root.insert(QStringLiteral("permissions"), permissions);
+    return QJsonDocument(root).toJson(QJsonDocument::Compact);
+}
+
+bool PermissionManagerQt::importPermissions(const QByteArray &data)
+{
+    const SubscriberStates previousStates = subscriberStates();
+    QSet<PermissionType> changedTypes;
+    const bool valid = readPermissions(data, &changedTypes);
+    if (!changedTypes.isEmpty()) {
+        notifySubscribers(previousStates);
+        schedulePersistentWrite();
+    }
+    return valid;
+}
+
+bool PermissionManagerQt::readPermissions(const QByteArray &data, QSet<PermissionType> *changedTypes)
+{
+    QJsonParseError error;
+    const QJsonDocument document = QJsonDocument::fromJson(data, &error);
+    if (error.error != QJsonParseError::NoError || !document.isObject())
+        return false;
+    const QJsonObject root = document.object();
+    if (root.value(QStringLiteral("version")).toInt() != kPermissionsFormatVersion)
+        return false;
+
+    bool valid = true;
+    const QJsonArray permissions = root.value(QStringLiteral("permissions")).toArray();
+    for (const QJsonValue &value : permissions) {
+        const QJsonObject entry = value.toObject();
+        const PermissionType type = permissionFromName(entry.value(QStringLiteral("permission")).toString());
+        const QJsonValue granted = entry.value(QStringLiteral("granted"));
+        if (type == BrowserContextAdapter::UnsupportedPermission || !granted.isBool()
+                || !setPermissionInternal(entry.value(QStringLiteral("origin")).toString(), type,
+                                          granted.toBool() ? BrowserContextAdapter::GrantedPermission
+                                                           : BrowserContextAdapter::DeniedPermission)) {
+            valid = false;
+            continue;
+        }
+        changedTypes->insert(type);
+    }
+    return valid;
+}
+
+BrowserContextAdapter::PermissionState PermissionManagerQt::permissionState(const QUrl &origin, PermissionType type) const
+{
+    const QPair<QUrl, PermissionType> key(origin, type);
+    for (const auto *permissions : { &m_permissions, &m_sessionPermissions }) {
+        auto it = permissions->constFind(key);
+        if (it != permissions->constEnd())
+            return *it ? BrowserContextAdapter::GrantedPermission : BrowserContextAdapter::DeniedPermission;
+    }
+    for (const PatternRule &rule : m_patternRules) {
+        if (rule.type == type && rule.pattern.matches(origin))
+            return rule.granted ? BrowserContextAdapter::GrantedPermission : BrowserContextAdapter::DeniedPermission;
+    }
+    return BrowserContextAdapter::AskPermission;
+}
+
+bool PermissionManagerQt::setPermissionInternal(const QString &originPattern, PermissionType type, PermissionState state)
+{
+    if (!originPattern.contains(QLatin1Char('*'))) {
+        const QUrl origin = normalizedOrigin(QUrl(originPattern));
+        if (!origin.isValid() || origin.isEmpty())
+            return false;
+        if (m_loadingPermissions)
+            m_changesWhileLoading.append({ originPattern, type, state });
+        const QPair<QUrl, PermissionType> key(origin, type);
+        m_sessionPermissions.remove(key);
+        if (state == BrowserContextAdapter::AskPermission)
+            m_permissions.remove(key);
+        else
+            m_permissions[key] = state == BrowserContextAdapter::GrantedPermission;
+        return true;
+    }
+
+    OriginPattern pattern;
+    if (!OriginPattern::parse(originPattern, &pattern))
+        return false;
+    if (m_loadingPermissions)
+        m_changesWhileLoading.append({ originPattern, type, state });
+    auto it = std::find_if(m_patternRules.begin(), m_patternRules.end(), [&](const PatternRule &rule) {
+        return rule.type == type && rule.pattern.pattern == originPattern;
+    });
+    if (state == BrowserContextAdapter::AskPermission) {
+        if (it != m_patternRules.end())
+            m_patternRules.erase(it);
+    } else if (it != m_patternRules.end()) {
+        it->granted = state == BrowserContextAdapter::GrantedPermission;
+    } else {
+        m_patternRules.append({ pattern, type, state == BrowserContextAdapter::GrantedPermission });
+    }
+    return true;
+}
+
+bool PermissionManagerQt::setPermission(const QString &originPattern, PermissionType type, PermissionState state)
+{
+    const SubscriberStates previousStates = subscriberStates();
+    if (!setPermissionInternal(originPattern, type, state))
+        return false;
+    notifySubscribers(previousStates);
+    schedulePersistentWrite();
+    return true;
+}
+
+void PermissionManagerQt::clearPermissions()
+{
+    const SubscriberStates previousStates = subscriberStates();
+    // The saved decisions are cleared as well, there is no need to read them anymore.
+    m_weakPtrFactory.InvalidateWeakPtrs();
+    m_loadingPermissions = false;
+    m_changesWhileLoading.clear();
+    m_permissions.clear();
+    m_sessionPermissions.clear();
+    m_patternRules.clear();
+    notifySubscribers(previousStates);
+    schedulePersistentWrite();
+}
+
+PermissionManagerQt::SubscriberStates PermissionManagerQt::subscriberStates() const
+{
+    SubscriberStates states;
+    states.reserve(m_subscribers.size());
+    for (auto it = m_subscribers.constBegin(); it != m_subscribers.constEnd(); ++it)
+        states.insert(it.key(), permissionState(it->origin, it->type));
+    return states;
+}
+
+// Only tells the subscribers whose effective state differs from the one in previousStates,
+// as most changes only affect a few origins.
+void PermissionManagerQt::notifySubscribers(const SubscriberStates &previousStates)
+{
+    for (auto previous = previousStates.constBegin(); previous != previousStates.constEnd(); ++previous) {
+        // Callbacks may unsubscribe any subscriber.
+        auto it = m_subscribers.constFind(previous.key());
+        if (it == m_subscribers.constEnd())
+            continue;
+        const PermissionState state = permissionState(it->origin, it->type);
+        if (state == previous.value())
+            continue;
+        const base::Callback<void(blink::mojom::PermissionStatus)> callback = it->callback;
+        callback.Run(toBlink(state));
+    }
 }
 
 void PermissionManagerQt::permissionRequestReply(const QUrl &origin, BrowserContextAdapter::PermissionType type, bool reply)
 {
+    // Replies are not saved with the decisions of the profile, embedders that want them to
+    // persist can pass them on to setPermission().
+    const SubscriberStates previousStates = subscriberStates();
     QPair<QUrl, BrowserContextAdapter::PermissionType> key(origin, type);
-    m_permissions[key] = reply;
+    m_sessionPermissions[key] = reply;
     blink::mojom::PermissionStatus status = reply ? blink::mojom::PermissionStatus::GRANTED : blink::mojom::PermissionStatus::DENIED;
     {
         auto it = m_requests.begin();
@@ -101,35 +416,13 @@ void PermissionManagerQt::permissionRequestReply(const QUrl &origin, BrowserCont
                 ++it;
         }
     }
-    Q_FOREACH (const RequestOrSubscription &subscriber, m_subscribers) {
-        if (subscriber.origin == origin && subscriber.type == type)
-            subscriber.callback.Run(status);
-    }
+    notifySubscribers(previousStates);
 
     auto it = m_multiRequests.begin();
     while (it != m_multiRequests.end()) {
         if (it->origin == origin) {
-            bool answerable = true;
             std::vector<blink::mojom::PermissionStatus> result;
-            result.reserve(it->types.size());
-            for (content::PermissionType permission : it->types) {
-                const BrowserContextAdapter::PermissionType permissionType = toQt(permission);
-                if (permissionType == BrowserContextAdapter::UnsupportedPermission) {
-                    result.push_back(blink::mojom::PermissionStatus::DENIED);
-                    continue;
-                }
-
-                QPair<QUrl, BrowserContextAdapter::PermissionType> key(origin, permissionType);
-                if (!m_permissions.contains(key)) {
-                    answerable = false;
-                    break;
-                }
-                if (m_permissions[key])
-                    result.push_back(blink::mojom::PermissionStatus::GRANTED);
-                else
-                    result.push_back(blink::mojom::PermissionStatus::DENIED);
-            }
-            if (answerable) {
+            if (multiRequestResult(it->types, origin, &result)) {
                 it->callback.Run(result);
                 it = m_multiRequests.erase(it);
                 continue;
@@ -139,10 +432,57 @@ void PermissionManagerQt::permissionRequestReply(const QUrl &origin, BrowserCont
     }
 }
 
+// Returns false if any of the permissions has yet to be decided.
+bool PermissionManagerQt::multiRequestResult(const std::vector<content::PermissionType> &types, const QUrl &origin,
+                                             std::vector<blink::mojom::PermissionStatus> *result) const
+{
+    result->clear();
+    result->reserve(types.size());
+    for (content::PermissionType permission : types) {
+        const BrowserContextAdapter::PermissionType permissionType = toQt(permission);
+        const PermissionState state = permissionType == BrowserContextAdapter::UnsupportedPermission
+                ? BrowserContextAdapter::DeniedPermission : permissionState(origin, permissionType);
+        if (state == BrowserContextAdapter::AskPermission)
+            return false;
+        result->push_back(toBlink(state));
+    }
+    return true;
+}
+
+void PermissionManagerQt::answerPendingRequests()
+{
+    // Callbacks may cancel other requests, so the answers are collected first.
+    QVector<QPair<base::Callback<void(blink::mojom::PermissionStatus)>, PermissionState>> answers;
+    for (auto it = m_requests.begin(); it != m_requests.end();) {
+        const PermissionState state = permissionState(it->origin, it->type);
+        if (state == BrowserContextAdapter::AskPermission) {
+            ++it;
+            continue;
+        }
+        answers.append(qMakePair(it->callback, state));
+        it = m_requests.erase(it);
+    }
+    QVector<QPair<base::Callback<void(const std::vector<blink::mojom::PermissionStatus>&)>,
+                  std::vector<blink::mojom::PermissionStatus>>> multiAnswers;
+    for (auto it = m_multiRequests.begin(); it != m_multiRequests.end();) {
+        std::vector<blink::mojom::PermissionStatus> result;
+        if (!multiRequestResult(it->types, it->origin, &result)) {
+            ++it;
+            continue;
+        }
+        multiAnswers.append(qMakePair(it->callback, result));
+        it = m_multiRequests.erase(it);
+    }
+
+    for (const auto &answer : qAsConst(answers))
+        answer.first.Run(toBlink(answer.second));
+    for (const auto &answer : qAsConst(multiAnswers))
+        answer.first.Run(answer.second);
+}
+
 bool PermissionManagerQt::checkPermission(const QUrl &origin, BrowserContextAdapter::PermissionType type)
 {
-    QPair<QUrl, BrowserContextAdapter::PermissionType> key(origin, type);
-    return m_permissions.contains(key) && m_permissions[key];
+    return permissionState(origin, type) == BrowserContextAdapter::GrantedPermission;
 }
 
 int PermissionManagerQt::RequestPermission(content::PermissionType permission,
@@ -161,6 +501,12 @@ int PermissionManagerQt::RequestPermission(content::PermissionType permission,
     Q_ASSERT(permissionType != BrowserContextAdapter::AudioCapturePermission
           && permissionType != BrowserContextAdapter::VideoCapturePermission);
 
+    const PermissionState state = permissionState(toQt(requesting_origin), permissionType);
+    if (state != BrowserContextAdapter::AskPermission) {
+        callback.Run(toBlink(state));
+        return kNoPendingOperation;
+    }
+
     content::WebContents *webContents = frameHost->GetRenderViewHost()->GetDelegate()->GetAsWebContents();
     WebContentsDelegateQt* contentsDelegate = static_cast<WebContentsDelegateQt*>(webContents->GetDelegate());
     Q_ASSERT(contentsDelegate);
@@ -181,19 +527,9 @@ int PermissionManagerQt::RequestPermissions(const std::vector<content::Permissio
                                             bool /*user_gesture*/,
                                             const base::Callback<void(const std::vector<blink::mojom::PermissionStatus>&)>& callback)
 {
-    bool answerable = true;
     std::vector<blink::mojom::PermissionStatus> result;
-    result.reserve(permissions.size());
-    for (content::PermissionType permission : permissions) {
-        const BrowserContextAdapter::PermissionType permissionType = toQt(permission);
-        if (permissionType == BrowserContextAdapter::UnsupportedPermission)
-            result.push_back(blink::mojom::PermissionStatus::DENIED);
-        else {
-            answerable = false;
-            break;
-        }
-    }
-    if (answerable) {
+    const QUrl origin = toQt(requesting_origin);
+    if (multiRequestResult(permissions, origin, &result)) {
         callback.Run(result);
         return kNoPendingOperation;
     }
@@ -204,7 +540,7 @@ int PermissionManagerQt::RequestPermissions(const std::vector<content::Permissio
     Q_ASSERT(contentsDelegate);
     MultiRequest request = {
         permissions,
-        toQt(requesting_origin),
+        origin,
         callback
     };
     m_multiRequests.insert(request_id, request);
@@ -232,12 +568,7 @@ blink::mojom::PermissionStatus PermissionManagerQt::GetPermissionStatus(
     if (permissionType == BrowserContextAdapter::UnsupportedPermission)
         return blink::mojom::PermissionStatus::DENIED;
 
-    QPair<QUrl, BrowserContextAdapter::PermissionType> key(toQt(requesting_origin), permissionType);
-    if (!m_permissions.contains(key))
-        return blink::mojom::PermissionStatus::ASK;
-    if (m_permissions[key])
-        return blink::mojom::PermissionStatus::GRANTED;
-    return blink::mojom::PermissionStatus::DENIED;
+    return toBlink(permissionState(toQt(requesting_origin), permissionType));
 }
 
 void PermissionManagerQt::ResetPermission(
@@ -249,8 +580,16 @@ void PermissionManagerQt::ResetPermission(
     if (permissionType == BrowserContextAdapter::UnsupportedPermission)
         return;
 
+    const SubscriberStates previousStates = subscriberStates();
     QPair<QUrl, BrowserContextAdapter::PermissionType> key(toQt(requesting_origin), permissionType);
-    m_permissions.remove(key);
+    if (m_loadingPermissions)
+        m_changesWhileLoading.append({ key.first.toString(), permissionType, BrowserContextAdapter::AskPermission });
+    const bool removedSessionPermission = m_sessionPermissions.remove(key);
+    if (m_permissions.remove(key))
+        schedulePersistentWrite();
+    else if (!removedSessionPermission)
+        return;
+    notifySubscribers(previousStates);
 }
 
 int PermissionManagerQt::SubscribePermissionStatusChange(
@@ -41,23 +41,48 @@
 #define PERMISSION_MANAGER_QT_H
 
 #include "base/callback.h"
+#include "base/files/important_file_writer.h"
+#include "base/memory/weak_ptr.h"
+#include "base/sequenced_task_runner.h"
 #include "content/public/browser/permission_manager.h"
 #include "browser_context_adapter.h"
+#include "origin_pattern.h"
 
 #include <QHash>
+#include <QSet>
+#include <QVector>
 
 namespace QtWebEngineCore {
 
-class PermissionManagerQt : public content::PermissionManager {
+// Remembers permission decisions per origin and answers permission checks and requests
+// from them without involving the page. Besides exact origins, decisions can be made for
+// origin patterns like "https://*.example.com" or "*://intranet:*", which apply to every
+// origin without a decision of its own, in the order they were added.
+// Decisions of profiles with a data path are saved to the "Permissions" file in it, but
+// replies to permission requests of pages only last for the session. The file is read on
+// a background sequence, decisions made before it has been read take precedence.
+class PermissionManagerQt : public content::PermissionManager
+                          , public base::ImportantFileWriter::DataSerializer {
 
 public:
-    PermissionManagerQt();
+    PermissionManagerQt(BrowserContextAdapter *contextAdapter);
     ~PermissionManagerQt();
     typedef BrowserContextAdapter::PermissionType PermissionType;
+    typedef BrowserContextAdapter::PermissionState PermissionState;
 
     void permissionRequestReply(const QUrl &origin, PermissionType type, bool reply);
     bool checkPermission(const QUrl &origin, PermissionType type);
 
+    PermissionState permissionState(const QUrl &origin, PermissionType type) const;
+    bool setPermission(const QString &originPattern, PermissionType type, PermissionState state);
+    void clearPermissions();
+    QByteArray exportPermissions() const;
+    bool importPermissions(const QByteArray &data);
+    void setPersistentStoragePath(const QString &path);
+
+    // base::ImportantFileWriter::DataSerializer implementation:
+    bool SerializeData(std::string *data) override;
+
     // content::PermissionManager implementation:
     int RequestPermission(
         content::PermissionType permission,
@@ -95,7 +120,39 @@ public:
     void UnsubscribePermissionStatusChange(int subscription_id) override;
 
 private:
+    struct PatternRule {
+        OriginPattern pattern;
+        PermissionType type;
+        bool granted;
+    };
+
+    typedef QHash<int, PermissionState> SubscriberStates;
+
+    bool setPermissionInternal(const QString &originPattern, PermissionType type, PermissionState state);
+    SubscriberStates subscriberStates() const;
+    void notifySubscribers(const SubscriberStates &previousStates);
+    bool readPermissions(const QByteArray &data, QSet<PermissionType> *changedTypes);
+    void loadPermissions(const QString &filePath);
+    void permissionsLoaded(const QString &filePath, const std::string &data);
+    void schedulePersistentWrite();
+    bool multiRequestResult(const std::vector<content::PermissionType> &types, const QUrl &origin,
+                            std::vector<blink::mojom::PermissionStatus> *result) const;
+    void answerPendingRequests();
+
+    struct PendingChange {
+        QString originPattern;
+        PermissionType type;
+        PermissionState state;
+    };
+
     QHash<QPair<QUrl, PermissionType>, bool> m_permissions;
+    QHash<QPair<QUrl, PermissionType>, bool> m_sessionPermissions;
+    QVector<PatternRule> m_patternRules;
+    scoped_refptr<base::SequencedTaskRunner> m_fileTaskRunner;
+    std::unique_ptr<base::ImportantFileWriter> m_persistentWriter;
+    bool m_loadingPermissions;
+    // Changes made while the file is being read, applied on top of it once it has been read.
+    QVector<PendingChange> m_changesWhileLoading;
     struct RequestOrSubscription {
         PermissionType type;
         QUrl origin;
@@ -112,6 +169,7 @@ private:
     int m_requestIdCount;
     int m_subscriberIdCount;
 
+    base::WeakPtrFactory<PermissionManagerQt> m_weakPtrFactory;
 };
 
 } // namespace QtWebEngineCore
@@ -43,9 +43,13 @@
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/browsing_data_remover.h"
 #include "content/public/browser/cookie_store_factory.h"
+#include "content/public/browser/resource_request_info.h"
 #include "content/public/common/content_features.h"
 #include "chrome/browser/custom_handlers/protocol_handler_registry_factory.h"
 #include "chrome/browser/net/chrome_mojo_proxy_resolver_factory.h"
+#include "ipc/ipc_message.h"
+#include "net/cert_verifier_qt.h"
+#include "net/certificate_exception_store_qt.h"
 #include "net/cookie_monster_delegate_qt.h"
 #include "net/cert/cert_verifier.h"
 #include "net/cert/ct_known_logs.h"
@@ -53,6 +57,8 @@
 #include "net/cert/multi_log_ct_verifier.h"
 #include "net/custom_protocol_handler.h"
 #include "net/extras/sqlite/sqlite_channel_id_store.h"
+#include "net/http_cache_controller_qt.h"
+#include "net/http/http_auth_cache.h"
 #include "net/http/http_auth_handler_factory.h"
 #include "net/http/http_auth_scheme.h"
 #include "net/http/http_auth_preferences.h"
@@ -62,10 +68,15 @@
 #include "net/proxy/dhcp_proxy_script_fetcher_factory.h"
 #include "net/proxy/proxy_script_fetcher_impl.h"
 #include "net/proxy/proxy_service.h"
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
 #include "net/proxy_config_service_qt.h"
 #include "net/ssl/channel_id_service.h"
 #include "net/ssl/ssl_config_service_defaults.h"
+#include "net/ssl_host_state_delegate_qt.h"
 #include "net/network_delegate_qt.h"
+#include "net/network_metrics_qt.h"
+#include "net/network_predictor_qt.h"
+#include "net/url_request_content_job_qt.h"
 #include "net/url_request_context_getter_qt.h"
 #include "net/url_request/data_protocol_handler.h"
 #include "net/url_request/file_protocol_handler.h"
@@ -147,6 +158,9 @@ static net::HttpNetworkSession::Params generateNetworkSessionParams(bool ignoreC
 ProfileIODataQt::ProfileIODataQt(ProfileQt *profile)
     : m_profile(profile),
       m_mutex(QMutex::Recursive),
+      m_networkMetrics(new NetworkMetricsQt),
+      m_httpAuthCredentialStore(new HttpAuthCredentialStoreQt),
+      m_contentResourceRegistry(new ContentResourceRegistryQt),
       m_weakPtrFactory(this)
 {
     if (content::BrowserThread::IsMessageLoopValid(content::BrowserThread::UI))
@@ -157,6 +171,8 @@ ProfileIODataQt::~ProfileIODataQt()
 {
     if (content::BrowserThread::IsMessageLoopValid(content::BrowserThread::IO))
         DCHECK_CURRENTLY_ON(content::BrowserThread::IO);
+    m_networkPredictor.reset();
+    m_httpCacheController.reset();
     m_resourceContext.reset();
     if (m_cookieDelegate)
         m_cookieDelegate->setCookieMonster(0); // this will let CookieMonsterDelegateQt be deleted
@@ -213,6 +229,8 @@ void ProfileIODataQt::initializeOnUIThread()
         protocolHandlerRegistry->CreateJobInterceptorFactory();
     m_cookieDelegate = new CookieMonsterDelegateQt();
     m_cookieDelegate->setClient(m_profile->adapter()->cookieStore());
+    m_certificateExceptionStore =
+        static_cast<SSLHostStateDelegateQt *>(m_profile->GetSSLHostStateDelegate())->exceptionStore();
 }
 
 void ProfileIODataQt::cancelAllUrlRequests()
@@ -220,6 +238,9 @@ void ProfileIODataQt::cancelAllUrlRequests()
     Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
     Q_ASSERT(m_urlRequestContext);
 
+    if (m_networkPredictor)
+        m_networkPredictor->cancelAll();
+
     const std::set<const net::URLRequest*> *url_requests = m_urlRequestContext->url_requests();
     std::set<const net::URLRequest*>::const_iterator it = url_requests->begin();
     std::set<const net::URLRequest*>::const_iterator end = url_requests->end();
@@ -261,7 +282,8 @@ void ProfileIODataQt::generateStorage()
     net::ProxyConfigService *proxyConfigService = m_proxyConfigService.fetchAndStoreAcquire(0);
     Q_ASSERT(proxyConfigService);
 
-    m_storage->set_cert_verifier(net::CertVerifier::CreateDefault());
+    m_storage->set_cert_verifier(std::make_unique<CertVerifierQt>(net::CertVerifier::CreateDefault(),
+                                                                  m_certificateExceptionStore));
     std::unique_ptr<net::MultiLogCTVerifier> ct_verifier(new net::MultiLogCTVerifier());
     ct_verifier->AddLogs(net::ct::CreateLogVerifiersForKnownLogs());
     m_storage->set_cert_transparency_verifier(std::move(ct_verifier));
@@ -441,11 +463,14 @@ void ProfileIODataQt::generateHttpCache()
         cancelAllUrlRequests();
         m_httpNetworkSession.reset(new net::HttpNetworkSession(network_session_params,
                                                                network_session_context));
+        prefillHttpAuthCache();
     }
 
     cache = new net::HttpCache(m_httpNetworkSession.get(),
                                std::unique_ptr<net::HttpCache::DefaultBackend>(main_backend), false);
 
+    if (m_httpCacheController)
+        m_httpCacheController->cancelAll();
     m_storage->set_http_transaction_factory(std::unique_ptr<net::HttpCache>(cache));
 }
 
@@ -501,6 +526,10 @@ void ProfileIODataQt::generateJobFactory()
         topJobFactory = std::move(m_protocolHandlerInterceptor);
     }
 
+    // Content set by WebContentsAdapter::setContent() takes precedence over any handler for its base URL.
+    topJobFactory.reset(new net::URLRequestInterceptingJobFactory(std::move(topJobFactory),
+                                                                  std::make_unique<ContentResourceInterceptorQt>(m_contentResourceRegistry)));
+
     m_jobFactory = std::move(topJobFactory);
 
     m_urlRequestContext->set_job_factory(m_jobFactory.get());
@@ -553,6 +582,7 @@ void ProfileIODataQt::setFullConfiguration()
     m_httpCachePath = m_browserContextAdapter->httpCachePath();
     m_httpCacheMaxSize = m_browserContextAdapter->httpCacheMaxSize();
     m_customUrlSchemes = m_browserContextAdapter->customUrlSchemes();
+    m_storageAccessPolicy = m_browserContextAdapter->storageAccessPolicy();
 }
 
 void ProfileIODataQt::updateStorageSettings()
@@ -655,4 +685,370 @@ void ProfileIODataQt::updateRequestInterceptor()
     m_requestInterceptor = m_browserContextAdapter->requestInterceptor();
     // We in this case do not need to regenerate any Chromium classes.
 }
+
+void ProfileIODataQt::updateStorageAccessPolicy()
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    QMutexLocker lock(&m_mutex);
+    m_storageAccessPolicy = m_browserContextAdapter->storageAccessPolicy();
+}
+
+bool ProfileIODataQt::canAccessStorage(const GURL &firstPartyUrl, const GURL &url)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
+    BrowserContextAdapter::StorageAccessPolicy policy;
+    {
+        QMutexLocker lock(&m_mutex);
+        policy = m_storageAccessPolicy;
+    }
+    if (policy == BrowserContextAdapter::BlockStorageAccess)
+        return false;
+    if (policy == BrowserContextAdapter::BlockThirdPartyStorageAccess
+            && !net::registry_controlled_domains::SameDomainOrHost(url, firstPartyUrl,
+                                                                   net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES))
+        return false;
+    return m_cookieDelegate->canGetCookies(toQt(firstPartyUrl), toQt(url));
+}
+
+// The frame registrations are posted with an unretained pointer like the predictions below,
+// the IO thread sees them in the order the frames were created and deleted.
+void ProfileIODataQt::registerFrameMetrics(int processId, int routingId, int frameTreeNodeId,
+                                           NetworkMetricsQt *metrics)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::registerFrameMetricsOnIOThread,
+                                                base::Unretained(this), processId, routingId, frameTreeNodeId,
+                                                base::WrapRefCounted(metrics)));
+}
+
+void ProfileIODataQt::unregisterFrameRoute(int processId, int routingId)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::unregisterFrameRouteOnIOThread,
+                                                base::Unretained(this), processId, routingId));
+}
+
+void ProfileIODataQt::unregisterFrameTreeNode(int frameTreeNodeId)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::unregisterFrameTreeNodeOnIOThread,
+                                                base::Unretained(this), frameTreeNodeId));
+}
+
+void ProfileIODataQt::unregisterFrameMetrics(NetworkMetricsQt *metrics)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::unregisterFrameMetricsOnIOThread,
+                                                base::Unretained(this), base::WrapRefCounted(metrics)));
+}
+
+void ProfileIODataQt::registerFrameMetricsOnIOThread(int processId, int routingId, int frameTreeNodeId,
+                                                     scoped_refptr<NetworkMetricsQt> metrics)
+{
+    if (routingId != MSG_ROUTING_NONE)
+        m_frameRouteMetrics[std::make_pair(processId, routingId)] = metrics;
+    if (frameTreeNodeId != -1)
+        m_frameTreeNodeMetrics[frameTreeNodeId] = metrics;
+}
+
+void ProfileIODataQt::unregisterFrameRouteOnIOThread(int processId, int routingId)
+{
+    m_frameRouteMetrics.erase(std::make_pair(processId, routingId));
+}
+
+void ProfileIODataQt::unregisterFrameTreeNodeOnIOThread(int frameTreeNodeId)
+{
+    m_frameTreeNodeMetrics.erase(frameTreeNodeId);
+}
+
+void ProfileIODataQt::unregisterFrameMetricsOnIOThread(scoped_refptr<NetworkMetricsQt> metrics)
+{
+    for (auto it = m_frameRouteMetrics.begin(); it != m_frameRouteMetrics.end();) {
+        if (it->second == metrics)
+            it = m_frameRouteMetrics.erase(it);
+        else
+            ++it;
+    }
+    for (auto it = m_frameTreeNodeMetrics.begin(); it != m_frameTreeNodeMetrics.end();) {
+        if (it->second == metrics)
+            it = m_frameTreeNodeMetrics.erase(it);
+        else
+            ++it;
+    }
+}
+
+// Returns the counters of the page that issued \a request, or null for requests
+// that do not belong to a frame, like those of workers or of the browser itself.
+NetworkMetricsQt *ProfileIODataQt::frameMetricsForRequest(const net::URLRequest *request)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
+    const content::ResourceRequestInfo *info = content::ResourceRequestInfo::ForRequest(request);
+    if (!info)
+        return nullptr;
+
+    const int frameTreeNodeId = info->GetFrameTreeNodeId();
+    if (frameTreeNodeId != -1) {
+        auto it = m_frameTreeNodeMetrics.find(frameTreeNodeId);
+        if (it != m_frameTreeNodeMetrics.end())
+            return it->second.get();
+    }
+    auto it = m_frameRouteMetrics.find(std::make_pair(info->GetChildID(), info->GetRenderFrameID()));
+    if (it != m_frameRouteMetrics.end())
+        return it->second.get();
+    return nullptr;
+}
+
+static void networkPredictionFinished(QPointer<BrowserContextAdapter> adapter, quint64 requestId, bool success)
+{
+    DCHECK_CURRENTLY_ON(content::BrowserThread::UI);
+    if (adapter)
+        adapter->networkPredictionFinished(requestId, success);
+}
+
+static void postNetworkPredictionFinished(QPointer<BrowserContextAdapter> adapter, quint64 requestId, bool success)
+{
+    content::BrowserThread::PostTask(
+                content::BrowserThread::UI, FROM_HERE,
+                base::Bind(&networkPredictionFinished, adapter, requestId, success));
+}
+
+NetworkPredictorQt *ProfileIODataQt::networkPredictor()
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
+    if (!m_networkPredictor)
+        m_networkPredictor.reset(new NetworkPredictorQt(urlRequestContext(),
+                                                        base::Bind(&postNetworkPredictionFinished,
+                                                                   m_browserContextAdapter)));
+    return m_networkPredictor.get();
+}
+
+// The predictions below are posted with an unretained pointer, as this object is only
+// deleted on the IO thread after the tasks posted before shutdownOnUIThread() have run.
+void ProfileIODataQt::preconnect(const GURL &url, int numSockets)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::preconnectOnIOThread,
+                                                base::Unretained(this), url, numSockets));
+}
+
+void ProfileIODataQt::prefetchHostName(quint64 requestId, const std::string &hostName)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::prefetchHostNameOnIOThread,
+                                                base::Unretained(this), requestId, hostName));
+}
+
+void ProfileIODataQt::prefetch(quint64 requestId, const GURL &url, BrowserContextAdapter::PrefetchPriority priority)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    // Even high priority prefetches stay below the main resources of the pages.
+    net::RequestPriority requestPriority = net::IDLE;
+    switch (priority) {
+    case BrowserContextAdapter::IdlePrefetchPriority:
+        requestPriority = net::IDLE;
+        break;
+    case BrowserContextAdapter::LowPrefetchPriority:
+        requestPriority = net::LOWEST;
+        break;
+    case BrowserContextAdapter::MediumPrefetchPriority:
+        requestPriority = net::LOW;
+        break;
+    case BrowserContextAdapter::HighPrefetchPriority:
+        requestPriority = net::MEDIUM;
+        break;
+    }
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::prefetchOnIOThread,
+                                                base::Unretained(this), requestId, url, requestPriority));
+}
+
+void ProfileIODataQt::preconnectOnIOThread(const GURL &url, int numSockets)
+{
+    networkPredictor()->preconnect(url, numSockets);
+}
+
+void ProfileIODataQt::prefetchHostNameOnIOThread(quint64 requestId, const std::string &hostName)
+{
+    networkPredictor()->resolveHostName(requestId, hostName);
+}
+
+void ProfileIODataQt::prefetchOnIOThread(quint64 requestId, const GURL &url, net::RequestPriority priority)
+{
+    networkPredictor()->prefetch(requestId, url, priority);
+}
+
+static void httpCacheEntriesReceived(QPointer<BrowserContextAdapter> adapter, quint64 requestId,
+                                     const QVector<QWebEngineHttpCacheEntry> &entries)
+{
+    if (adapter)
+        adapter->httpCacheEntriesReceived(requestId, entries);
+}
+
+static void httpCacheStatisticsReceived(QPointer<BrowserContextAdapter> adapter, quint64 requestId,
+                                        const QWebEngineHttpCacheStatistics &statistics)
+{
+    if (adapter)
+        adapter->httpCacheStatisticsReceived(requestId, statistics);
+}
+
+static void httpCacheEntryInserted(QPointer<BrowserContextAdapter> adapter, quint64 requestId, int result)
+{
+    if (adapter)
+        adapter->httpCacheEntryInserted(requestId, result > 0);
+}
+
+static void httpCacheEntriesRemoved(QPointer<BrowserContextAdapter> adapter, quint64 requestId, int result)
+{
+    if (adapter)
+        adapter->httpCacheEntriesRemoved(requestId, qMax(result, 0));
+}
+
+template <typename... Args>
+static void postToUIThread(void (*function)(QPointer<BrowserContextAdapter>, quint64, Args...),
+                           QPointer<BrowserContextAdapter> adapter, quint64 requestId, Args... args)
+{
+    content::BrowserThread::PostTask(content::BrowserThread::UI, FROM_HERE,
+                                     base::Bind(function, adapter, requestId, args...));
+}
+
+HttpCacheControllerQt *ProfileIODataQt::httpCacheController()
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
+    if (!m_httpCacheController)
+        m_httpCacheController.reset(new HttpCacheControllerQt(urlRequestContext()));
+    return m_httpCacheController.get();
+}
+
+// Like the network predictions, the cache operations are posted with an unretained pointer.
+void ProfileIODataQt::requestHttpCacheEntries(quint64 requestId)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::requestHttpCacheEntriesOnIOThread,
+                                                base::Unretained(this), requestId));
+}
+
+void ProfileIODataQt::requestHttpCacheStatistics(quint64 requestId)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::requestHttpCacheStatisticsOnIOThread,
+                                                base::Unretained(this), requestId));
+}
+
+void ProfileIODataQt::insertHttpCacheEntry(quint64 requestId, const GURL &url, const std::string &rawHeaders,
+                                           const std::string &body)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::insertHttpCacheEntryOnIOThread,
+                                                base::Unretained(this), requestId, url, rawHeaders, body));
+}
+
+void ProfileIODataQt::removeHttpCacheEntry(quint64 requestId, const GURL &url)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::removeHttpCacheEntryOnIOThread,
+                                                base::Unretained(this), requestId, url));
+}
+
+void ProfileIODataQt::removeHttpCacheEntriesWithPrefix(quint64 requestId, const std::string &urlPrefix)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::removeHttpCacheEntriesWithPrefixOnIOThread,
+                                                base::Unretained(this), requestId, urlPrefix));
+}
+
+void ProfileIODataQt::requestHttpCacheEntriesOnIOThread(quint64 requestId)
+{
+    httpCacheController()->listEntries(
+                base::Bind(&postToUIThread<const QVector<QWebEngineHttpCacheEntry> &>,
+                           &httpCacheEntriesReceived, m_browserContextAdapter, requestId));
+}
+
+void ProfileIODataQt::requestHttpCacheStatisticsOnIOThread(quint64 requestId)
+{
+    httpCacheController()->computeStatistics(
+                base::Bind(&postToUIThread<const QWebEngineHttpCacheStatistics &>,
+                           &httpCacheStatisticsReceived, m_browserContextAdapter, requestId));
+}
+
+void ProfileIODataQt::insertHttpCacheEntryOnIOThread(quint64 requestId, const GURL &url,
+                                                     const std::string &rawHeaders, const std::string &body)
+{
+    httpCacheController()->insertEntry(url, rawHeaders, body,
+                                       base::Bind(&postToUIThread<int>, &httpCacheEntryInserted,
+                                                  m_browserContextAdapter, requestId));
+}
+
+void ProfileIODataQt::removeHttpCacheEntryOnIOThread(quint64 requestId, const GURL &url)
+{
+    httpCacheController()->removeEntry(url, base::Bind(&postToUIThread<int>, &httpCacheEntriesRemoved,
+                                                       m_browserContextAdapter, requestId));
+}
+
+void ProfileIODataQt::removeHttpCacheEntriesWithPrefixOnIOThread(quint64 requestId, const std::string &urlPrefix)
+{
+    httpCacheController()->removeEntriesWithPrefix(urlPrefix,
+                                                   base::Bind(&postToUIThread<int>, &httpCacheEntriesRemoved,
+                                                              m_browserContextAdapter, requestId));
+}
+
+void ProfileIODataQt::updateHttpAuthCache()
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::prefillHttpAuthCache, base::Unretained(this)));
+}
+
+void ProfileIODataQt::removeFromHttpAuthCache(std::vector<HttpAuthCredentialStoreQt::Entry> entries)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
+    if (entries.empty())
+        return;
+    content::BrowserThread::PostTask(content::BrowserThread::IO, FROM_HERE,
+                                     base::Bind(&ProfileIODataQt::removeFromHttpAuthCacheOnIOThread,
+                                                base::Unretained(this), std::move(entries)));
+}
+
+net::HttpAuthCache *ProfileIODataQt::httpAuthCache() const
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
+    return m_httpNetworkSession ? m_httpNetworkSession->http_auth_cache() : nullptr;
+}
+
+// The auth cache belongs to the network session, so this runs again whenever a new session is created.
+// Basic credentials with a realm that the embedder asked to send preemptively are added for their
+// origin, which lets the network stack send them without waiting for a challenge.
+void ProfileIODataQt::prefillHttpAuthCache()
+{
+    net::HttpAuthCache *cache = httpAuthCache();
+    if (!cache)
+        return;
+    for (const HttpAuthCredentialStoreQt::Entry &entry : m_httpAuthCredentialStore->preemptiveEntries()) {
+        const std::string challenge = "Basic realm=\"" + entry.realm + "\"";
+        cache->Add(entry.origin.GetURL(), entry.realm, net::HttpAuth::AUTH_SCHEME_BASIC,
+                   challenge, entry.credentials, "/");
+    }
+}
+
+void ProfileIODataQt::removeFromHttpAuthCacheOnIOThread(const std::vector<HttpAuthCredentialStoreQt::Entry> &entries)
+{
+    net::HttpAuthCache *cache = httpAuthCache();
+    if (!cache)
+        return;
+    for (const HttpAuthCredentialStoreQt::Entry &entry : entries) {
+        if (HttpAuthCredentialStoreQt::isPreemptive(entry))
+            cache->Remove(entry.origin.GetURL(), entry.realm, net::HttpAuth::AUTH_SCHEME_BASIC, entry.credentials);
+    }
+}
+
 } // namespace QtWebEngineCore
@@ -43,24 +43,37 @@
 #include "browser_context_adapter.h"
 #include "chrome/browser/profiles/profile.h"
 #include "chrome/browser/custom_handlers/protocol_handler_registry.h"
+#include "net/http_auth_credential_store_qt.h"
+#include "net/url_request_content_job_qt.h"
+#include "net/base/request_priority.h"
 #include "services/proxy_resolver/public/interfaces/proxy_resolver.mojom.h"
 #include <QtCore/QString>
 #include <QtCore/QPointer>
 #include <QtCore/QMutex>
 
+#include <map>
+
+class GURL;
+
 namespace net {
 class DhcpProxyScriptFetcherFactory;
+class HttpAuthCache;
 class HttpAuthPreferences;
 class HttpNetworkSession;
 class NetworkDelegate;
 class ProxyConfigService;
 class URLRequestContext;
+class URLRequest;
 class URLRequestContextStorage;
 class URLRequestJobFactoryImpl;
 }
 
 namespace QtWebEngineCore {
 
+class CertificateExceptionStoreQt;
+class HttpCacheControllerQt;
+class NetworkMetricsQt;
+class NetworkPredictorQt;
 class ProfileQt;
 
 // ProfileIOData contains data that lives on the IOthread
@@ -97,8 +110,53 @@ public:
     void updateHttpCache(); // runs on ui thread
     void updateJobFactory(); // runs on ui thread
     void updateRequestInterceptor(); // runs on ui thread
+    void updateStorageAccessPolicy(); // runs on ui thread
+    bool canAccessStorage(const GURL &firstPartyUrl, const GURL &url);
+
+    NetworkMetricsQt *networkMetrics() const { return m_networkMetrics.get(); }
+    void registerFrameMetrics(int processId, int routingId, int frameTreeNodeId, NetworkMetricsQt *metrics); // runs on ui thread
+    void unregisterFrameRoute(int processId, int routingId); // runs on ui thread
+    void unregisterFrameTreeNode(int frameTreeNodeId); // runs on ui thread
+    void unregisterFrameMetrics(NetworkMetricsQt *metrics); // runs on ui thread
+    NetworkMetricsQt *frameMetricsForRequest(const net::URLRequest *request);
+
+    void preconnect(const GURL &url, int numSockets); // runs on ui thread
+    void prefetchHostName(quint64 requestId, const std::string &hostName); // runs on ui thread
+    void prefetch(quint64 requestId, const GURL &url, BrowserContextAdapter::PrefetchPriority priority); // runs on ui thread
+
+    void requestHttpCacheEntries(quint64 requestId); // runs on ui thread
+    void requestHttpCacheStatistics(quint64 requestId); // runs on ui thread
+    void insertHttpCacheEntry(quint64 requestId, const GURL &url, const std::string &rawHeaders,
+                              const std::string &body); // runs on ui thread
+    void removeHttpCacheEntry(quint64 requestId, const GURL &url); // runs on ui thread
+    void removeHttpCacheEntriesWithPrefix(quint64 requestId, const std::string &urlPrefix); // runs on ui thread
+
+    HttpAuthCredentialStoreQt *httpAuthCredentialStore() const { return m_httpAuthCredentialStore.get(); }
+    ContentResourceRegistryQt *contentResourceRegistry() const { return m_contentResourceRegistry.get(); }
+    void updateHttpAuthCache(); // runs on ui thread
+    void removeFromHttpAuthCache(std::vector<HttpAuthCredentialStoreQt::Entry> entries); // runs on ui thread
 
 private:
+    NetworkPredictorQt *networkPredictor();
+    void preconnectOnIOThread(const GURL &url, int numSockets);
+    void prefetchHostNameOnIOThread(quint64 requestId, const std::string &hostName);
+    void prefetchOnIOThread(quint64 requestId, const GURL &url, net::RequestPriority priority);
+    HttpCacheControllerQt *httpCacheController();
+    void requestHttpCacheEntriesOnIOThread(quint64 requestId);
+    void requestHttpCacheStatisticsOnIOThread(quint64 requestId);
+    void insertHttpCacheEntryOnIOThread(quint64 requestId, const GURL &url, const std::string &rawHeaders,
+                                        const std::string &body);
+    void removeHttpCacheEntryOnIOThread(quint64 requestId, const GURL &url);
+    void removeHttpCacheEntriesWithPrefixOnIOThread(quint64 requestId, const std::string &urlPrefix);
+    net::HttpAuthCache *httpAuthCache() const;
+    void prefillHttpAuthCache();
+    void removeFromHttpAuthCacheOnIOThread(const std::vector<HttpAuthCredentialStoreQt::Entry> &entries);
+    void registerFrameMetricsOnIOThread(int processId, int routingId, int frameTreeNodeId,
+                                        scoped_refptr<NetworkMetricsQt> metrics);
+    void unregisterFrameRouteOnIOThread(int processId, int routingId);
+    void unregisterFrameTreeNodeOnIOThread(int frameTreeNodeId);
+    void unregisterFrameMetricsOnIOThread(scoped_refptr<NetworkMetricsQt> metrics);
+
     ProfileQt *m_profile;
     std::unique_ptr<net::URLRequestContextStorage> m_storage;
     std::unique_ptr<net::NetworkDelegate> m_networkDelegate;
@@ -109,6 +167,8 @@ private:
     std::unique_ptr<net::DhcpProxyScriptFetcherFactory> m_dhcpProxyScriptFetcherFactory;
     std::unique_ptr<net::HttpAuthPreferences> m_httpAuthPreferences;
     std::unique_ptr<net::URLRequestJobFactory> m_jobFactory;
+    std::unique_ptr<NetworkPredictorQt> m_networkPredictor;
+    std::unique_ptr<HttpCacheControllerQt> m_httpCacheController;
     base::WeakPtr<ProfileIODataQt> m_weakPtr;
     scoped_refptr<CookieMonsterDelegateQt> m_cookieDelegate;
     content::URLRequestInterceptorScopedVector m_requestInterceptors;
@@ -123,11 +183,20 @@ private:
     QString m_httpAcceptLanguage;
     QString m_httpUserAgent;
     BrowserContextAdapter::HttpCacheType m_httpCacheType;
+    BrowserContextAdapter::StorageAccessPolicy m_storageAccessPolicy = BrowserContextAdapter::AllowStorageAccess;
     QString m_httpCachePath;
     QList<QByteArray> m_customUrlSchemes;
     QList<QByteArray> m_installedCustomSchemes;
     QWebEngineUrlRequestInterceptor* m_requestInterceptor = nullptr;
     QMutex m_mutex;
+    scoped_refptr<NetworkMetricsQt> m_networkMetrics;
+    scoped_refptr<CertificateExceptionStoreQt> m_certificateExceptionStore;
+    scoped_refptr<HttpAuthCredentialStoreQt> m_httpAuthCredentialStore;
+    scoped_refptr<ContentResourceRegistryQt> m_contentResourceRegistry;
+    // Page counters by (render process id, render frame routing id) for subresources and
+    // by frame tree node id for navigations, only used on the IO thread.
+    std::map<std::pair<int, int>, scoped_refptr<NetworkMetricsQt>> m_frameRouteMetrics;
+    std::map<int, scoped_refptr<NetworkMetricsQt>> m_frameTreeNodeMetrics;
     int m_httpCacheMaxSize = 0;
     bool m_initialized = false;
     bool m_updateAllStorage = false;
@@ -173,7 +173,7 @@ content::PushMessagingService *ProfileQt::GetPushMessagingService()
 content::SSLHostStateDelegate* ProfileQt::GetSSLHostStateDelegate()
 {
     if (!m_sslHostStateDelegate)
-        m_sslHostStateDelegate.reset(new SSLHostStateDelegateQt());
+        m_sslHostStateDelegate.reset(new SSLHostStateDelegateQt(m_adapter));
     return m_sslHostStateDelegate.get();
 }
 
@@ -200,7 +200,7 @@ content::BrowsingDataRemoverDelegate *ProfileQt::GetBrowsingDataRemoverDelegate(
 content::PermissionManager *ProfileQt::GetPermissionManager()
 {
     if (!m_permissionManager)
-        m_permissionManager.reset(new PermissionManagerQt());
+        m_permissionManager.reset(new PermissionManagerQt(m_adapter));
     return m_permissionManager.get();
 }
 
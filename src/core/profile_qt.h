@@ -112,6 +112,7 @@ public:
 private:
     friend class ContentBrowserClientQt;
     friend class WebContentsAdapter;
+    friend class WebContentsDelegateQt;
     scoped_refptr<net::URLRequestContextGetter> m_urlRequestContextGetter;
     std::unique_ptr<PermissionManagerQt> m_permissionManager;
     std::unique_ptr<SSLHostStateDelegateQt> m_sslHostStateDelegate;
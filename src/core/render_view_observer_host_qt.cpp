@@ -39,9 +39,12 @@
 
 #include "render_view_observer_host_qt.h"
 
+#include "base/memory/shared_memory.h"
 #include "common/qt_messages.h"
 #include "content/public/browser/render_view_host.h"
 #include "content/public/browser/web_contents.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "ui/gfx/geometry/rect.h"
 
 #include "render_widget_host_view_qt.h"
 #include "type_conversion.h"
@@ -55,8 +58,24 @@ RenderViewObserverHostQt::RenderViewObserverHostQt(content::WebContents *webCont
 {
 }
 
+RenderViewObserverHostQt::~RenderViewObserverHostQt()
+{
+    finishDocumentFetches();
+    finishDocumentContentStreams();
+    finishImageGrabs();
+}
+
+void RenderViewObserverHostQt::detachClient()
+{
+    m_pendingDocumentFetches.clear();
+    m_documentContentStreams.clear();
+    m_pendingImageGrabs.clear();
+    m_adapterClient = nullptr;
+}
+
 void RenderViewObserverHostQt::fetchDocumentMarkup(quint64 requestId)
 {
+    m_pendingDocumentFetches[requestId] = true;
     web_contents()->GetRenderViewHost()->Send(
                 new RenderViewObserverQt_FetchDocumentMarkup(
                         web_contents()->GetRenderViewHost()->GetRoutingID(), requestId));
@@ -64,11 +83,33 @@ void RenderViewObserverHostQt::fetchDocumentMarkup(quint64 requestId)
 
 void RenderViewObserverHostQt::fetchDocumentInnerText(quint64 requestId)
 {
+    m_pendingDocumentFetches[requestId] = false;
     web_contents()->GetRenderViewHost()->Send(
                 new RenderViewObserverQt_FetchDocumentInnerText(
                         web_contents()->GetRenderViewHost()->GetRoutingID(), requestId));
 }
 
+void RenderViewObserverHostQt::streamDocumentContent(quint64 requestId, bool markup, qint64 maxBytes, const QStringList &subframeOrigins)
+{
+    std::vector<std::string> origins;
+    origins.reserve(subframeOrigins.size());
+    for (const QString &origin : subframeOrigins)
+        origins.push_back(origin.toStdString());
+    // The buffer is mapped once the renderer has started the stream.
+    m_documentContentStreams[requestId] = nullptr;
+    web_contents()->GetRenderViewHost()->Send(
+                new RenderViewObserverQt_StreamDocumentContent(
+                        web_contents()->GetRenderViewHost()->GetRoutingID(), requestId, markup, maxBytes, origins));
+}
+
+void RenderViewObserverHostQt::grabImage(quint64 requestId, const gfx::Rect &rect, float scale)
+{
+    m_pendingImageGrabs.insert(requestId);
+    web_contents()->GetRenderViewHost()->Send(
+                new RenderViewObserverQt_GrabImage(
+                        web_contents()->GetRenderViewHost()->GetRoutingID(), requestId, rect, scale));
+}
+
 bool RenderViewObserverHostQt::OnMessageReceived(const IPC::Message& message)
 {
     bool handled = true;
@@ -77,6 +118,12 @@ bool RenderViewObserverHostQt::OnMessageReceived(const IPC::Message& message)
                             onDidFetchDocumentMarkup)
         IPC_MESSAGE_HANDLER(RenderViewObserverHostQt_DidFetchDocumentInnerText,
                             onDidFetchDocumentInnerText)
+        IPC_MESSAGE_HANDLER(RenderViewObserverHostQt_DidStartDocumentContentStream,
+                            onDidStartDocumentContentStream)
+        IPC_MESSAGE_HANDLER(RenderViewObserverHostQt_DidStreamDocumentContentChunk,
+                            onDidStreamDocumentContentChunk)
+        IPC_MESSAGE_HANDLER(RenderViewObserverHostQt_DidGrabImage,
+                            onDidGrabImage)
         IPC_MESSAGE_UNHANDLED(handled = false)
     IPC_END_MESSAGE_MAP()
     return handled;
@@ -85,12 +132,101 @@ bool RenderViewObserverHostQt::OnMessageReceived(const IPC::Message& message)
 
 void RenderViewObserverHostQt::onDidFetchDocumentMarkup(quint64 requestId, const base::string16& markup)
 {
+    if (!m_pendingDocumentFetches.erase(requestId))
+        return;
     m_adapterClient->didFetchDocumentMarkup(requestId, toQt(markup));
 }
 
 void RenderViewObserverHostQt::onDidFetchDocumentInnerText(quint64 requestId, const base::string16& innerText)
 {
+    if (!m_pendingDocumentFetches.erase(requestId))
+        return;
     m_adapterClient->didFetchDocumentInnerText(requestId, toQt(innerText));
 }
 
+void RenderViewObserverHostQt::onDidStartDocumentContentStream(quint64 requestId, const base::SharedMemoryHandle &buffer, quint32 capacity)
+{
+    auto it = m_documentContentStreams.find(requestId);
+    if (it == m_documentContentStreams.end())
+        return;
+    std::unique_ptr<base::SharedMemory> memory(new base::SharedMemory(buffer, /* read_only = */ true));
+    if (memory->Map(capacity))
+        it->second = std::move(memory);
+}
+
+void RenderViewObserverHostQt::onDidStreamDocumentContentChunk(quint64 requestId, quint32 size)
+{
+    auto it = m_documentContentStreams.find(requestId);
+    if (it == m_documentContentStreams.end())
+        return;
+    if (!size || !it->second || size > it->second->mapped_size()) {
+        m_documentContentStreams.erase(it);
+        // An empty chunk tells the client the stream is complete.
+        m_adapterClient->didStreamDocumentContent(requestId, QByteArray());
+        return;
+    }
+
+    // The chunk is copied out of the shared buffer before acknowledging it, since the renderer
+    // reuses the buffer for the next chunk. Slow consumers thereby throttle the renderer.
+    m_adapterClient->didStreamDocumentContent(requestId, QByteArray(static_cast<const char *>(it->second->memory()), size));
+    web_contents()->GetRenderViewHost()->Send(
+                new RenderViewObserverQt_DocumentContentChunkAck(
+                        web_contents()->GetRenderViewHost()->GetRoutingID(), requestId));
+}
+
+void RenderViewObserverHostQt::onDidGrabImage(quint64 requestId, const SkBitmap &bitmap)
+{
+    if (!m_pendingImageGrabs.erase(requestId))
+        return;
+    // The bitmap only lives as long as the message, detach the image from its pixels.
+    m_adapterClient->didGrabImage(requestId, bitmap.drawsNothing() ? QImage() : toQImage(bitmap).copy());
+}
+
+void RenderViewObserverHostQt::finishDocumentFetches()
+{
+    std::map<quint64, bool> fetches;
+    fetches.swap(m_pendingDocumentFetches);
+    for (const auto &fetch : fetches) {
+        if (fetch.second)
+            m_adapterClient->didFetchDocumentMarkup(fetch.first, QString());
+        else
+            m_adapterClient->didFetchDocumentInnerText(fetch.first, QString());
+    }
+}
+
+void RenderViewObserverHostQt::finishImageGrabs()
+{
+    std::set<quint64> grabs;
+    grabs.swap(m_pendingImageGrabs);
+    for (quint64 requestId : grabs)
+        m_adapterClient->didGrabImage(requestId, QImage());
+}
+
+void RenderViewObserverHostQt::finishDocumentContentStreams()
+{
+    std::map<quint64, std::unique_ptr<base::SharedMemory>> streams;
+    streams.swap(m_documentContentStreams);
+    for (const auto &stream : streams)
+        m_adapterClient->didStreamDocumentContent(stream.first, QByteArray());
+}
+
+void RenderViewObserverHostQt::RenderViewHostChanged(content::RenderViewHost *oldHost, content::RenderViewHost *newHost)
+{
+    Q_UNUSED(newHost);
+    // Pending requests are bound to the renderer of the old view, which will not answer anymore.
+    if (oldHost) {
+        finishDocumentFetches();
+        finishDocumentContentStreams();
+        finishImageGrabs();
+    }
+}
+
+void RenderViewObserverHostQt::RenderProcessGone(base::TerminationStatus status)
+{
+    Q_UNUSED(status);
+    finishDocumentFetches();
+    finishDocumentContentStreams();
+    finishImageGrabs();
+}
+
 } // namespace QtWebEngineCore
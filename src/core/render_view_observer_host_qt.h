@@ -40,9 +40,25 @@
 #ifndef RENDER_VIEW_OBSERVER_HOST_QT_H
 #define RENDER_VIEW_OBSERVER_HOST_QT_H
 
+#include "base/memory/shared_memory_handle.h"
 #include "content/public/browser/web_contents_observer.h"
 
 #include <QtGlobal>
+#include <QStringList>
+
+#include <map>
+#include <memory>
+#include <set>
+
+class SkBitmap;
+
+namespace base {
+class SharedMemory;
+}
+
+namespace gfx {
+class Rect;
+}
 
 namespace content {
     class WebContents;
@@ -56,15 +72,32 @@ class RenderViewObserverHostQt : public content::WebContentsObserver
 {
 public:
     RenderViewObserverHostQt(content::WebContents*, WebContentsAdapterClient *adapterClient);
+    ~RenderViewObserverHostQt();
     void fetchDocumentMarkup(quint64 requestId);
     void fetchDocumentInnerText(quint64 requestId);
+    void streamDocumentContent(quint64 requestId, bool markup, qint64 maxBytes, const QStringList &subframeOrigins);
+    void grabImage(quint64 requestId, const gfx::Rect &rect, float scale);
+    // Drops the pending requests without calling the client, which is about to go away.
+    void detachClient();
 
 private:
     bool OnMessageReceived(const IPC::Message& message) override;
+    void RenderViewHostChanged(content::RenderViewHost *oldHost, content::RenderViewHost *newHost) override;
+    void RenderProcessGone(base::TerminationStatus status) override;
     void onDidFetchDocumentMarkup(quint64 requestId, const base::string16& markup);
     void onDidFetchDocumentInnerText(quint64 requestId, const base::string16& innerText);
+    void onDidStartDocumentContentStream(quint64 requestId, const base::SharedMemoryHandle &buffer, quint32 capacity);
+    void onDidStreamDocumentContentChunk(quint64 requestId, quint32 size);
+    void onDidGrabImage(quint64 requestId, const SkBitmap &bitmap);
+    void finishDocumentFetches();
+    void finishDocumentContentStreams();
+    void finishImageGrabs();
 
     WebContentsAdapterClient *m_adapterClient;
+    // Whether the pending fetch is for the markup or the inner text.
+    std::map<quint64, bool> m_pendingDocumentFetches;
+    std::map<quint64, std::unique_ptr<base::SharedMemory>> m_documentContentStreams;
+    std::set<quint64> m_pendingImageGrabs;
 };
 
 } // namespace QtWebEngineCore
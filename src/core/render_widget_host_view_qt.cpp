@@ -52,6 +52,7 @@
 #include "web_event_factory.h"
 
 #include "base/command_line.h"
+#include "base/trace_event/trace_event.h"
 #include "components/viz/service/display/direct_renderer.h"
 #include "components/viz/service/frame_sinks/frame_sink_manager_impl.h"
 #include "content/browser/accessibility/browser_accessibility_state_impl.h"
@@ -112,17 +113,15 @@ enum ImStateFlags {
     AllFlags = TextInputStateUpdated | TextSelectionUpdated | TextSelectionBoundsUpdated
 };
 
-static inline ui::LatencyInfo CreateLatencyInfo(const blink::WebInputEvent& event) {
+static inline ui::LatencyInfo CreateLatencyInfo(base::TimeTicks originalEventTime) {
   ui::LatencyInfo latency_info;
   // The latency number should only be added if the timestamp is valid.
-  if (event.TimeStampSeconds()) {
-    const int64_t time_micros = static_cast<int64_t>(
-        event.TimeStampSeconds() * base::Time::kMicrosecondsPerSecond);
+  if (!originalEventTime.is_null()) {
     latency_info.AddLatencyNumberWithTimestamp(
         ui::INPUT_EVENT_LATENCY_ORIGINAL_COMPONENT,
         0,
         0,
-        base::TimeTicks() + base::TimeDelta::FromMicroseconds(time_micros),
+        originalEventTime,
         1);
   }
   return latency_info;
@@ -163,15 +162,6 @@ static inline Qt::InputMethodHints toQtInputMethodHints(ui::TextInputType inputT
     }
 }
 
-static inline int firstAvailableId(const QMap<int, int> &map)
-{
-    ui::BitSet32 usedIds;
-    QMap<int, int>::const_iterator end = map.end();
-    for (QMap<int, int>::const_iterator it = map.begin(); it != end; ++it)
-        usedIds.mark_bit(it.value());
-    return usedIds.first_unmarked_bit();
-}
-
 static inline ui::GestureProvider::Config QtGestureProviderConfig() {
     ui::GestureProvider::Config config = ui::GetGestureProviderConfig(ui::GestureProviderConfigType::CURRENT_PLATFORM);
     // Causes an assert in CreateWebGestureEventFromGestureEventData and we don't need them in Qt.
@@ -463,10 +453,13 @@ content::BrowserAccessibilityManager* RenderWidgetHostViewQt::CreateBrowserAcces
 {
     Q_UNUSED(for_root_frame); // FIXME
 #ifndef QT_NO_ACCESSIBILITY
-    return new content::BrowserAccessibilityManagerQt(
+    content::BrowserAccessibilityManagerQt *manager = new content::BrowserAccessibilityManagerQt(
         m_adapterClient->accessibilityParentObject(),
         content::BrowserAccessibilityManagerQt::GetEmptyDocument(),
         delegate);
+    if (WebContentsAdapter *adapter = m_adapterClient->webContentsAdapter())
+        manager->setMaxEventRate(adapter->accessibilityEventRateLimit());
+    return manager;
 #else
     return 0;
 #endif // QT_NO_ACCESSIBILITY
@@ -750,6 +743,10 @@ void RenderWidgetHostViewQt::SubmitCompositorFrame(const viz::LocalSurfaceId &lo
     }
     Q_ASSERT(!m_needsDelegatedFrameAck);
     m_needsDelegatedFrameAck = true;
+    bool inputTracingEnabled;
+    TRACE_EVENT_CATEGORY_GROUP_ENABLED("input", &inputTracingEnabled);
+    if (inputTracingEnabled)
+        m_frameLatencyInfo = frame.metadata.latency_info;
     m_chromiumCompositorData->previousFrameData = std::move(m_chromiumCompositorData->frameData);
     m_chromiumCompositorData->frameDevicePixelRatio = frame.metadata.device_scale_factor;
     m_chromiumCompositorData->frameData = std::move(frame);
@@ -1057,9 +1054,11 @@ bool RenderWidgetHostViewQt::forwardEvent(QEvent *event)
         break;
     case QEvent::KeyPress:
     case QEvent::KeyRelease:
+        flushPendingInputEvents();
         handleKeyEvent(static_cast<QKeyEvent*>(event));
         break;
     case QEvent::Wheel:
+        flushPendingInputEvents();
         handleWheelEvent(static_cast<QWheelEvent*>(event));
         break;
     case QEvent::TouchBegin:
@@ -1077,6 +1076,7 @@ bool RenderWidgetHostViewQt::forwardEvent(QEvent *event)
         break;
 #ifndef QT_NO_GESTURES
     case QEvent::NativeGesture:
+        flushPendingInputEvents();
         handleGestureEvent(static_cast<QNativeGestureEvent *>(event));
         break;
 #endif // QT_NO_GESTURES
@@ -1085,9 +1085,11 @@ bool RenderWidgetHostViewQt::forwardEvent(QEvent *event)
         break;
     case QEvent::FocusIn:
     case QEvent::FocusOut:
+        flushPendingInputEvents();
         handleFocusEvent(static_cast<QFocusEvent*>(event));
         break;
     case QEvent::InputMethod:
+        flushPendingInputEvents();
         handleInputMethodEvent(static_cast<QInputMethodEvent*>(event));
         break;
     case QEvent::InputMethodQuery:
@@ -1095,6 +1097,7 @@ bool RenderWidgetHostViewQt::forwardEvent(QEvent *event)
         break;
     case QEvent::HoverLeave:
     case QEvent::Leave:
+        flushPendingInputEvents();
         m_host->ForwardMouseEvent(WebEventFactory::toWebMouseEvent(event));
         break;
     default:
@@ -1156,6 +1159,10 @@ void RenderWidgetHostViewQt::ProcessAckedTouchEvent(const content::TouchEventWit
 
 void RenderWidgetHostViewQt::sendDelegatedFrameAck()
 {
+    if (!m_frameLatencyInfo.empty()) {
+        traceInputLatency(m_frameLatencyInfo);
+        m_frameLatencyInfo.clear();
+    }
     m_beginFrameSource->DidFinishFrame(this);
     std::vector<viz::ReturnedResource> resources;
     m_resourcesToRelease.swap(resources);
@@ -1163,7 +1170,26 @@ void RenderWidgetHostViewQt::sendDelegatedFrameAck()
         m_rendererCompositorFrameSink->DidReceiveCompositorFrameAck(resources);
 }
 
-void RenderWidgetHostViewQt::processMotionEvent(const ui::MotionEvent &motionEvent)
+void RenderWidgetHostViewQt::traceInputLatency(const std::vector<ui::LatencyInfo> &latencyInfo)
+{
+    // Input events that caused the frame which has just been handed over to the
+    // Qt scene graph carry the time of the originating Qt event. Report the time
+    // from there to presentation for each of them.
+    static quint64 nextTraceId = 0;
+    const base::TimeTicks presentationTime = base::TimeTicks::Now();
+    for (const ui::LatencyInfo &latency : latencyInfo) {
+        ui::LatencyInfo::LatencyComponent original;
+        if (!latency.FindLatency(ui::INPUT_EVENT_LATENCY_ORIGINAL_COMPONENT, 0, &original))
+            continue;
+        const quint64 traceId = ++nextTraceId;
+        TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP0("input", "InputEventToPresentation",
+                                                         TRACE_ID_LOCAL(traceId), original.event_time);
+        TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0("input", "InputEventToPresentation",
+                                                       TRACE_ID_LOCAL(traceId), presentationTime);
+    }
+}
+
+void RenderWidgetHostViewQt::processMotionEvent(const ui::MotionEvent &motionEvent, base::TimeTicks originalEventTime)
 {
     auto result = m_gestureProvider.OnTouchEvent(motionEvent);
     if (!result.succeeded)
@@ -1171,7 +1197,7 @@ void RenderWidgetHostViewQt::processMotionEvent(const ui::MotionEvent &motionEve
 
     blink::WebTouchEvent touchEvent = ui::CreateWebTouchEventFromMotionEvent(motionEvent,
                                                                              result.moved_beyond_slop_region);
-    m_host->ForwardTouchEventWithLatencyInfo(touchEvent, CreateLatencyInfo(touchEvent));
+    m_host->ForwardTouchEventWithLatencyInfo(touchEvent, CreateLatencyInfo(originalEventTime));
 }
 
 QList<QTouchEvent::TouchPoint> RenderWidgetHostViewQt::mapTouchPointIds(const QList<QTouchEvent::TouchPoint> &inputPoints)
@@ -1180,19 +1206,113 @@ QList<QTouchEvent::TouchPoint> RenderWidgetHostViewQt::mapTouchPointIds(const QL
     for (int i = 0; i < outputPoints.size(); ++i) {
         QTouchEvent::TouchPoint &point = outputPoints[i];
 
-        int qtId = point.id();
-        QMap<int, int>::const_iterator it = m_touchIdMapping.find(qtId);
-        if (it == m_touchIdMapping.end())
-            it = m_touchIdMapping.insert(qtId, firstAvailableId(m_touchIdMapping));
-        point.setId(it.value());
+        const int qtId = point.id();
+        auto it = std::find_if(m_touchIdMapping.begin(), m_touchIdMapping.end(),
+                               [qtId](const TouchIdMapping &mapping) { return mapping.qtId == qtId; });
+        if (it == m_touchIdMapping.end()) {
+            const int chromiumId = m_usedTouchIds.first_unmarked_bit();
+            m_usedTouchIds.mark_bit(chromiumId);
+            m_touchIdMapping.append({ qtId, chromiumId });
+            it = m_touchIdMapping.end() - 1;
+        }
+        point.setId(it->chromiumId);
 
-        if (point.state() == Qt::TouchPointReleased)
-            m_touchIdMapping.remove(qtId);
+        if (point.state() == Qt::TouchPointReleased) {
+            m_usedTouchIds.clear_bit(it->chromiumId);
+            m_touchIdMapping.erase(it);
+        }
     }
 
     return outputPoints;
 }
 
+base::TimeTicks RenderWidgetHostViewQt::eventTimeTicks(ulong timestamp)
+{
+    // Chromium expects the event timestamps to be comparable to base::TimeTicks::Now().
+    // Most importantly we also have to preserve the relative time distance between events.
+    // Calculate a delta between event timestamps and Now() on the first received event, and
+    // apply this delta to all successive events. This delta is most likely smaller than it
+    // should by calculating it here but this will hopefully cause less than one frame of delay.
+    base::TimeTicks eventTimestamp = base::TimeTicks() + base::TimeDelta::FromMilliseconds(timestamp);
+    if (m_eventsToNowDelta == base::TimeDelta())
+        m_eventsToNowDelta = base::TimeTicks::Now() - eventTimestamp;
+    return eventTimestamp + m_eventsToNowDelta;
+}
+
+void RenderWidgetHostViewQt::forwardMouseEvent(const blink::WebMouseEvent &webEvent, base::TimeTicks eventTime)
+{
+    if (webEvent.GetType() == blink::WebInputEvent::kMouseMove) {
+        if (m_pendingMouseMove && ui::CanCoalesce(webEvent, *m_pendingMouseMove)) {
+            ui::Coalesce(webEvent, &*m_pendingMouseMove);
+            return;
+        }
+        flushPendingInputEvents();
+        m_pendingMouseMove = webEvent;
+        m_pendingMouseMoveTime = eventTime;
+        updateNeedsBeginFramesInternal();
+        return;
+    }
+
+    flushPendingInputEvents();
+    m_host->ForwardMouseEventWithLatencyInfo(webEvent, CreateLatencyInfo(eventTime));
+}
+
+bool RenderWidgetHostViewQt::coalesceTouchUpdate(QTouchEvent *ev)
+{
+    // Only updates that move existing touch points can be merged, anything adding
+    // or removing points has to reach the gesture provider in order.
+    if (ev->type() != QEvent::TouchUpdate
+            || (ev->touchPointStates() & ~(Qt::TouchPointMoved | Qt::TouchPointStationary)))
+        return false;
+
+    QList<QTouchEvent::TouchPoint> touchPoints = ev->touchPoints();
+    bool merge = false;
+    if (m_pendingTouchUpdate) {
+        const QList<QTouchEvent::TouchPoint> &pendingPoints = m_pendingTouchUpdate->touchPoints();
+        merge = pendingPoints.size() == touchPoints.size()
+                && std::equal(pendingPoints.cbegin(), pendingPoints.cend(), touchPoints.cbegin(),
+                              [](const QTouchEvent::TouchPoint &lhs, const QTouchEvent::TouchPoint &rhs) {
+                                  return lhs.id() == rhs.id();
+                              });
+    }
+
+    if (merge) {
+        // A point which moved in the replaced update is still moved, even if it
+        // is stationary in the new one.
+        const QList<QTouchEvent::TouchPoint> &pendingPoints = m_pendingTouchUpdate->touchPoints();
+        for (int i = 0; i < touchPoints.size(); ++i) {
+            if (pendingPoints.at(i).state() == Qt::TouchPointMoved)
+                touchPoints[i].setState(Qt::TouchPointMoved);
+        }
+    } else {
+        flushPendingInputEvents();
+        m_pendingTouchUpdateTime = eventTimeTicks(ev->timestamp());
+    }
+
+    Qt::TouchPointStates states = 0;
+    for (const QTouchEvent::TouchPoint &point : qAsConst(touchPoints))
+        states |= point.state();
+    QTouchEvent *pendingEvent = new QTouchEvent(ev->type(), ev->device(), ev->modifiers(), states, touchPoints);
+    pendingEvent->setTimestamp(ev->timestamp());
+    m_pendingTouchUpdate.reset(pendingEvent);
+    if (!merge)
+        updateNeedsBeginFramesInternal();
+    return true;
+}
+
+void RenderWidgetHostViewQt::flushPendingInputEvents()
+{
+    if (m_pendingMouseMove) {
+        const blink::WebMouseEvent webEvent = *m_pendingMouseMove;
+        m_pendingMouseMove.reset();
+        m_host->ForwardMouseEventWithLatencyInfo(webEvent, CreateLatencyInfo(m_pendingMouseMoveTime));
+    }
+    if (m_pendingTouchUpdate) {
+        QScopedPointer<QTouchEvent> ev(m_pendingTouchUpdate.take());
+        processTouchEvent(ev.data(), m_pendingTouchUpdateTime);
+    }
+}
+
 float RenderWidgetHostViewQt::dpiScale() const
 {
     return m_adapterClient ? m_adapterClient->dpiScale() : 1.0;
@@ -1498,15 +1618,18 @@ void RenderWidgetHostViewQt::handleTouchEvent(QTouchEvent *ev)
     }
 #endif
 
-    // Chromium expects the touch event timestamps to be comparable to base::TimeTicks::Now().
-    // Most importantly we also have to preserve the relative time distance between events.
-    // Calculate a delta between event timestamps and Now() on the first received event, and
-    // apply this delta to all successive events. This delta is most likely smaller than it
-    // should by calculating it here but this will hopefully cause less than one frame of delay.
-    base::TimeTicks eventTimestamp = base::TimeTicks() + base::TimeDelta::FromMilliseconds(ev->timestamp());
-    if (m_eventsToNowDelta == base::TimeDelta())
-        m_eventsToNowDelta = base::TimeTicks::Now() - eventTimestamp;
-    eventTimestamp += m_eventsToNowDelta;
+    if (coalesceTouchUpdate(ev))
+        return;
+
+    flushPendingInputEvents();
+    processTouchEvent(ev);
+}
+
+void RenderWidgetHostViewQt::processTouchEvent(QTouchEvent *ev, base::TimeTicks originalEventTime)
+{
+    const base::TimeTicks eventTimestamp = eventTimeTicks(ev->timestamp());
+    if (originalEventTime.is_null())
+        originalEventTime = eventTimestamp;
 
     QList<QTouchEvent::TouchPoint> touchPoints = mapTouchPointIds(ev->touchPoints());
 
@@ -1535,7 +1658,7 @@ void RenderWidgetHostViewQt::handleTouchEvent(QTouchEvent *ev)
         clearPreviousTouchMotionState();
         MotionEventQt cancelEvent(touchPoints, eventTimestamp, ui::MotionEvent::ACTION_CANCEL,
                                   ev->modifiers(), dpiScale());
-        processMotionEvent(cancelEvent);
+        processMotionEvent(cancelEvent, originalEventTime);
         return;
     }
     case QEvent::TouchEnd:
@@ -1588,7 +1711,7 @@ void RenderWidgetHostViewQt::handleTouchEvent(QTouchEvent *ev)
 
         MotionEventQt motionEvent(touchPoints, eventTimestamp, action, ev->modifiers(), dpiScale(),
                                   i);
-        processMotionEvent(motionEvent);
+        processMotionEvent(motionEvent, originalEventTime);
     }
 }
 
@@ -1643,12 +1766,13 @@ void RenderWidgetHostViewQt::handlePointerEvent(T *event)
 #endif
     }
 
-    m_host->ForwardMouseEvent(webEvent);
+    forwardMouseEvent(webEvent, event->timestamp() ? eventTimeTicks(event->timestamp()) : base::TimeTicks());
 }
 
 void RenderWidgetHostViewQt::handleHoverEvent(QHoverEvent *ev)
 {
-    m_host->ForwardMouseEvent(WebEventFactory::toWebMouseEvent(ev, dpiScale()));
+    forwardMouseEvent(WebEventFactory::toWebMouseEvent(ev, dpiScale()),
+                      ev->timestamp() ? eventTimeTicks(ev->timestamp()) : base::TimeTicks());
 }
 
 void RenderWidgetHostViewQt::handleFocusEvent(QFocusEvent *ev)
@@ -1680,19 +1804,27 @@ void RenderWidgetHostViewQt::updateNeedsBeginFramesInternal()
 {
     Q_ASSERT(m_beginFrameSource);
 
-    if (m_addedFrameObserver == m_needsBeginFrames)
+    // Coalesced input is delivered on BeginFrames, so keep observing them for as
+    // long as there is some, even if the renderer does not need them itself.
+    const bool needsBeginFrames = m_needsBeginFrames || hasPendingInputEvents();
+    if (m_addedFrameObserver == needsBeginFrames)
         return;
 
-    if (m_needsBeginFrames)
+    if (needsBeginFrames)
         m_beginFrameSource->AddObserver(this);
     else
         m_beginFrameSource->RemoveObserver(this);
-    m_addedFrameObserver = m_needsBeginFrames;
+    m_addedFrameObserver = needsBeginFrames;
 }
 
 bool RenderWidgetHostViewQt::OnBeginFrameDerivedImpl(const viz::BeginFrameArgs& args)
 {
     m_beginFrameSource->OnUpdateVSyncParameters(args.frame_time, args.interval);
+    flushPendingInputEvents();
+    if (!m_needsBeginFrames) {
+        updateNeedsBeginFramesInternal();
+        return false;
+    }
     if (m_rendererCompositorFrameSink)
         m_rendererCompositorFrameSink->OnBeginFrame(args);
     else // FIXME: is this else part ever needed?
@@ -43,6 +43,7 @@
 #include "render_widget_host_view_qt_delegate.h"
 
 #include "base/memory/weak_ptr.h"
+#include "base/optional.h"
 #include "components/viz/common/frame_sinks/begin_frame_source.h"
 #include "components/viz/common/resources/transferable_resource.h"
 #include "content/browser/accessibility/browser_accessibility_manager.h"
@@ -50,10 +51,13 @@
 #include "content/browser/renderer_host/text_input_manager.h"
 #include "content/common/view_messages.h"
 #include "gpu/ipc/common/gpu_messages.h"
+#include "ui/events/gesture_detection/bitset_32.h"
 #include "ui/events/gesture_detection/filtered_gesture_provider.h"
+#include "ui/latency/latency_info.h"
 #include "qtwebenginecoreglobal_p.h"
-#include <QMap>
 #include <QPoint>
+#include <QScopedPointer>
+#include <QVarLengthArray>
 #include <QtGlobal>
 #include <QtGui/qaccessible.h>
 #include <QtGui/QTouchEvent>
@@ -221,9 +225,16 @@ public:
 
 private:
     void sendDelegatedFrameAck();
-    void processMotionEvent(const ui::MotionEvent &motionEvent);
+    void processTouchEvent(QTouchEvent *ev, base::TimeTicks originalEventTime = base::TimeTicks());
+    void processMotionEvent(const ui::MotionEvent &motionEvent, base::TimeTicks originalEventTime);
     void clearPreviousTouchMotionState();
     QList<QTouchEvent::TouchPoint> mapTouchPointIds(const QList<QTouchEvent::TouchPoint> &inputPoints);
+    base::TimeTicks eventTimeTicks(ulong timestamp);
+    void forwardMouseEvent(const blink::WebMouseEvent &webEvent, base::TimeTicks eventTime);
+    bool coalesceTouchUpdate(QTouchEvent *ev);
+    void flushPendingInputEvents();
+    bool hasPendingInputEvents() const { return m_pendingMouseMove || m_pendingTouchUpdate; }
+    void traceInputLatency(const std::vector<ui::LatencyInfo> &latencyInfo);
     float dpiScale() const;
     void updateNeedsBeginFramesInternal();
 
@@ -238,7 +249,12 @@ private:
     base::TimeDelta m_eventsToNowDelta;
     bool m_sendMotionActionDown;
     bool m_touchMotionStarted;
-    QMap<int, int> m_touchIdMapping;
+    struct TouchIdMapping {
+        int qtId;
+        int chromiumId;
+    };
+    QVarLengthArray<TouchIdMapping, 16> m_touchIdMapping;
+    ui::BitSet32 m_usedTouchIds;
     QList<QTouchEvent::TouchPoint> m_previousTouchPoints;
     std::unique_ptr<RenderWidgetHostViewQtDelegate> m_delegate;
 
@@ -279,6 +295,15 @@ private:
     bool m_wheelAckPending;
     QList<blink::WebMouseWheelEvent> m_pendingWheelEvents;
 
+    // Mouse and touch moves are held back until the next BeginFrame and merged
+    // with any moves arriving in the meantime. The timestamps are the ones of
+    // the oldest event that was merged, for latency tracking.
+    base::Optional<blink::WebMouseEvent> m_pendingMouseMove;
+    base::TimeTicks m_pendingMouseMoveTime;
+    QScopedPointer<QTouchEvent> m_pendingTouchUpdate;
+    base::TimeTicks m_pendingTouchUpdateTime;
+    std::vector<ui::LatencyInfo> m_frameLatencyInfo;
+
     std::string m_editCommand;
 };
 
@@ -76,6 +76,7 @@
 
 #include "renderer/render_frame_observer_qt.h"
 #include "renderer/render_view_observer_qt.h"
+#include "renderer/storage_access_policy_qt.h"
 #include "renderer/user_resource_controller.h"
 #include "renderer/web_channel_ipc_transport.h"
 #include "services/service_manager/public/cpp/binder_registry.h"
@@ -113,6 +114,7 @@ void ContentRendererClientQt::RenderThreadStarted()
 
 
     renderThread->AddObserver(UserResourceController::instance());
+    renderThread->AddObserver(QtWebEngineCore::StorageAccessPolicyQt::instance());
 
 #if BUILDFLAG(ENABLE_SPELLCHECK)
     m_spellCheck.reset(new SpellCheck(this));
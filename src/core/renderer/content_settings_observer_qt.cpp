@@ -52,6 +52,7 @@
 #include "url/origin.h"
 
 #include "common/qt_messages.h"
+#include "renderer/storage_access_policy_qt.h"
 
 using blink::WebContentSettingCallbacks;
 using blink::WebSecurityOrigin;
@@ -74,7 +75,6 @@ ContentSettingsObserverQt::ContentSettingsObserverQt(content::RenderFrame *rende
         , content::RenderFrameObserverTracker<ContentSettingsObserverQt>(render_frame)
         , m_currentRequestId(0)
 {
-    ClearBlockedContentSettings();
     render_frame->GetWebFrame()->SetContentSettingsClient(this);
 }
 
@@ -94,15 +94,12 @@ bool ContentSettingsObserverQt::OnMessageReceived(const IPC::Message& message)
 }
 
 void ContentSettingsObserverQt::DidCommitProvisionalLoad(bool /*is_new_navigation*/,
-                                                         bool is_same_document_navigation)
+                                                         bool /*is_same_document_navigation*/)
 {
     blink::WebLocalFrame* frame = render_frame()->GetWebFrame();
     if (frame->Parent())
         return;  // Not a top-level navigation.
 
-    if (!is_same_document_navigation)
-        ClearBlockedContentSettings();
-
     GURL url = frame->GetDocument().Url();
     // If we start failing this DCHECK, please makes sure we don't regress
     // this bug: http://code.google.com/p/chromium/issues/detail?id=79304
@@ -123,11 +120,16 @@ bool ContentSettingsObserverQt::AllowDatabase(const WebString &name,
     if (IsUniqueFrame(frame))
         return false;
 
+    const GURL originUrl = url::Origin(frame->GetSecurityOrigin()).GetURL();
+    const GURL topOriginUrl = url::Origin(frame->Top()->GetSecurityOrigin()).GetURL();
+    if (base::Optional<bool> allowed = StorageAccessPolicyQt::instance()->canAccessStorage(topOriginUrl, originUrl))
+        return *allowed;
+
     bool result = false;
     Send(new QtWebEngineHostMsg_AllowDatabase(
-             routing_id(), url::Origin(frame->GetSecurityOrigin()).GetURL(),
-             url::Origin(frame->Top()->GetSecurityOrigin()).GetURL(), name.Utf16(),
+             routing_id(), originUrl, topOriginUrl, name.Utf16(),
              display_name.Utf16(), &result));
+    StorageAccessPolicyQt::instance()->cacheCookieFilterResult(topOriginUrl, originUrl, result);
     return result;
 }
 
@@ -139,6 +141,18 @@ void ContentSettingsObserverQt::RequestFileSystemAccessAsync(const WebContentSet
         permissionCallbacks.DoDeny();
         return;
     }
+
+    const GURL originUrl = url::Origin(frame->GetSecurityOrigin()).GetURL();
+    const GURL topOriginUrl = url::Origin(frame->Top()->GetSecurityOrigin()).GetURL();
+    if (base::Optional<bool> allowed = StorageAccessPolicyQt::instance()->canAccessStorage(topOriginUrl, originUrl)) {
+        WebContentSettingCallbacks permissionCallbacks(callbacks);
+        if (*allowed)
+            permissionCallbacks.DoAllow();
+        else
+            permissionCallbacks.DoDeny();
+        return;
+    }
+
     ++m_currentRequestId;
     bool inserted = m_permissionRequests.insert(std::make_pair(m_currentRequestId, callbacks)).second;
 
@@ -146,9 +160,7 @@ void ContentSettingsObserverQt::RequestFileSystemAccessAsync(const WebContentSet
     DCHECK(inserted);
 
     Send(new QtWebEngineHostMsg_RequestFileSystemAccessAsync(
-             routing_id(), m_currentRequestId,
-             url::Origin(frame->GetSecurityOrigin()).GetURL(),
-             url::Origin(frame->Top()->GetSecurityOrigin()).GetURL()));
+             routing_id(), m_currentRequestId, originUrl, topOriginUrl));
 }
 
 bool ContentSettingsObserverQt::AllowIndexedDB(const WebString &name,
@@ -158,11 +170,15 @@ bool ContentSettingsObserverQt::AllowIndexedDB(const WebString &name,
     if (IsUniqueFrame(frame))
         return false;
 
+    const GURL originUrl = url::Origin(frame->GetSecurityOrigin()).GetURL();
+    const GURL topOriginUrl = url::Origin(frame->Top()->GetSecurityOrigin()).GetURL();
+    if (base::Optional<bool> allowed = StorageAccessPolicyQt::instance()->canAccessStorage(topOriginUrl, originUrl))
+        return *allowed;
+
     bool result = false;
     Send(new QtWebEngineHostMsg_AllowIndexedDB(
-             routing_id(), url::Origin(frame->GetSecurityOrigin()).GetURL(),
-             url::Origin(frame->Top()->GetSecurityOrigin()).GetURL(), name.Utf16(),
-             &result));
+             routing_id(), originUrl, topOriginUrl, name.Utf16(), &result));
+    StorageAccessPolicyQt::instance()->cacheCookieFilterResult(topOriginUrl, originUrl, result);
     return result;
 }
 
@@ -172,16 +188,15 @@ bool ContentSettingsObserverQt::AllowStorage(bool local)
     if (IsUniqueFrame(frame))
         return false;
 
-    StoragePermissionsKey key(url::Origin(frame->GetDocument().GetSecurityOrigin()).GetURL(), local);
-    const auto permissions = m_cachedStoragePermissions.find(key);
-    if (permissions != m_cachedStoragePermissions.end())
-        return permissions->second;
+    const GURL originUrl = url::Origin(frame->GetSecurityOrigin()).GetURL();
+    const GURL topOriginUrl = url::Origin(frame->Top()->GetSecurityOrigin()).GetURL();
+    if (base::Optional<bool> allowed = StorageAccessPolicyQt::instance()->canAccessStorage(topOriginUrl, originUrl))
+        return *allowed;
 
     bool result = false;
     Send(new QtWebEngineHostMsg_AllowDOMStorage(
-             routing_id(), url::Origin(frame->GetSecurityOrigin()).GetURL(),
-             url::Origin(frame->Top()->GetSecurityOrigin()).GetURL(), local, &result));
-    m_cachedStoragePermissions[key] = result;
+             routing_id(), originUrl, topOriginUrl, local, &result));
+    StorageAccessPolicyQt::instance()->cacheCookieFilterResult(topOriginUrl, originUrl, result);
     return result;
 }
 
@@ -201,9 +216,4 @@ void ContentSettingsObserverQt::OnRequestFileSystemAccessAsyncResponse(int reque
     callbacks.DoDeny();
 }
 
-void ContentSettingsObserverQt::ClearBlockedContentSettings()
-{
-    m_cachedStoragePermissions.clear();
-}
-
 } // namespace QtWebEngineCore
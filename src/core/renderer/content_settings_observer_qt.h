@@ -87,13 +87,6 @@ private:
     // Message handlers.
     void OnRequestFileSystemAccessAsyncResponse(int request_id, bool allowed);
 
-    // Clears m_cachedStoragePermissions
-    void ClearBlockedContentSettings();
-
-    // Caches the result of AllowStorage.
-    using StoragePermissionsKey = std::pair<GURL, bool>;
-    base::flat_map<StoragePermissionsKey, bool> m_cachedStoragePermissions;
-
     int m_currentRequestId;
     base::flat_map<int, blink::WebContentSettingCallbacks> m_permissionRequests;
 
@@ -41,15 +41,94 @@
 
 #include "common/qt_messages.h"
 
+#include "base/memory/shared_memory.h"
+#include "base/strings/string_util.h"
+#include "cc/paint/skia_paint_canvas.h"
 #include "components/web_cache/renderer/web_cache_impl.h"
+#include "content/public/common/use_zoom_for_dsf_policy.h"
+#include "content/public/renderer/render_frame.h"
 #include "content/public/renderer/render_view.h"
+#include "third_party/skia/include/core/SkBitmap.h"
 #include "third_party/WebKit/public/web/WebDocument.h"
 #include "third_party/WebKit/public/web/WebElement.h"
 #include "third_party/WebKit/public/web/WebFrame.h"
+#include "third_party/WebKit/public/platform/WebString.h"
+#include "third_party/WebKit/public/platform/WebURL.h"
+#include "third_party/WebKit/public/platform/WebVector.h"
 #include "third_party/WebKit/public/web/WebFrameContentDumper.h"
+#include "third_party/WebKit/public/web/WebFrameSerializer.h"
+#include "third_party/WebKit/public/web/WebFrameSerializerClient.h"
 #include "third_party/WebKit/public/web/WebFrameWidget.h"
 #include "third_party/WebKit/public/web/WebLocalFrame.h"
 #include "third_party/WebKit/public/web/WebView.h"
+#include "ui/gfx/geometry/rect.h"
+#include "ui/gfx/geometry/rect_conversions.h"
+#include "ui/gfx/geometry/size_conversions.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+// Size of the shared buffer a document content stream is delivered through.
+const uint32_t kDocumentContentChunkSize = 64 * 1024;
+// Grabbed images are sent back in a single message, which has to stay well below
+// IPC::Channel::kMaximumMessageSize. Larger images are scaled down to fit.
+const int64_t kMaxGrabImagePixels = 4096 * 4096;
+const float kMaxGrabScale = 16.0f;
+
+// Collects the markup of a frame as Blink serializes it, dropping everything past the
+// byte limit so a large document is never held in full. Links are kept unchanged.
+class BoundedMarkupSerializer : public blink::WebFrameSerializerClient,
+                                public blink::WebFrameSerializer::LinkRewritingDelegate {
+public:
+    // A negative \a maxBytes means unlimited.
+    explicit BoundedMarkupSerializer(int64_t maxBytes) : m_remainingBytes(maxBytes) {}
+
+    void DidSerializeDataForFrame(const blink::WebVector<char> &data, FrameSerializationStatus) override
+    {
+        if (m_remainingBytes == 0)
+            return;
+        size_t size = data.size();
+        if (m_remainingBytes > 0) {
+            size = std::min(size, static_cast<size_t>(m_remainingBytes));
+            m_remainingBytes -= size;
+        }
+        m_content.append(data.Data(), size);
+    }
+    bool RewriteFrameSource(blink::WebFrame *, blink::WebString *) override { return false; }
+    bool RewriteLink(const blink::WebURL &, blink::WebString *) override { return false; }
+
+    std::string takeContent()
+    {
+        std::string content;
+        // The limit may have been reached in the middle of a UTF-8 sequence.
+        if (m_remainingBytes == 0)
+            base::TruncateUTF8ToByteSize(m_content, m_content.size(), &content);
+        else
+            content.swap(m_content);
+        m_content.clear();
+        return content;
+    }
+
+private:
+    int64_t m_remainingBytes;
+    std::string m_content;
+};
+}
+
+struct RenderViewObserverQt::DocumentContentStream {
+    bool markup;
+    // Bytes that may still be serialized, negative when unlimited.
+    int64_t remainingBytes;
+    // Frames are kept by routing id since they may go away while the stream is paused.
+    std::vector<int> frameRoutingIds;
+    size_t nextFrame = 0;
+    std::string pending;
+    size_t offset = 0;
+    std::unique_ptr<base::SharedMemory> buffer;
+};
 
 RenderViewObserverQt::RenderViewObserverQt(
         content::RenderView* render_view,
@@ -59,6 +138,10 @@ RenderViewObserverQt::RenderViewObserverQt(
 {
 }
 
+RenderViewObserverQt::~RenderViewObserverQt()
+{
+}
+
 void RenderViewObserverQt::onFetchDocumentMarkup(quint64 requestId)
 {
     blink::WebString markup;
@@ -78,11 +161,162 @@ void RenderViewObserverQt::onFetchDocumentInnerText(quint64 requestId)
     Send(new RenderViewObserverHostQt_DidFetchDocumentInnerText(routing_id(), requestId, text.Utf16()));
 }
 
+static bool originMatches(const blink::WebFrame *frame, const std::vector<std::string> &origins)
+{
+    const std::string origin = frame->GetSecurityOrigin().ToString().Utf8();
+    for (const std::string &filter : origins) {
+        if (filter == "*" || filter == origin)
+            return true;
+    }
+    return false;
+}
+
+void RenderViewObserverQt::onStreamDocumentContent(quint64 requestId, bool markup, qint64 maxBytes,
+                                                   const std::vector<std::string> &subframeOrigins)
+{
+    std::unique_ptr<DocumentContentStream> stream(new DocumentContentStream);
+    stream->markup = markup;
+    stream->remainingBytes = maxBytes;
+
+    blink::WebFrame *mainFrame = render_view()->GetWebView()->MainFrame();
+    if (mainFrame->IsWebLocalFrame()) {
+        stream->frameRoutingIds.push_back(render_view()->GetMainRenderFrame()->GetRoutingID());
+        // Plain text dumps already include the text of same-process subframes.
+        if (markup && !subframeOrigins.empty()) {
+            for (blink::WebFrame *frame = mainFrame->TraverseNext(); frame; frame = frame->TraverseNext()) {
+                if (!frame->IsWebLocalFrame() || !originMatches(frame, subframeOrigins))
+                    continue;
+                if (content::RenderFrame *renderFrame = content::RenderFrame::FromWebFrame(frame->ToWebLocalFrame()))
+                    stream->frameRoutingIds.push_back(renderFrame->GetRoutingID());
+            }
+        }
+    }
+
+    stream->buffer.reset(new base::SharedMemory);
+    if (!stream->buffer->CreateAndMapAnonymous(kDocumentContentChunkSize)) {
+        Send(new RenderViewObserverHostQt_DidStreamDocumentContentChunk(routing_id(), requestId, 0));
+        return;
+    }
+    Send(new RenderViewObserverHostQt_DidStartDocumentContentStream(routing_id(), requestId,
+                                                                    stream->buffer->handle().Duplicate(),
+                                                                    kDocumentContentChunkSize));
+    m_documentContentStreams[requestId] = std::move(stream);
+    sendNextDocumentContentChunk(requestId);
+}
+
+void RenderViewObserverQt::onDocumentContentChunkAck(quint64 requestId)
+{
+    sendNextDocumentContentChunk(requestId);
+}
+
+// Serializes the next frame of the stream, frames are only serialized once the previous
+// one has been consumed, so no frame is serialized after the byte limit is reached or the
+// page goes away. Markup past the limit is dropped as Blink produces it.
+bool RenderViewObserverQt::serializeNextFrame(DocumentContentStream *stream)
+{
+    while (stream->remainingBytes != 0 && stream->nextFrame < stream->frameRoutingIds.size()) {
+        content::RenderFrame *renderFrame = content::RenderFrame::FromRoutingID(stream->frameRoutingIds[stream->nextFrame++]);
+        if (!renderFrame)
+            continue;
+
+        std::string content;
+        if (stream->markup) {
+            BoundedMarkupSerializer serializer(stream->remainingBytes);
+            blink::WebFrameSerializer::Serialize(renderFrame->GetWebFrame(), &serializer, &serializer);
+            content = serializer.takeContent();
+        } else {
+            // Every character takes at least one byte, so this never dumps more than needed.
+            const size_t maxChars = stream->remainingBytes < 0 ? std::numeric_limits<std::size_t>::max()
+                                                              : static_cast<size_t>(stream->remainingBytes);
+            content = blink::WebFrameContentDumper::DumpWebViewAsText(render_view()->GetWebView(), maxChars).Utf8();
+        }
+
+        if (stream->remainingBytes >= 0) {
+            if (content.size() > static_cast<size_t>(stream->remainingBytes)) {
+                std::string truncated;
+                base::TruncateUTF8ToByteSize(content, static_cast<size_t>(stream->remainingBytes), &truncated);
+                content.swap(truncated);
+            }
+            stream->remainingBytes -= content.size();
+        }
+        if (content.empty())
+            continue;
+
+        stream->pending.swap(content);
+        stream->offset = 0;
+        return true;
+    }
+    return false;
+}
+
+void RenderViewObserverQt::sendNextDocumentContentChunk(quint64 requestId)
+{
+    auto it = m_documentContentStreams.find(requestId);
+    if (it == m_documentContentStreams.end())
+        return;
+    DocumentContentStream *stream = it->second.get();
+
+    if (stream->offset >= stream->pending.size()) {
+        // Release the previous frame before serializing the next one.
+        std::string().swap(stream->pending);
+        if (!serializeNextFrame(stream)) {
+            m_documentContentStreams.erase(it);
+            Send(new RenderViewObserverHostQt_DidStreamDocumentContentChunk(routing_id(), requestId, 0));
+            return;
+        }
+    }
+
+    size_t size = std::min<size_t>(kDocumentContentChunkSize, stream->pending.size() - stream->offset);
+    // Never split a UTF-8 sequence between two chunks.
+    if (stream->offset + size < stream->pending.size()) {
+        while (size > 0 && (stream->pending[stream->offset + size] & 0xC0) == 0x80)
+            --size;
+    }
+    memcpy(stream->buffer->memory(), stream->pending.data() + stream->offset, size);
+    stream->offset += size;
+    Send(new RenderViewObserverHostQt_DidStreamDocumentContentChunk(routing_id(), requestId, size));
+}
+
 void RenderViewObserverQt::onSetBackgroundColor(quint32 color)
 {
     render_view()->GetWebFrameWidget()->SetBaseBackgroundColor(color);
 }
 
+void RenderViewObserverQt::onGrabImage(quint64 requestId, const gfx::Rect &rect, float scale)
+{
+    blink::WebView *webView = render_view()->GetWebView();
+
+    // Blink works in physical pixels when zooming for the device scale factor.
+    float deviceScale = 1.0f;
+    if (content::IsUseZoomForDSFEnabled())
+        deviceScale = render_view()->GetDeviceScaleFactor();
+
+    const gfx::Rect viewRect(gfx::Size(webView->Size()));
+    gfx::Rect area = rect.IsEmpty() ? viewRect : gfx::ScaleToEnclosingRect(rect, deviceScale);
+    area.Intersect(viewRect);
+    if (!std::isfinite(scale) || scale <= 0)
+        area = gfx::Rect();
+    float areaScale = std::min(scale, kMaxGrabScale) / deviceScale;
+    gfx::Size size = gfx::ScaleToCeiledSize(area.size(), areaScale);
+    const int64_t pixels = int64_t(size.width()) * size.height();
+    if (pixels > kMaxGrabImagePixels) {
+        areaScale *= std::sqrt(float(kMaxGrabImagePixels) / pixels);
+        size = gfx::ScaleToFlooredSize(area.size(), areaScale);
+    }
+
+    // Painting at the target scale down-scales while rasterizing, no full size copy is made.
+    SkBitmap bitmap;
+    if (!size.IsEmpty() && bitmap.tryAllocN32Pixels(size.width(), size.height())) {
+        webView->UpdateAllLifecyclePhases();
+        bitmap.eraseColor(SK_ColorTRANSPARENT);
+        cc::SkiaPaintCanvas canvas(bitmap);
+        canvas.scale(areaScale, areaScale);
+        canvas.translate(-area.x(), -area.y());
+        webView->PaintIgnoringCompositing(&canvas, area);
+    }
+    Send(new RenderViewObserverHostQt_DidGrabImage(routing_id(), requestId, bitmap));
+}
+
 void RenderViewObserverQt::OnDestruct()
 {
     delete this;
@@ -94,7 +328,10 @@ bool RenderViewObserverQt::OnMessageReceived(const IPC::Message& message)
     IPC_BEGIN_MESSAGE_MAP(RenderViewObserverQt, message)
         IPC_MESSAGE_HANDLER(RenderViewObserverQt_FetchDocumentMarkup, onFetchDocumentMarkup)
         IPC_MESSAGE_HANDLER(RenderViewObserverQt_FetchDocumentInnerText, onFetchDocumentInnerText)
+        IPC_MESSAGE_HANDLER(RenderViewObserverQt_StreamDocumentContent, onStreamDocumentContent)
+        IPC_MESSAGE_HANDLER(RenderViewObserverQt_DocumentContentChunkAck, onDocumentContentChunkAck)
         IPC_MESSAGE_HANDLER(RenderViewObserverQt_SetBackgroundColor, onSetBackgroundColor)
+        IPC_MESSAGE_HANDLER(RenderViewObserverQt_GrabImage, onGrabImage)
         IPC_MESSAGE_UNHANDLED(handled = false)
     IPC_END_MESSAGE_MAP()
     return handled;
@@ -43,6 +43,19 @@
 
 #include <QtGlobal>
 
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace base {
+class SharedMemory;
+}
+
+namespace gfx {
+class Rect;
+}
+
 namespace web_cache {
 class WebCacheImpl;
 }
@@ -52,10 +65,21 @@ public:
     RenderViewObserverQt(content::RenderView* render_view,
                          web_cache::WebCacheImpl* web_cache_impl);
 
+    ~RenderViewObserverQt();
+
 private:
+    struct DocumentContentStream;
+
     void onFetchDocumentMarkup(quint64 requestId);
     void onFetchDocumentInnerText(quint64 requestId);
+    void onStreamDocumentContent(quint64 requestId, bool markup, qint64 maxBytes,
+                                 const std::vector<std::string> &subframeOrigins);
+    void onDocumentContentChunkAck(quint64 requestId);
     void onSetBackgroundColor(quint32 color);
+    void onGrabImage(quint64 requestId, const gfx::Rect &rect, float scale);
+
+    void sendNextDocumentContentChunk(quint64 requestId);
+    bool serializeNextFrame(DocumentContentStream *stream);
 
     void OnDestruct() override;
 
@@ -63,6 +87,7 @@ private:
     void Navigate(const GURL& url) override;
 
     web_cache::WebCacheImpl* m_web_cache_impl;
+    std::map<quint64, std::unique_ptr<DocumentContentStream>> m_documentContentStreams;
 
     DISALLOW_COPY_AND_ASSIGN(RenderViewObserverQt);
 };
@@ -0,0 +1,114 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#include "renderer/storage_access_policy_qt.h"
+
+#include "common/qt_messages.h"
+
+#include "net/base/registry_controlled_domains/registry_controlled_domain.h"
+
+#include <QtGlobal>
+
+namespace QtWebEngineCore {
+
+// A renderer rarely sees more origin pairs, and a miss only costs another IPC to the browser.
+static const size_t kMaxCookieFilterResults = 256;
+
+Q_GLOBAL_STATIC(StorageAccessPolicyQt, qt_webengine_storageAccessPolicy)
+
+StorageAccessPolicyQt *StorageAccessPolicyQt::instance()
+{
+    return qt_webengine_storageAccessPolicy();
+}
+
+StorageAccessPolicyQt::StorageAccessPolicyQt()
+    : m_policy(AllowStorageAccess)
+    , m_hasCookieFilter(false)
+    , m_cookieFilterResults(kMaxCookieFilterResults)
+{
+}
+
+base::Optional<bool> StorageAccessPolicyQt::canAccessStorage(const GURL &topOriginUrl, const GURL &originUrl) const
+{
+    switch (m_policy) {
+    case BlockStorageAccess:
+        return false;
+    case BlockThirdPartyStorageAccess:
+        if (!net::registry_controlled_domains::SameDomainOrHost(originUrl, topOriginUrl,
+                                                                net::registry_controlled_domains::INCLUDE_PRIVATE_REGISTRIES))
+            return false;
+        break;
+    case AllowStorageAccess:
+        break;
+    }
+
+    if (!m_hasCookieFilter)
+        return true;
+
+    const auto it = m_cookieFilterResults.Get(std::make_pair(topOriginUrl, originUrl));
+    if (it != m_cookieFilterResults.end())
+        return it->second;
+    return base::nullopt;
+}
+
+void StorageAccessPolicyQt::cacheCookieFilterResult(const GURL &topOriginUrl, const GURL &originUrl, bool allowed)
+{
+    if (m_hasCookieFilter)
+        m_cookieFilterResults.Put(std::make_pair(topOriginUrl, originUrl), allowed);
+}
+
+bool StorageAccessPolicyQt::OnControlMessageReceived(const IPC::Message &message)
+{
+    bool handled = true;
+    IPC_BEGIN_MESSAGE_MAP(StorageAccessPolicyQt, message)
+        IPC_MESSAGE_HANDLER(QtWebEngineMsg_SetStorageAccessPolicy, onSetStorageAccessPolicy)
+        IPC_MESSAGE_UNHANDLED(handled = false)
+    IPC_END_MESSAGE_MAP()
+    return handled;
+}
+
+void StorageAccessPolicyQt::onSetStorageAccessPolicy(int policy, bool hasCookieFilter)
+{
+    m_policy = static_cast<Policy>(policy);
+    m_hasCookieFilter = hasCookieFilter;
+    // Any change may have been a change of the cookie filter.
+    m_cookieFilterResults.Clear();
+}
+
+} // namespace QtWebEngineCore
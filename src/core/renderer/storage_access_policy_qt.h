@@ -0,0 +1,88 @@
+/****************************************************************************
+**
+** Copyright (C) 2018 The Qt Company Ltd.
+** Contact: https://www.qt.io/licensing/
+**
+** This file is part of the QtWebEngine module of the Qt Toolkit.
+**
+** $QT_BEGIN_LICENSE:LGPL$
+** Commercial License Usage
+** Licensees holding valid commercial Qt licenses may use this file in
+** accordance with the commercial license agreement provided with the
+** Software or, alternatively, in accordance with the terms contained in
+** a written agreement between you and The Qt Company. For licensing terms
+** and conditions see https://www.qt.io/terms-conditions. For further
+** information use the contact form at https://www.qt.io/contact-us.
+**
+** GNU Lesser General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU Lesser
+** General Public License version 3 as published by the Free Software
+** Foundation and appearing in the file LICENSE.LGPL3 included in the
+** packaging of this file. Please review the following information to
+** ensure the GNU Lesser General Public License version 3 requirements
+** will be met: https://www.gnu.org/licenses/lgpl-3.0.html.
+**
+** GNU General Public License Usage
+** Alternatively, this file may be used under the terms of the GNU
+** General Public License version 2.0 or (at your option) the GNU General
+** Public license version 3 or any later version approved by the KDE Free
+** Qt Foundation. The licenses are as published by the Free Software
+** Foundation and appearing in the file LICENSE.GPL2 and LICENSE.GPL3
+** included in the packaging of this file. Please review the following
+** information to ensure the GNU General Public License requirements will
+** be met: https://www.gnu.org/licenses/gpl-2.0.html and
+** https://www.gnu.org/licenses/gpl-3.0.html.
+**
+** $QT_END_LICENSE$
+**
+****************************************************************************/
+
+#ifndef STORAGE_ACCESS_POLICY_QT_H
+#define STORAGE_ACCESS_POLICY_QT_H
+
+#include "base/containers/mru_cache.h"
+#include "base/optional.h"
+#include "content/public/renderer/render_thread_observer.h"
+#include "url/gurl.h"
+
+namespace QtWebEngineCore {
+
+// Renderer side snapshot of the profile's storage access policy.
+//
+// Checks are answered locally from the policy. Only when the profile has a
+// cookie filter does the decision need the browser, and then it is cached per
+// origin pair until the browser pushes a new snapshot. Only the most recently
+// used origin pairs are kept.
+class StorageAccessPolicyQt : public content::RenderThreadObserver {
+public:
+    // KEEP IN SYNC with BrowserContextAdapter::StorageAccessPolicy
+    enum Policy {
+        AllowStorageAccess = 0,
+        BlockThirdPartyStorageAccess,
+        BlockStorageAccess
+    };
+
+    static StorageAccessPolicyQt *instance();
+    StorageAccessPolicyQt();
+
+    // Returns the decision if it can be made without asking the browser.
+    base::Optional<bool> canAccessStorage(const GURL &topOriginUrl, const GURL &originUrl) const;
+    void cacheCookieFilterResult(const GURL &topOriginUrl, const GURL &originUrl, bool allowed);
+
+private:
+    // RenderThreadObserver
+    bool OnControlMessageReceived(const IPC::Message &message) override;
+
+    void onSetStorageAccessPolicy(int policy, bool hasCookieFilter);
+
+    Policy m_policy;
+    bool m_hasCookieFilter;
+    // Lookups update the recency of an entry.
+    mutable base::MRUCache<std::pair<GURL, GURL>, bool> m_cookieFilterResults;
+
+    DISALLOW_COPY_AND_ASSIGN(StorageAccessPolicyQt);
+};
+
+} // namespace QtWebEngineCore
+
+#endif // STORAGE_ACCESS_POLICY_QT_H
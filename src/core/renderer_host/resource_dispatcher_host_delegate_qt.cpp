@@ -43,6 +43,7 @@
 
 #include "resource_dispatcher_host_delegate_qt.h"
 
+#include "base/memory/ptr_util.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/render_view_host.h"
 #include "content/public/browser/resource_dispatcher_host.h"
@@ -51,11 +52,44 @@
 
 #include "authentication_dialog_controller.h"
 #include "authentication_dialog_controller_p.h"
+#include "net/http_auth_credential_store_qt.h"
+#include "profile_io_data_qt.h"
+#include "resource_context_qt.h"
 #include "type_conversion.h"
 #include "web_contents_view_qt.h"
 
+#include <set>
+
 namespace QtWebEngineCore {
 
+namespace {
+
+const char kStoredCredentialsAttemptsKey[] = "QtWebEngineStoredHttpAuthAttempts";
+
+// Remembers the challenges a request was already given stored credentials for,
+// so that credentials rejected by the server fall back to asking the page
+// instead of being sent over and over.
+class StoredCredentialsAttempts : public base::SupportsUserData::Data {
+public:
+    static bool tryOnce(net::URLRequest *request, const net::AuthChallengeInfo &authInfo)
+    {
+        StoredCredentialsAttempts *attempts =
+                static_cast<StoredCredentialsAttempts *>(request->GetUserData(kStoredCredentialsAttemptsKey));
+        if (!attempts) {
+            attempts = new StoredCredentialsAttempts;
+            request->SetUserData(kStoredCredentialsAttemptsKey, base::WrapUnique(attempts));
+        }
+        const std::string key = (authInfo.is_proxy ? "proxy " : "") + authInfo.challenger.Serialize()
+                + ' ' + authInfo.scheme + ' ' + authInfo.realm;
+        return attempts->m_challenges.insert(key).second;
+    }
+
+private:
+    std::set<std::string> m_challenges;
+};
+
+} // namespace
+
 ResourceDispatcherHostLoginDelegateQt::ResourceDispatcherHostLoginDelegateQt(net::AuthChallengeInfo *authInfo, net::URLRequest *request)
     : m_authInfo(authInfo)
     , m_request(request)
@@ -64,6 +98,9 @@ ResourceDispatcherHostLoginDelegateQt::ResourceDispatcherHostLoginDelegateQt(net
     const content::ResourceRequestInfo *requestInfo = content::ResourceRequestInfo::ForRequest(request);
     Q_ASSERT(requestInfo);
 
+    if (answerFromCredentialStore(requestInfo))
+        return;
+
     content::BrowserThread::PostTask(
             content::BrowserThread::UI, FROM_HERE,
             base::Bind(&ResourceDispatcherHostLoginDelegateQt::triggerDialog,
@@ -103,6 +140,39 @@ bool ResourceDispatcherHostLoginDelegateQt::isProxy() const
     return m_authInfo->is_proxy;
 }
 
+// Answers the challenge without a round trip to the UI thread when the profile has
+// credentials for it. The answer is posted because the request must not be resumed
+// from within its own OnAuthRequired().
+bool ResourceDispatcherHostLoginDelegateQt::answerFromCredentialStore(const content::ResourceRequestInfo *requestInfo)
+{
+    ResourceContextQt *resourceContext = static_cast<ResourceContextQt *>(requestInfo->GetContext());
+    if (!resourceContext || !resourceContext->profileIOData())
+        return false;
+    HttpAuthCredentialStoreQt *store = resourceContext->profileIOData()->httpAuthCredentialStore();
+    net::AuthCredentials credentials;
+    if (store->isEmpty() || !store->lookup(*m_authInfo, &credentials))
+        return false;
+    if (!StoredCredentialsAttempts::tryOnce(m_request, *m_authInfo))
+        return false;
+
+    content::BrowserThread::PostTask(
+            content::BrowserThread::IO, FROM_HERE,
+            base::Bind(&ResourceDispatcherHostLoginDelegateQt::sendStoredCredentials, this, credentials));
+    return true;
+}
+
+void ResourceDispatcherHostLoginDelegateQt::sendStoredCredentials(const net::AuthCredentials &credentials)
+{
+    Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::IO));
+    if (!m_request)
+        return;
+
+    m_request->SetAuth(credentials);
+    content::ResourceDispatcherHost::Get()->ClearLoginDelegateForRequest(m_request);
+
+    destroy();
+}
+
 void ResourceDispatcherHostLoginDelegateQt::triggerDialog(const content::ResourceRequestInfo::WebContentsGetter &webContentsGetter)
 {
     Q_ASSERT(content::BrowserThread::CurrentlyOn(content::BrowserThread::UI));
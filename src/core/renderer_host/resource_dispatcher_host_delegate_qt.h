@@ -65,6 +65,8 @@ public:
     void sendAuthToRequester(bool success, const QString &user, const QString &password);
 
 private:
+    bool answerFromCredentialStore(const content::ResourceRequestInfo *requestInfo);
+    void sendStoredCredentials(const net::AuthCredentials &credentials);
     void triggerDialog(const content::ResourceRequestInfo::WebContentsGetter &);
     void destroy();
 
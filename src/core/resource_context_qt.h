@@ -52,6 +52,7 @@ public:
     ResourceContextQt(ProfileIODataQt *io_data);
     net::HostResolver *GetHostResolver() override;
     net::URLRequestContext *GetRequestContext() override;
+    ProfileIODataQt *profileIOData() const { return m_io_data; }
 private:
     ProfileIODataQt* m_io_data;
     DISALLOW_COPY_AND_ASSIGN(ResourceContextQt);
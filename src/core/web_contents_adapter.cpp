@@ -43,13 +43,19 @@
 
 #include "web_contents_adapter.h"
 
+#include "browser_accessibility_manager_qt.h"
 #include "browser_accessibility_qt.h"
 #include "browser_context_adapter_client.h"
 #include "browser_context_adapter.h"
 #include "devtools_frontend_qt.h"
 #include "download_manager_delegate_qt.h"
 #include "media_capture_devices_dispatcher.h"
+#include "net/network_metrics_qt.h"
+#include "net/qrc_protocol_handler_qt.h"
+#include "net/url_request_content_job_qt.h"
+#include "origin_pattern.h"
 #include "printing/print_view_manager_qt.h"
+#include "profile_io_data_qt.h"
 #include "profile_qt.h"
 #include "qwebenginecallback_p.h"
 #include "renderer_host/web_channel_ipc_transport_host.h"
@@ -59,8 +65,17 @@
 #include "web_engine_context.h"
 #include "web_engine_settings.h"
 
+#include "base/base64.h"
 #include "base/command_line.h"
+#include "base/files/file.h"
+#include "base/files/file_util.h"
+#include "base/json/string_escape.h"
 #include "base/run_loop.h"
+#include "base/sequenced_task_runner.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/task_runner_util.h"
+#include "base/task_scheduler/post_task.h"
+#include "base/threading/thread_task_runner_handle.h"
 #include "base/values.h"
 #include "content/browser/renderer_host/render_view_host_impl.h"
 #include "content/browser/web_contents/web_contents_impl.h"
@@ -68,7 +83,9 @@
 #include "content/public/browser/devtools_agent_host.h"
 #include <content/public/browser/download_manager.h>
 #include "content/public/browser/host_zoom_map.h"
+#include "content/public/browser/invalidate_type.h"
 #include "content/public/browser/navigation_entry.h"
+#include "content/public/browser/render_frame_host.h"
 #include "content/public/browser/render_view_host.h"
 #include "content/public/browser/favicon_status.h"
 #include "content/public/common/content_constants.h"
@@ -82,18 +99,26 @@
 #include "content/public/common/webrtc_ip_handling_policy.h"
 #include "third_party/WebKit/public/web/WebFindOptions.h"
 #include "printing/features/features.h"
+#include "services/network/public/cpp/resource_request_body.h"
 #include "ui/base/clipboard/clipboard.h"
 #include "ui/base/clipboard/custom_data_helper.h"
 #include "ui/gfx/font_render_params.h"
+#include "ui/gfx/geometry/rect.h"
+#include "url/origin.h"
 
 #include <QDir>
 #include <QGuiApplication>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonValue>
 #include <QPageLayout>
 #include <QStringList>
 #include <QStyleHints>
 #include <QTimer>
 #include <QVariant>
+#include <QtCore/qendian.h>
 #include <QtCore/qelapsedtimer.h>
+#include <QtCore/qfiledevice.h>
 #include <QtCore/qmimedata.h>
 #include <QtCore/qtemporarydir.h>
 #include <QtGui/qaccessible.h>
@@ -101,6 +126,11 @@
 #include <QtGui/qpixmap.h>
 #include <QtWebChannel/QWebChannel>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <set>
+
 namespace QtWebEngineCore {
 
 #define CHECK_INITIALIZED(return_value)         \
@@ -193,10 +223,303 @@ static QVariant fromJSValue(const base::Value *result)
     return ret;
 }
 
-static void callbackOnEvaluateJS(WebContentsAdapterClient *adapterClient, quint64 requestId, const base::Value *result)
+// Writes |value| as JSON without building an intermediate QVariant tree.
+// JSON has no binary type, so binary values are written as base64 strings.
+static void appendJSValueAsJson(const base::Value *value, std::string *out)
+{
+    switch (value->type()) {
+    case base::Value::Type::NONE:
+        out->append("null");
+        break;
+    case base::Value::Type::BOOLEAN:
+        out->append(value->GetBool() ? "true" : "false");
+        break;
+    case base::Value::Type::INTEGER:
+        out->append(base::IntToString(value->GetInt()));
+        break;
+    case base::Value::Type::DOUBLE:
+    {
+        const double number = value->GetDouble();
+        out->append(std::isfinite(number) ? base::DoubleToString(number) : std::string("null"));
+        break;
+    }
+    case base::Value::Type::STRING:
+        base::EscapeJSONString(value->GetString(), true, out);
+        break;
+    case base::Value::Type::BINARY:
+    {
+        std::string encoded;
+        base::Base64Encode(base::StringPiece(value->GetBlob().data(), value->GetBlob().size()), &encoded);
+        out->push_back('"');
+        out->append(encoded);
+        out->push_back('"');
+        break;
+    }
+    case base::Value::Type::LIST:
+    {
+        out->push_back('[');
+        bool first = true;
+        for (const base::Value &item : value->GetList()) {
+            if (!first)
+                out->push_back(',');
+            first = false;
+            appendJSValueAsJson(&item, out);
+        }
+        out->push_back(']');
+        break;
+    }
+    case base::Value::Type::DICTIONARY:
+    {
+        out->push_back('{');
+        bool first = true;
+        for (const auto &item : value->DictItems()) {
+            if (!first)
+                out->push_back(',');
+            first = false;
+            base::EscapeJSONString(item.first, true, out);
+            out->push_back(':');
+            appendJSValueAsJson(&item.second, out);
+        }
+        out->push_back('}');
+        break;
+    }
+    default:
+        Q_UNREACHABLE();
+        break;
+    }
+}
+
+static void appendCborHead(QByteArray *out, quint8 majorType, quint64 argument)
+{
+    const char type = char(majorType << 5);
+    uchar bytes[8];
+    if (argument < 24) {
+        out->append(char(type | argument));
+    } else if (argument <= 0xff) {
+        out->append(char(type | 24));
+        out->append(char(argument));
+    } else if (argument <= 0xffff) {
+        out->append(char(type | 25));
+        qToBigEndian(quint16(argument), bytes);
+        out->append(reinterpret_cast<const char *>(bytes), 2);
+    } else if (argument <= 0xffffffff) {
+        out->append(char(type | 26));
+        qToBigEndian(quint32(argument), bytes);
+        out->append(reinterpret_cast<const char *>(bytes), 4);
+    } else {
+        out->append(char(type | 27));
+        qToBigEndian(argument, bytes);
+        out->append(reinterpret_cast<const char *>(bytes), 8);
+    }
+}
+
+// Writes |value| in the Concise Binary Object Representation (RFC 7049).
+// Binary values are written as byte strings.
+static void appendJSValueAsCbor(const base::Value *value, QByteArray *out)
+{
+    switch (value->type()) {
+    case base::Value::Type::NONE:
+        out->append(char(0xf6));
+        break;
+    case base::Value::Type::BOOLEAN:
+        out->append(char(value->GetBool() ? 0xf5 : 0xf4));
+        break;
+    case base::Value::Type::INTEGER:
+    {
+        const qint64 number = value->GetInt();
+        if (number >= 0)
+            appendCborHead(out, 0, quint64(number));
+        else
+            appendCborHead(out, 1, quint64(-1 - number));
+        break;
+    }
+    case base::Value::Type::DOUBLE:
+    {
+        const double number = value->GetDouble();
+        quint64 bits;
+        memcpy(&bits, &number, sizeof(bits));
+        uchar bytes[8];
+        qToBigEndian(bits, bytes);
+        out->append(char(0xfb));
+        out->append(reinterpret_cast<const char *>(bytes), 8);
+        break;
+    }
+    case base::Value::Type::STRING:
+    {
+        const std::string &string = value->GetString();
+        appendCborHead(out, 3, string.size());
+        out->append(string.data(), int(string.size()));
+        break;
+    }
+    case base::Value::Type::BINARY:
+        appendCborHead(out, 2, value->GetBlob().size());
+        out->append(value->GetBlob().data(), int(value->GetBlob().size()));
+        break;
+    case base::Value::Type::LIST:
+        appendCborHead(out, 4, value->GetList().size());
+        for (const base::Value &item : value->GetList())
+            appendJSValueAsCbor(&item, out);
+        break;
+    case base::Value::Type::DICTIONARY:
+    {
+        const base::DictionaryValue *dictionary = nullptr;
+        value->GetAsDictionary(&dictionary);
+        appendCborHead(out, 5, dictionary->size());
+        for (const auto &item : value->DictItems()) {
+            appendCborHead(out, 3, item.first.size());
+            out->append(item.first.data(), int(item.first.size()));
+            appendJSValueAsCbor(&item.second, out);
+        }
+        break;
+    }
+    default:
+        Q_UNREACHABLE();
+        break;
+    }
+}
+
+static QVariant convertJSResult(const base::Value *result, WebContentsAdapterClient::JavaScriptResultFormat format)
+{
+    switch (format) {
+    case WebContentsAdapterClient::VariantResult:
+        break;
+    case WebContentsAdapterClient::JsonResult:
+    {
+        std::string json;
+        appendJSValueAsJson(result, &json);
+        return QByteArray(json.data(), int(json.size()));
+    }
+    case WebContentsAdapterClient::CborResult:
+    {
+        QByteArray cbor;
+        appendJSValueAsCbor(result, &cbor);
+        return cbor;
+    }
+    case WebContentsAdapterClient::JsonValueResult:
+    {
+        // QJsonDocument keeps the parsed value in its compact binary form and only
+        // creates values as they are accessed. It needs an array or object at the top.
+        std::string json("[");
+        appendJSValueAsJson(result, &json);
+        json.push_back(']');
+        const QJsonDocument document = QJsonDocument::fromJson(QByteArray::fromRawData(json.data(), int(json.size())));
+        return QVariant::fromValue(document.array().at(0));
+    }
+    }
+    return fromJSValue(result);
+}
+
+// Collects the results of a script evaluated in several frames, and reports them as one
+// list when every frame replied or went away, or the deadline passed, whichever happens
+// first. Replies arriving after that are dropped.
+class FrameScriptEvaluation : public base::RefCounted<FrameScriptEvaluation> {
+public:
+    FrameScriptEvaluation(QWeakPointer<WebContentsAdapter> adapter, WebContentsAdapterClient *adapterClient, quint64 requestId)
+        : m_adapter(adapter)
+        , m_adapterClient(adapterClient)
+        , m_requestId(requestId)
+    {
+    }
+
+    int addFrame(content::RenderFrameHost *frame)
+    {
+        QVariantMap entry;
+        entry.insert(QStringLiteral("url"), toQt(frame->GetLastCommittedURL()));
+        entry.insert(QStringLiteral("origin"), QString::fromStdString(frame->GetLastCommittedOrigin().Serialize()));
+        entry.insert(QStringLiteral("frameName"), toQt(frame->GetFrameName()));
+        entry.insert(QStringLiteral("timedOut"), true);
+        m_results.append(entry);
+        ++m_pending;
+        return m_results.size() - 1;
+    }
+
+    void frameReplied(int index, const base::Value *result)
+    {
+        if (m_finished)
+            return;
+        QVariantMap entry = m_results.at(index).toMap();
+        entry.insert(QStringLiteral("result"), fromJSValue(result));
+        entry.insert(QStringLiteral("timedOut"), false);
+        m_results[index] = entry;
+        if (--m_pending == 0)
+            finish();
+    }
+
+    // The frame went away and dropped its callback without running it.
+    void frameGone()
+    {
+        if (!m_finished && --m_pending == 0)
+            finish();
+    }
+
+    // Called once all frames were added, finishes right away if none matched.
+    void started()
+    {
+        if (--m_pending == 0)
+            finish();
+    }
+
+    void finish()
+    {
+        if (m_finished)
+            return;
+        m_finished = true;
+        if (m_adapter.toStrongRef())
+            m_adapterClient->didRunJavaScript(m_requestId, m_results);
+    }
+
+private:
+    friend class base::RefCounted<FrameScriptEvaluation>;
+    ~FrameScriptEvaluation() {}
+
+    QWeakPointer<WebContentsAdapter> m_adapter;
+    WebContentsAdapterClient *m_adapterClient;
+    quint64 m_requestId;
+    QVariantList m_results;
+    int m_pending = 1;
+    bool m_finished = false;
+};
+
+// Bound to the result callback of a frame, so the evaluation also learns about frames
+// that are destroyed before they reply and drop the callback unrun.
+class FrameScriptReply {
+public:
+    FrameScriptReply(scoped_refptr<FrameScriptEvaluation> evaluation, int index)
+        : m_evaluation(evaluation)
+        , m_index(index)
+    {
+    }
+
+    ~FrameScriptReply()
+    {
+        // The frame host is being destroyed, so the evaluation is not finished from in here.
+        if (m_evaluation)
+            base::ThreadTaskRunnerHandle::Get()->PostTask(FROM_HERE, base::Bind(&FrameScriptEvaluation::frameGone, m_evaluation));
+    }
+
+    void replied(const base::Value *result)
+    {
+        m_evaluation->frameReplied(m_index, result);
+        m_evaluation = nullptr;
+    }
+
+private:
+    scoped_refptr<FrameScriptEvaluation> m_evaluation;
+    int m_index;
+
+    DISALLOW_COPY_AND_ASSIGN(FrameScriptReply);
+};
+
+static void callbackOnEvaluateJSInFrame(std::unique_ptr<FrameScriptReply> reply, const base::Value *result)
+{
+    reply->replied(result);
+}
+
+static void callbackOnEvaluateJS(WebContentsAdapterClient *adapterClient, quint64 requestId,
+                                 WebContentsAdapterClient::JavaScriptResultFormat format, const base::Value *result)
 {
     if (requestId)
-        adapterClient->didRunJavaScript(requestId, fromJSValue(result));
+        adapterClient->didRunJavaScript(requestId, convertJSResult(result, format));
 }
 
 #if BUILDFLAG(ENABLE_BASIC_PRINTING)
@@ -259,6 +582,21 @@ static void serializeNavigationHistory(const content::NavigationController &cont
     }
 }
 
+// The extra headers of the entries written by serializeNavigationHistory(), in the same order.
+static std::vector<std::string> navigationEntryExtraHeaders(const content::NavigationController &controller)
+{
+    std::vector<std::string> extraHeaders;
+    const int pendingIndex = controller.GetPendingEntryIndex();
+    for (int i = 0; i < controller.GetEntryCount(); ++i) {
+        const content::NavigationEntry* entry = (i == pendingIndex)
+            ? controller.GetPendingEntry()
+            : controller.GetEntryAtIndex(i);
+        if (entry->GetVirtualURL().is_valid())
+            extraHeaders.push_back(entry->GetExtraHeaders());
+    }
+    return extraHeaders;
+}
+
 static void deserializeNavigationHistory(QDataStream &input, int *currentIndex, std::vector<std::unique_ptr<content::NavigationEntry>> *entries, content::BrowserContext *browserContext)
 {
     int version;
@@ -329,6 +667,12 @@ static void deserializeNavigationHistory(QDataStream &input, int *currentIndex,
     }
 }
 
+static void deleteUploadSpoolFile(const base::FilePath &path)
+{
+    base::PostTaskWithTraits(FROM_HERE, {base::MayBlock(), base::TaskPriority::BACKGROUND},
+                             base::BindOnce(base::IgnoreResult(&base::DeleteFile), path, false));
+}
+
 namespace {
 static QList<WebContentsAdapter *> recursive_guard_loading_adapters;
 
@@ -391,6 +735,12 @@ WebContentsAdapter::WebContentsAdapter(content::WebContents *webContents)
   , m_lastFindRequestId(0)
   , m_currentDropAction(blink::kWebDragOperationNone)
   , m_devToolsFrontend(nullptr)
+  , m_lifecycleState(LifecycleState::Active)
+  , m_visible(false)
+  , m_consoleMessageMinimumLevel(WebContentsAdapterClient::Info)
+  , m_consoleMessageRateLimit(0)
+  , m_accessibilityEventRateLimit(0)
+  , m_uploadSpoolId(0)
 {
     // This has to be the first thing we create, and the last we destroy.
     WebEngineContext::current();
@@ -398,6 +748,15 @@ WebContentsAdapter::WebContentsAdapter(content::WebContents *webContents)
 
 WebContentsAdapter::~WebContentsAdapter()
 {
+    // The client has already finished its pending callbacks when its adapter is destroyed.
+    if (m_renderViewObserverHost)
+        m_renderViewObserverHost->detachClient();
+    for (const std::string &token : m_contentResourceTokens)
+        contentResourceRegistry()->remove(token);
+    for (const QString &filePath : qAsConst(m_uploadSpoolFiles))
+        deleteUploadSpoolFile(toFilePath(filePath));
+    if (isInitialized())
+        m_browserContextAdapter->removeWebContentsAdapter(this);
     if (m_devToolsFrontend)
         closeDevToolsFrontend();
     Q_ASSERT(!m_devToolsFrontend);
@@ -432,6 +791,29 @@ void WebContentsAdapter::initialize(content::SiteInstance *site)
         m_webContents.reset(content::WebContents::Create(create_params));
     }
 
+    initializeRendererPrefs();
+    initializeObservers();
+
+    // This should only be necessary after having restored the history to a new WebContentsAdapter.
+    m_webContents->GetController().LoadIfNecessary();
+
+    // Create an instance of WebEngineVisitedLinksManager to catch the first
+    // content::NOTIFICATION_RENDERER_PROCESS_CREATED event. This event will
+    // force to initialize visited links in VisitedLinkSlave.
+    // It must be done before creating a RenderView.
+    m_browserContextAdapter->visitedLinksManager();
+
+    createRenderViewIfNecessary();
+
+    m_browserContextAdapter->addWebContentsAdapter(this);
+    if (!m_visible)
+        m_hiddenTimer.start();
+
+    m_adapterClient->initializationFinished();
+}
+
+void WebContentsAdapter::initializeRendererPrefs()
+{
     content::RendererPreferences* rendererPrefs = m_webContents->GetMutableRendererPrefs();
     rendererPrefs->use_custom_colors = true;
     // Qt returns a flash time (the whole cycle) in ms, chromium expects just the interval in seconds
@@ -458,35 +840,32 @@ void WebContentsAdapter::initialize(content::SiteInstance *site)
     rendererPrefs->use_bitmaps = params.use_bitmaps;
     rendererPrefs->subpixel_rendering = params.subpixel_rendering;
     m_webContents->GetRenderViewHost()->SyncRendererPrefs();
+}
 
+void WebContentsAdapter::initializeObservers(NetworkMetricsQt *networkMetrics)
+{
     // Create and attach observers to the WebContents.
-    m_webContentsDelegate.reset(new WebContentsDelegateQt(m_webContents.get(), m_adapterClient));
+    m_webContentsDelegate.reset(new WebContentsDelegateQt(m_webContents.get(), m_adapterClient, networkMetrics));
     m_renderViewObserverHost.reset(new RenderViewObserverHostQt(m_webContents.get(), m_adapterClient));
+    if (m_consoleMessageMinimumLevel != WebContentsAdapterClient::Info || m_consoleMessageRateLimit)
+        m_webContentsDelegate->setConsoleMessageFilter(m_consoleMessageMinimumLevel, m_consoleMessageRateLimit);
 
     // Let the WebContent's view know about the WebContentsAdapterClient.
     WebContentsViewQt* contentsView = static_cast<WebContentsViewQt*>(static_cast<content::WebContentsImpl*>(m_webContents.get())->GetView());
     contentsView->initialize(m_adapterClient);
 
-    // This should only be necessary after having restored the history to a new WebContentsAdapter.
-    m_webContents->GetController().LoadIfNecessary();
-
 #if BUILDFLAG(ENABLE_BASIC_PRINTING)
     PrintViewManagerQt::CreateForWebContents(webContents());
 #endif // BUILDFLAG(ENABLE_BASIC_PRINTING)
+}
 
-    // Create an instance of WebEngineVisitedLinksManager to catch the first
-    // content::NOTIFICATION_RENDERER_PROCESS_CREATED event. This event will
-    // force to initialize visited links in VisitedLinkSlave.
-    // It must be done before creating a RenderView.
-    m_browserContextAdapter->visitedLinksManager();
-
+void WebContentsAdapter::createRenderViewIfNecessary()
+{
     // Create a RenderView with the initial empty document
     content::RenderViewHost *rvh = m_webContents->GetRenderViewHost();
     Q_ASSERT(rvh);
     if (!rvh->IsRenderViewLive())
         static_cast<content::WebContentsImpl*>(m_webContents.get())->CreateRenderViewForRenderManager(rvh, MSG_ROUTING_NONE, MSG_ROUTING_NONE, base::UnguessableToken::Create(), content::FrameReplicationState());
-
-    m_adapterClient->initializationFinished();
 }
 
 void WebContentsAdapter::reattachRWHV()
@@ -517,6 +896,7 @@ void WebContentsAdapter::stop()
     if (index != -1)
         controller.RemoveEntryAtIndex(index);
 
+    cancelUploadSpool();
     m_webContents->Stop();
     focusIfNecessary();
 }
@@ -524,6 +904,7 @@ void WebContentsAdapter::stop()
 void WebContentsAdapter::reload()
 {
     CHECK_INITIALIZED();
+    wakeUp();
     CHECK_VALID_RENDER_WIDGET_HOST_VIEW(m_webContents->GetRenderViewHost());
     m_webContents->GetController().Reload(content::ReloadType::NORMAL, /*checkRepost = */false);
     focusIfNecessary();
@@ -532,6 +913,7 @@ void WebContentsAdapter::reload()
 void WebContentsAdapter::reloadAndBypassCache()
 {
     CHECK_INITIALIZED();
+    wakeUp();
     CHECK_VALID_RENDER_WIDGET_HOST_VIEW(m_webContents->GetRenderViewHost());
     m_webContents->GetController().Reload(content::ReloadType::BYPASSING_CACHE, /*checkRepost = */false);
     focusIfNecessary();
@@ -549,6 +931,160 @@ void WebContentsAdapter::load(const QUrl &url)
     load(request);
 }
 
+static const qint64 kUploadSpoolChunkSize = 64 * 1024;
+
+// Returns the file a device passed to QWebEngineHttpRequest::setPostDataDevice() can be
+// uploaded from directly, or an empty string if the device has to be spooled first.
+static QString uploadDeviceFile(QIODevice *device)
+{
+    QFileDevice *fileDevice = qobject_cast<QFileDevice *>(device);
+    if (!fileDevice || device->isSequential() || fileDevice->fileName().startsWith(QLatin1Char(':')))
+        return QString();
+    return fileDevice->fileName();
+}
+
+static base::FilePath createUploadSpoolFile(base::File *file)
+{
+    base::FilePath path;
+    if (!base::CreateTemporaryFile(&path))
+        return base::FilePath();
+    file->Initialize(path, base::File::FLAG_OPEN | base::File::FLAG_WRITE);
+    if (!file->IsValid()) {
+        base::DeleteFile(path, false);
+        return base::FilePath();
+    }
+    return path;
+}
+
+static bool writeUploadSpoolChunk(base::File *file, const QByteArray &chunk)
+{
+    return file->WriteAtCurrentPos(chunk.constData(), chunk.size()) == chunk.size();
+}
+
+static bool closeUploadSpoolFile(base::File *file)
+{
+    const bool flushed = file->Flush();
+    file->Close();
+    return flushed;
+}
+
+// Copies what is left to read from the POST data device of a request into a temporary file
+// before its navigation is started, so that it can be uploaded from there without holding
+// the whole body in memory. The device is read on the UI thread it belongs to, one chunk at a
+// time, while the file is created and written on a blocking task runner.
+class UploadSpoolJob : public base::RefCounted<UploadSpoolJob> {
+public:
+    UploadSpoolJob(QWeakPointer<WebContentsAdapter> adapter, quint64 id, const QWebEngineHttpRequest &request)
+        : m_adapter(adapter)
+        , m_id(id)
+        , m_request(request)
+        , m_taskRunner(base::CreateSequencedTaskRunnerWithTraits({base::MayBlock(), base::TaskPriority::USER_VISIBLE}))
+        , m_file(new base::File, base::OnTaskRunnerDeleter(m_taskRunner))
+    {
+    }
+
+    void start()
+    {
+        base::PostTaskAndReplyWithResult(m_taskRunner.get(), FROM_HERE,
+                                         base::Bind(&createUploadSpoolFile, base::Unretained(m_file.get())),
+                                         base::Bind(&UploadSpoolJob::fileCreated, this));
+    }
+
+private:
+    friend class base::RefCounted<UploadSpoolJob>;
+    ~UploadSpoolJob() {}
+
+    // Another navigation cancels the spooling by replacing the id of the adapter.
+    WebContentsAdapter *adapter() const
+    {
+        WebContentsAdapter *adapter = m_adapter.data();
+        return adapter && adapter->m_uploadSpoolId == m_id ? adapter : nullptr;
+    }
+
+    void fileCreated(const base::FilePath &path)
+    {
+        m_path = path;
+        if (path.empty())
+            finish(false);
+        else
+            readChunk();
+    }
+
+    void readChunk()
+    {
+        QIODevice *device = m_request.postDataDevice();
+        if (!adapter() || !device || !device->isReadable()) {
+            finish(false);
+            return;
+        }
+        QByteArray chunk(kUploadSpoolChunkSize, Qt::Uninitialized);
+        const qint64 bytesRead = device->read(chunk.data(), chunk.size());
+        if (bytesRead < 0) {
+            finish(false);
+            return;
+        }
+        if (bytesRead == 0) {
+            base::PostTaskAndReplyWithResult(m_taskRunner.get(), FROM_HERE,
+                                             base::Bind(&closeUploadSpoolFile, base::Unretained(m_file.get())),
+                                             base::Bind(&UploadSpoolJob::finish, this));
+            return;
+        }
+        chunk.resize(bytesRead);
+        base::PostTaskAndReplyWithResult(m_taskRunner.get(), FROM_HERE,
+                                         base::Bind(&writeUploadSpoolChunk, base::Unretained(m_file.get()), chunk),
+                                         base::Bind(&UploadSpoolJob::chunkWritten, this));
+    }
+
+    void chunkWritten(bool success)
+    {
+        if (success)
+            readChunk();
+        else
+            finish(false);
+    }
+
+    void finish(bool success)
+    {
+        WebContentsAdapter *adapter = this->adapter();
+        if (!success || !adapter) {
+            if (!m_path.empty())
+                deleteUploadSpoolFile(m_path);
+            if (adapter)
+                adapter->uploadSpoolFinished(m_request, QString());
+            return;
+        }
+        adapter->uploadSpoolFinished(m_request, toQt(m_path.value()));
+    }
+
+    QWeakPointer<WebContentsAdapter> m_adapter;
+    quint64 m_id;
+    QWebEngineHttpRequest m_request;
+    scoped_refptr<base::SequencedTaskRunner> m_taskRunner;
+    // Only used on m_taskRunner, which also closes and deletes it.
+    std::unique_ptr<base::File, base::OnTaskRunnerDeleter> m_file;
+    base::FilePath m_path;
+};
+
+// Builds a file-backed request body for a request whose POST data is given as a file, or as a
+// device that can be read from its file. Chromium reads and uploads such files in chunks.
+static scoped_refptr<network::ResourceRequestBody> createUploadBody(const QWebEngineHttpRequest &request)
+{
+    QString filePath = request.postDataFile();
+    qint64 offset = 0;
+    if (QIODevice *device = request.postDataDevice()) {
+        if (!device->isReadable())
+            return nullptr;
+        filePath = uploadDeviceFile(device);
+        offset = device->pos();
+    }
+    if (filePath.isEmpty())
+        return nullptr;
+
+    scoped_refptr<network::ResourceRequestBody> body = new network::ResourceRequestBody;
+    body->AppendFileRange(toFilePath(filePath), offset, std::numeric_limits<uint64_t>::max(), base::Time());
+    return body;
+}
+
 void WebContentsAdapter::load(const QWebEngineHttpRequest &request)
 {
     GURL gurl = toGurl(request.url());
@@ -557,6 +1093,7 @@ void WebContentsAdapter::load(const QWebEngineHttpRequest &request)
             content::SiteInstance::CreateForURL(m_browserContextAdapter->browserContext(), gurl);
         initialize(site.get());
     }
+    wakeUp();
 
     CHECK_VALID_RENDER_WIDGET_HOST_VIEW(m_webContents->GetRenderViewHost());
 
@@ -608,9 +1145,29 @@ void WebContentsAdapter::load(const QWebEngineHttpRequest &request)
         break;
     }
 
-    params.post_data = network::ResourceRequestBody::CreateFromBytes(
-                (const char*)request.postData().constData(),
-                request.postData().length());
+    cancelUploadSpool();
+    pruneUploadSpoolFiles();
+    if (request.method() == QWebEngineHttpRequest::Post
+            && (!request.postDataFile().isEmpty() || request.postDataDevice())) {
+        QIODevice *device = request.postDataDevice();
+        if (device && device->isReadable() && uploadDeviceFile(device).isEmpty()) {
+            scoped_refptr<UploadSpoolJob> job(new UploadSpoolJob(sharedFromThis().toWeakRef(), m_uploadSpoolId, request));
+            job->start();
+            return;
+        }
+        params.post_data = createUploadBody(request);
+        if (!params.post_data) {
+            m_adapterClient->loadFinished(false, request.url(), false,
+                                           net::ERR_FAILED,
+                                           QCoreApplication::translate("WebContentsAdapter",
+                                           "HTTP-POST data could not be read"));
+            return;
+        }
+    } else {
+        params.post_data = network::ResourceRequestBody::CreateFromBytes(
+                    (const char*)request.postData().constData(),
+                    request.postData().length());
+    }
 
     // convert the custom headers into the format that chromium expects
     QVector<QByteArray> headers = request.headers();
@@ -643,38 +1200,149 @@ void WebContentsAdapter::load(const QWebEngineHttpRequest &request)
     }
 }
 
+static bool canServeContentFrom(BrowserContextAdapter *browserContextAdapter, const GURL &baseUrl)
+{
+    // Only URLs that are loaded through the network stack can be intercepted.
+    if (!baseUrl.is_valid())
+        return false;
+    if (baseUrl.SchemeIsHTTPOrHTTPS() || baseUrl.SchemeIsFile() || baseUrl.SchemeIs(kQrcSchemeQt))
+        return true;
+    return browserContextAdapter->customUrlSchemeHandlers().contains(QByteArray::fromStdString(baseUrl.scheme()));
+}
+
 void WebContentsAdapter::setContent(const QByteArray &data, const QString &mimeType, const QUrl &baseUrl)
 {
     if (!isInitialized())
         loadDefault();
+    wakeUp();
 
     CHECK_VALID_RENDER_WIDGET_HOST_VIEW(m_webContents->GetRenderViewHost());
 
-    QByteArray encodedData = data.toPercentEncoding();
-    std::string urlString;
-    if (!mimeType.isEmpty())
-        urlString = std::string("data:") + mimeType.toStdString() + std::string(",");
-    else
-        urlString = std::string("data:text/plain;charset=US-ASCII,");
-    urlString.append(encodedData.constData(), encodedData.length());
+    cancelUploadSpool();
+    pruneContentResources();
+
+    const GURL baseGurl = toGurl(baseUrl);
+    std::unique_ptr<content::NavigationController::LoadURLParams> params;
+    if (canServeContentFrom(m_browserContextAdapter, baseGurl)) {
+        // Navigate to the base URL itself and serve the data from memory, so that the
+        // size of the content is not limited by the maximum length of a data: URL.
+        const std::string token = contentResourceRegistry()->add(data, mimeType,
+                                                                 m_webContents->GetMainFrame()->GetFrameTreeNodeId());
+        m_contentResourceTokens.push_back(token);
+        params.reset(new content::NavigationController::LoadURLParams(baseGurl));
+        params->extra_headers = std::string(kContentResourceHeaderQt) + ": " + token;
+    } else {
+        QByteArray encodedData = data.toPercentEncoding();
+        std::string urlString;
+        if (!mimeType.isEmpty())
+            urlString = std::string("data:") + mimeType.toStdString() + std::string(",");
+        else
+            urlString = std::string("data:text/plain;charset=US-ASCII,");
+        urlString.append(encodedData.constData(), encodedData.length());
 
-    GURL dataUrlToLoad(urlString);
-    if (dataUrlToLoad.spec().size() > url::kMaxURLChars) {
-        m_adapterClient->loadFinished(false, baseUrl, false, net::ERR_ABORTED);
-        return;
+        GURL dataUrlToLoad(urlString);
+        if (dataUrlToLoad.spec().size() > url::kMaxURLChars) {
+            m_adapterClient->loadFinished(false, baseUrl, false, net::ERR_ABORTED);
+            return;
+        }
+        params.reset(new content::NavigationController::LoadURLParams(dataUrlToLoad));
+        params->load_type = content::NavigationController::LOAD_TYPE_DATA;
+        params->base_url_for_data_url = baseGurl;
+        params->virtual_url_for_data_url = baseUrl.isEmpty() ? GURL(url::kAboutBlankURL) : baseGurl;
     }
-    content::NavigationController::LoadURLParams params((dataUrlToLoad));
-    params.load_type = content::NavigationController::LOAD_TYPE_DATA;
-    params.base_url_for_data_url = toGurl(baseUrl);
-    params.virtual_url_for_data_url = baseUrl.isEmpty() ? GURL(url::kAboutBlankURL) : toGurl(baseUrl);
-    params.can_load_local_resources = true;
-    params.transition_type = ui::PageTransitionFromInt(ui::PAGE_TRANSITION_TYPED | ui::PAGE_TRANSITION_FROM_API);
-    params.override_user_agent = content::NavigationController::UA_OVERRIDE_TRUE;
-    m_webContents->GetController().LoadURLWithParams(params);
+    params->can_load_local_resources = true;
+    params->transition_type = ui::PageTransitionFromInt(ui::PAGE_TRANSITION_TYPED | ui::PAGE_TRANSITION_FROM_API);
+    params->override_user_agent = content::NavigationController::UA_OVERRIDE_TRUE;
+    m_webContents->GetController().LoadURLWithParams(*params);
     focusIfNecessary();
     m_webContents->CollapseSelection();
 }
 
+ContentResourceRegistryQt *WebContentsAdapter::contentResourceRegistry() const
+{
+    return m_browserContextAdapter->browserContext()->m_profileIOData->contentResourceRegistry();
+}
+
+// The content of earlier setContent() calls is kept for as long as the navigation history
+// refers to it, like the data: URLs it replaces, so that going back to it keeps working.
+void WebContentsAdapter::pruneContentResources()
+{
+    if (m_contentResourceTokens.empty())
+        return;
+
+    std::set<std::string> referencedTokens;
+    const content::NavigationController &controller = m_webContents->GetController();
+    for (int i = 0; i < controller.GetEntryCount(); ++i)
+        referencedTokens.insert(ContentResourceRegistryQt::token(controller.GetEntryAtIndex(i)->GetExtraHeaders()));
+    if (const content::NavigationEntry *pendingEntry = controller.GetPendingEntry())
+        referencedTokens.insert(ContentResourceRegistryQt::token(pendingEntry->GetExtraHeaders()));
+
+    ContentResourceRegistryQt *registry = contentResourceRegistry();
+    auto unreferenced = std::remove_if(m_contentResourceTokens.begin(), m_contentResourceTokens.end(),
+                                       [&](const std::string &token) {
+        if (referencedTokens.count(token))
+            return false;
+        registry->remove(token);
+        return true;
+    });
+    m_contentResourceTokens.erase(unreferenced, m_contentResourceTokens.end());
+}
+
+// A spooled POST body is kept for as long as the navigation history refers to it, so that
+// reloading or going back to the result of the upload can submit it again.
+void WebContentsAdapter::pruneUploadSpoolFiles()
+{
+    if (m_uploadSpoolFiles.isEmpty())
+        return;
+
+    std::set<base::FilePath> referencedFiles;
+    auto addReferencedFiles = [&referencedFiles](const content::NavigationEntry *entry) {
+        if (scoped_refptr<network::ResourceRequestBody> body = entry->GetPostData()) {
+            for (const auto &element : *body->elements())
+                referencedFiles.insert(element.path());
+        }
+    };
+    const content::NavigationController &controller = m_webContents->GetController();
+    for (int i = 0; i < controller.GetEntryCount(); ++i)
+        addReferencedFiles(controller.GetEntryAtIndex(i));
+    if (const content::NavigationEntry *pendingEntry = controller.GetPendingEntry())
+        addReferencedFiles(pendingEntry);
+
+    auto it = m_uploadSpoolFiles.begin();
+    while (it != m_uploadSpoolFiles.end()) {
+        const base::FilePath path = toFilePath(*it);
+        if (referencedFiles.count(path)) {
+            ++it;
+            continue;
+        }
+        deleteUploadSpoolFile(path);
+        it = m_uploadSpoolFiles.erase(it);
+    }
+}
+
+// Drops the result of a device that is still being spooled for an earlier load.
+void WebContentsAdapter::cancelUploadSpool()
+{
+    ++m_uploadSpoolId;
+}
+
+void WebContentsAdapter::uploadSpoolFinished(const QWebEngineHttpRequest &request, const QString &filePath)
+{
+    if (filePath.isEmpty()) {
+        m_adapterClient->loadFinished(false, request.url(), false,
+                                       net::ERR_FAILED,
+                                       QCoreApplication::translate("WebContentsAdapter",
+                                       "HTTP-POST data could not be read"));
+        return;
+    }
+
+    QWebEngineHttpRequest spooledRequest(request);
+    spooledRequest.setPostDataFile(filePath);
+    load(spooledRequest);
+    // Only now, so that loading does not prune it before its navigation entry refers to it.
+    m_uploadSpoolFiles.append(filePath);
+}
+
 void WebContentsAdapter::save(const QString &filePath, int savePageFormat)
 {
     CHECK_INITIALIZED();
@@ -786,6 +1454,7 @@ void WebContentsAdapter::unselect()
 void WebContentsAdapter::navigateToIndex(int offset)
 {
     CHECK_INITIALIZED();
+    wakeUp();
     CHECK_VALID_RENDER_WIDGET_HOST_VIEW(m_webContents->GetRenderViewHost());
     m_webContents->GetController().GoToIndex(offset);
     focusIfNecessary();
@@ -794,6 +1463,7 @@ void WebContentsAdapter::navigateToIndex(int offset)
 void WebContentsAdapter::navigateToOffset(int offset)
 {
     CHECK_INITIALIZED();
+    wakeUp();
     CHECK_VALID_RENDER_WIDGET_HOST_VIEW(m_webContents->GetRenderViewHost());
     m_webContents->GetController().GoToOffset(offset);
     focusIfNecessary();
@@ -914,6 +1584,7 @@ QAccessibleInterface *WebContentsAdapter::browserAccessible()
 void WebContentsAdapter::runJavaScript(const QString &javaScript, quint32 worldId)
 {
     CHECK_INITIALIZED();
+    wakeUp();
     content::RenderViewHost *rvh = m_webContents->GetRenderViewHost();
     Q_ASSERT(rvh);
     if (worldId == 0) {
@@ -921,16 +1592,19 @@ void WebContentsAdapter::runJavaScript(const QString &javaScript, quint32 worldI
         return;
     }
 
-    content::RenderFrameHost::JavaScriptResultCallback callback = base::Bind(&callbackOnEvaluateJS, m_adapterClient, CallbackDirectory::NoCallbackId);
+    content::RenderFrameHost::JavaScriptResultCallback callback = base::Bind(&callbackOnEvaluateJS, m_adapterClient, CallbackDirectory::NoCallbackId,
+                                                                             WebContentsAdapterClient::VariantResult);
     rvh->GetMainFrame()->ExecuteJavaScriptInIsolatedWorld(toString16(javaScript), callback, worldId);
 }
 
-quint64 WebContentsAdapter::runJavaScriptCallbackResult(const QString &javaScript, quint32 worldId)
+quint64 WebContentsAdapter::runJavaScriptCallbackResult(const QString &javaScript, quint32 worldId,
+                                                        WebContentsAdapterClient::JavaScriptResultFormat format)
 {
     CHECK_INITIALIZED(0);
+    wakeUp();
     content::RenderViewHost *rvh = m_webContents->GetRenderViewHost();
     Q_ASSERT(rvh);
-    content::RenderFrameHost::JavaScriptResultCallback callback = base::Bind(&callbackOnEvaluateJS, m_adapterClient, m_nextRequestId);
+    content::RenderFrameHost::JavaScriptResultCallback callback = base::Bind(&callbackOnEvaluateJS, m_adapterClient, m_nextRequestId, format);
     if (worldId == 0)
         rvh->GetMainFrame()->ExecuteJavaScript(toString16(javaScript), callback);
     else
@@ -938,9 +1612,45 @@ quint64 WebContentsAdapter::runJavaScriptCallbackResult(const QString &javaScrip
     return m_nextRequestId++;
 }
 
+quint64 WebContentsAdapter::runJavaScriptInFrames(const QString &javaScript, quint32 worldId,
+                                                  const QString &originPattern, int timeoutMs)
+{
+    CHECK_INITIALIZED(0);
+    wakeUp();
+    const quint64 requestId = m_nextRequestId++;
+    scoped_refptr<FrameScriptEvaluation> evaluation(new FrameScriptEvaluation(sharedFromThis().toWeakRef(), m_adapterClient, requestId));
+    OriginPattern originFilter;
+    const bool validPattern = originPattern.isEmpty() || OriginPattern::parse(originPattern, &originFilter);
+    if (!validPattern)
+        qWarning("Invalid origin pattern, the script is not run in any frame: %s", qPrintable(originPattern));
+    const base::string16 script = toString16(javaScript);
+
+    for (content::RenderFrameHost *frame : m_webContents->GetAllFrames()) {
+        if (!validPattern || !frame->IsRenderFrameLive())
+            continue;
+        if (!originPattern.isEmpty() && !originFilter.matches(toQt(frame->GetLastCommittedOrigin().GetURL())))
+            continue;
+        std::unique_ptr<FrameScriptReply> reply(new FrameScriptReply(evaluation, evaluation->addFrame(frame)));
+        content::RenderFrameHost::JavaScriptResultCallback callback =
+                base::Bind(&callbackOnEvaluateJSInFrame, base::Passed(&reply));
+        if (worldId == 0)
+            frame->ExecuteJavaScript(script, callback);
+        else
+            frame->ExecuteJavaScriptInIsolatedWorld(script, callback, worldId);
+    }
+
+    if (timeoutMs > 0)
+        base::ThreadTaskRunnerHandle::Get()->PostDelayedTask(FROM_HERE,
+                                                             base::Bind(&FrameScriptEvaluation::finish, evaluation),
+                                                             base::TimeDelta::FromMilliseconds(timeoutMs));
+    evaluation->started();
+    return requestId;
+}
+
 quint64 WebContentsAdapter::fetchDocumentMarkup()
 {
     CHECK_INITIALIZED(0);
+    wakeUp();
     m_renderViewObserverHost->fetchDocumentMarkup(m_nextRequestId);
     return m_nextRequestId++;
 }
@@ -948,10 +1658,50 @@ quint64 WebContentsAdapter::fetchDocumentMarkup()
 quint64 WebContentsAdapter::fetchDocumentInnerText()
 {
     CHECK_INITIALIZED(0);
+    wakeUp();
     m_renderViewObserverHost->fetchDocumentInnerText(m_nextRequestId);
     return m_nextRequestId++;
 }
 
+quint64 WebContentsAdapter::streamDocumentMarkup(qint64 maxBytes, const QStringList &subframeOrigins)
+{
+    CHECK_INITIALIZED(0);
+    wakeUp();
+    m_renderViewObserverHost->streamDocumentContent(m_nextRequestId, /* markup = */ true, maxBytes, subframeOrigins);
+    return m_nextRequestId++;
+}
+
+quint64 WebContentsAdapter::streamDocumentInnerText(qint64 maxBytes)
+{
+    CHECK_INITIALIZED(0);
+    wakeUp();
+    m_renderViewObserverHost->streamDocumentContent(m_nextRequestId, /* markup = */ false, maxBytes, QStringList());
+    return m_nextRequestId++;
+}
+
+quint64 WebContentsAdapter::grabImage(const QRect &rect, qreal scale)
+{
+    CHECK_INITIALIZED(0);
+    if (!qIsFinite(scale) || scale <= 0)
+        return 0;
+    wakeUp();
+    // The renderer paints the page itself, so this works for pages that are hidden or were never shown.
+    m_renderViewObserverHost->grabImage(m_nextRequestId, gfx::Rect(rect.x(), rect.y(), rect.width(), rect.height()), scale);
+    return m_nextRequestId++;
+}
+
+QWebEngineNetworkMetrics WebContentsAdapter::networkMetrics() const
+{
+    CHECK_INITIALIZED(QWebEngineNetworkMetrics());
+    return m_webContentsDelegate->networkMetrics()->snapshot();
+}
+
+void WebContentsAdapter::resetNetworkMetrics()
+{
+    CHECK_INITIALIZED();
+    m_webContentsDelegate->networkMetrics()->reset();
+}
+
 quint64 WebContentsAdapter::findText(const QString &subString, bool caseSensitively, bool findBackward)
 {
     CHECK_INITIALIZED(0);
@@ -1151,15 +1901,160 @@ void WebContentsAdapter::changedFullScreen()
 void WebContentsAdapter::wasShown()
 {
     CHECK_INITIALIZED();
+    m_visible = true;
+    m_hiddenTimer.invalidate();
+    // Visible pages are always active, restore frozen or discarded pages transparently.
+    setLifecycleState(LifecycleState::Active);
     m_webContents->WasShown();
 }
 
 void WebContentsAdapter::wasHidden()
 {
     CHECK_INITIALIZED();
+    m_visible = false;
+    m_hiddenTimer.start();
     m_webContents->WasHidden();
 }
 
+qint64 WebContentsAdapter::msecsSinceHidden() const
+{
+    return m_hiddenTimer.isValid() ? m_hiddenTimer.elapsed() : -1;
+}
+
+void WebContentsAdapter::setJavaScriptConsoleMessageFilter(WebContentsAdapterClient::JavaScriptConsoleMessageLevel minimumLevel, int maxMessagesPerSecond)
+{
+    maxMessagesPerSecond = qMax(0, maxMessagesPerSecond);
+    if (m_consoleMessageMinimumLevel == minimumLevel && m_consoleMessageRateLimit == maxMessagesPerSecond)
+        return;
+    m_consoleMessageMinimumLevel = minimumLevel;
+    m_consoleMessageRateLimit = maxMessagesPerSecond;
+    // Applied by initializeObservers() otherwise.
+    if (isInitialized())
+        m_webContentsDelegate->setConsoleMessageFilter(minimumLevel, maxMessagesPerSecond);
+}
+
+void WebContentsAdapter::setAccessibilityEventRateLimit(int maxEventsPerSecond)
+{
+    m_accessibilityEventRateLimit = qMax(0, maxEventsPerSecond);
+#ifndef QT_NO_ACCESSIBILITY
+    // Managers created later pick the limit up from RenderWidgetHostViewQt.
+    if (!isInitialized())
+        return;
+    for (content::RenderFrameHost *frame : m_webContents->GetAllFrames()) {
+        if (content::BrowserAccessibilityManager *manager =
+                static_cast<content::RenderFrameHostImpl *>(frame)->browser_accessibility_manager())
+            static_cast<content::BrowserAccessibilityManagerQt *>(manager)->setMaxEventRate(m_accessibilityEventRateLimit);
+    }
+#endif // QT_NO_ACCESSIBILITY
+}
+
+void WebContentsAdapter::setLifecycleState(LifecycleState state)
+{
+    CHECK_INITIALIZED();
+    if (m_lifecycleState == state)
+        return;
+
+    if (state != LifecycleState::Active && m_visible) {
+        qWarning("Cannot freeze or discard a visible page.");
+        return;
+    }
+
+    switch (m_lifecycleState) {
+    case LifecycleState::Active:
+        break;
+    case LifecycleState::Frozen:
+        freeze(false);
+        break;
+    case LifecycleState::Discarded:
+        undiscard();
+        break;
+    }
+
+    switch (state) {
+    case LifecycleState::Active:
+        break;
+    case LifecycleState::Frozen:
+        freeze(true);
+        break;
+    case LifecycleState::Discarded:
+        discard();
+        break;
+    }
+
+    m_lifecycleState = state;
+    m_adapterClient->lifecycleStateChanged(state);
+}
+
+// Brings a frozen or discarded page back to life before an operation which needs a live renderer.
+void WebContentsAdapter::wakeUp()
+{
+    setLifecycleState(LifecycleState::Active);
+}
+
+void WebContentsAdapter::freeze(bool frozen)
+{
+    m_webContents->SetPageFrozen(frozen);
+}
+
+void WebContentsAdapter::discard()
+{
+    m_webContents->Stop();
+    if (m_devToolsFrontend)
+        closeDevToolsFrontend();
+
+    m_discardedSnapshot = m_adapterClient->discardSnapshot();
+
+    QByteArray history;
+    {
+        QDataStream output(&history, QIODevice::WriteOnly);
+        QtWebEngineCore::serializeNavigationHistory(m_webContents->GetController(), output);
+    }
+    // The extra headers are not part of the serialized history, but entries loaded by
+    // setContent() need theirs to be served from memory again.
+    const std::vector<std::string> extraHeaders = navigationEntryExtraHeaders(m_webContents->GetController());
+    const int oldFrameTreeNodeId = m_webContents->GetMainFrame()->GetFrameTreeNodeId();
+
+    // Tear down everything attached to the old WebContents before destroying it, the client
+    // will be re-attached to the replacement below. The network metrics of the page are kept.
+    scoped_refptr<NetworkMetricsQt> networkMetrics = m_webContentsDelegate->networkMetrics();
+    if (m_webChannel)
+        m_webChannel->disconnectFrom(m_webChannelTransport.get());
+    m_webChannel = nullptr;
+    m_webChannelTransport.reset();
+    m_renderViewObserverHost.reset();
+    m_webContentsDelegate.reset();
+
+    // Like session restore, the history is kept in a new WebContents without a renderer
+    // until the page is shown again.
+    m_webContents.reset(createBlankWebContents(m_adapterClient, m_browserContextAdapter->browserContext()));
+    QDataStream input(history);
+    int currentIndex;
+    std::vector<std::unique_ptr<content::NavigationEntry>> entries;
+    deserializeNavigationHistory(input, &currentIndex, &entries, m_browserContextAdapter->browserContext());
+    if (entries.size() == extraHeaders.size()) {
+        for (size_t i = 0; i < entries.size(); ++i)
+            entries[i]->AddExtraHeaders(extraHeaders[i]);
+    }
+    contentResourceRegistry()->reassign(oldFrameTreeNodeId, m_webContents->GetMainFrame()->GetFrameTreeNodeId());
+    if (currentIndex != -1)
+        m_webContents->GetController().Restore(currentIndex, content::RestoreType::LAST_SESSION_EXITED_CLEANLY, &entries);
+    m_webContents->WasHidden();
+
+    initializeRendererPrefs();
+    initializeObservers(networkMetrics.get());
+
+    // Refresh the cached URL and title of the new delegate from the restored entries.
+    m_webContentsDelegate->NavigationStateChanged(m_webContents.get(), static_cast<content::InvalidateTypes>(content::INVALIDATE_TYPE_URL | content::INVALIDATE_TYPE_TITLE));
+}
+
+void WebContentsAdapter::undiscard()
+{
+    m_discardedSnapshot = QImage();
+    m_webContents->GetController().LoadIfNecessary();
+    createRenderViewIfNecessary();
+    m_adapterClient->initializationFinished();
+}
+
 void WebContentsAdapter::printToPDF(const QPageLayout &pageLayout, const QString &filePath)
 {
 #if BUILDFLAG(ENABLE_BASIC_PRINTING)
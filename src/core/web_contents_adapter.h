@@ -43,12 +43,18 @@
 #include "qtwebenginecoreglobal.h"
 #include "web_contents_adapter_client.h"
 #include <memory>
+#include <string>
+#include <vector>
 #include <QtGui/qtgui-config.h>
 #include <QtWebEngineCore/qwebenginehttprequest.h>
+#include <QtWebEngineCore/qwebenginenetworkmetrics.h>
 
+#include <QElapsedTimer>
+#include <QImage>
 #include <QScopedPointer>
 #include <QSharedPointer>
 #include <QString>
+#include <QStringList>
 #include <QUrl>
 
 namespace content {
@@ -71,11 +77,14 @@ QT_END_NAMESPACE
 
 namespace QtWebEngineCore {
 
+class ContentResourceRegistryQt;
 class DevToolsFrontendQt;
 class FaviconManager;
 class MessagePassingInterface;
+class NetworkMetricsQt;
 class ProfileQt;
 class RenderViewObserverHostQt;
+class UploadSpoolJob;
 class WebChannelIPCTransportHost;
 class WebEngineContext;
 
@@ -134,9 +143,16 @@ public:
     void setZoomFactor(qreal);
     qreal currentZoomFactor() const;
     void runJavaScript(const QString &javaScript, quint32 worldId);
-    quint64 runJavaScriptCallbackResult(const QString &javaScript, quint32 worldId);
+    quint64 runJavaScriptCallbackResult(const QString &javaScript, quint32 worldId,
+                                        WebContentsAdapterClient::JavaScriptResultFormat format = WebContentsAdapterClient::VariantResult);
+    quint64 runJavaScriptInFrames(const QString &javaScript, quint32 worldId, const QString &originPattern, int timeoutMs);
     quint64 fetchDocumentMarkup();
     quint64 fetchDocumentInnerText();
+    quint64 streamDocumentMarkup(qint64 maxBytes, const QStringList &subframeOrigins);
+    quint64 streamDocumentInnerText(qint64 maxBytes);
+    quint64 grabImage(const QRect &rect, qreal scale);
+    QWebEngineNetworkMetrics networkMetrics() const;
+    void resetNetworkMetrics();
     quint64 findText(const QString &subString, bool caseSensitively, bool findBackward);
     void stopFinding();
     void updateWebPreferences(const content::WebPreferences &webPreferences);
@@ -170,6 +186,20 @@ public:
 
     void wasShown();
     void wasHidden();
+    bool isVisible() const { return m_visible; }
+    qint64 msecsSinceHidden() const;
+
+    typedef WebContentsAdapterClient::LifecycleState LifecycleState;
+    LifecycleState lifecycleState() const { return m_lifecycleState; }
+    void setLifecycleState(LifecycleState state);
+    QImage discardedSnapshot() const { return m_discardedSnapshot; }
+
+    void setJavaScriptConsoleMessageFilter(WebContentsAdapterClient::JavaScriptConsoleMessageLevel minimumLevel, int maxMessagesPerSecond);
+    WebContentsAdapterClient::JavaScriptConsoleMessageLevel javaScriptConsoleMessageMinimumLevel() const { return m_consoleMessageMinimumLevel; }
+    int javaScriptConsoleMessageRateLimit() const { return m_consoleMessageRateLimit; }
+    void setAccessibilityEventRateLimit(int maxEventsPerSecond);
+    int accessibilityEventRateLimit() const { return m_accessibilityEventRateLimit; }
+
     void grantMediaAccessPermission(const QUrl &securityOrigin, WebContentsAdapterClient::MediaRequestFlags flags);
     void runGeolocationRequestCallback(const QUrl &securityOrigin, bool allowed);
     void grantMouseLockPermission(bool granted);
@@ -214,6 +244,20 @@ private:
     Q_DISABLE_COPY(WebContentsAdapter)
     void waitForUpdateDragActionCalled();
     bool handleDropDataFileContents(const content::DropData &dropData, QMimeData *mimeData);
+    void initializeRendererPrefs();
+    void initializeObservers(NetworkMetricsQt *networkMetrics = nullptr);
+    void createRenderViewIfNecessary();
+    void wakeUp();
+    void freeze(bool frozen);
+    void discard();
+    void undiscard();
+    ContentResourceRegistryQt *contentResourceRegistry() const;
+    void pruneContentResources();
+    void pruneUploadSpoolFiles();
+    void cancelUploadSpool();
+    void uploadSpoolFinished(const QWebEngineHttpRequest &request, const QString &filePath);
+
+    friend class UploadSpoolJob;
 
     BrowserContextAdapter *m_browserContextAdapter;
     std::unique_ptr<content::WebContents> m_webContents;
@@ -232,6 +276,16 @@ private:
     QPointF m_lastDragScreenPos;
     std::unique_ptr<QTemporaryDir> m_dndTmpDir;
     DevToolsFrontendQt *m_devToolsFrontend;
+    LifecycleState m_lifecycleState;
+    QImage m_discardedSnapshot;
+    bool m_visible;
+    QElapsedTimer m_hiddenTimer;
+    WebContentsAdapterClient::JavaScriptConsoleMessageLevel m_consoleMessageMinimumLevel;
+    int m_consoleMessageRateLimit;
+    int m_accessibilityEventRateLimit;
+    std::vector<std::string> m_contentResourceTokens;
+    quint64 m_uploadSpoolId;
+    QStringList m_uploadSpoolFiles;
 };
 
 } // namespace QtWebEngineCore
@@ -50,6 +50,7 @@
 #include <QUrl>
 
 QT_FORWARD_DECLARE_CLASS(CertificateErrorController)
+QT_FORWARD_DECLARE_CLASS(QImage)
 QT_FORWARD_DECLARE_CLASS(QKeyEvent)
 QT_FORWARD_DECLARE_CLASS(QVariant)
 QT_FORWARD_DECLARE_CLASS(QWebEngineQuotaRequest)
@@ -375,6 +376,13 @@ public:
         Error
     };
 
+    enum JavaScriptResultFormat {
+        VariantResult = 0,
+        JsonResult,
+        CborResult,
+        JsonValueResult
+    };
+
     enum RenderProcessTerminationStatus {
         NormalTerminationStatus = 0,
         AbnormalTerminationStatus,
@@ -391,6 +399,13 @@ public:
     };
     Q_DECLARE_FLAGS(MediaRequestFlags, MediaRequestFlag)
 
+    // Must match QWebEnginePage::LifecycleState
+    enum class LifecycleState {
+        Active,
+        Frozen,
+        Discarded,
+    };
+
     virtual ~WebContentsAdapterClient() { }
 
     virtual RenderWidgetHostViewQtDelegate* CreateRenderWidgetHostViewQtDelegate(RenderWidgetHostViewQtDelegateClient *client) = 0;
@@ -426,14 +441,19 @@ public:
     virtual void didRunJavaScript(quint64 requestId, const QVariant& result) = 0;
     virtual void didFetchDocumentMarkup(quint64 requestId, const QString& result) = 0;
     virtual void didFetchDocumentInnerText(quint64 requestId, const QString& result) = 0;
+    // Called for each chunk of UTF-8 encoded content, an empty chunk ends the stream.
+    virtual void didStreamDocumentContent(quint64 requestId, const QByteArray &chunk) = 0;
+    virtual void didGrabImage(quint64 requestId, const QImage &image) = 0;
     virtual void didFindText(quint64 requestId, int matchCount) = 0;
     virtual void didPrintPage(quint64 requestId, const QByteArray &result) = 0;
     virtual void didPrintPageToPdf(const QString &filePath, bool success) = 0;
+    virtual void uploadProgress(qint64 bytesSent, qint64 bytesTotal) = 0;
     virtual void passOnFocus(bool reverse) = 0;
     // returns the last QObject (QWidget/QQuickItem) based object in the accessibility
     // hierarchy before going into the BrowserAccessibility tree
     virtual QObject *accessibilityParentObject() = 0;
     virtual void javaScriptConsoleMessage(JavaScriptConsoleMessageLevel level, const QString& message, int lineNumber, const QString& sourceID) = 0;
+    virtual void javaScriptConsoleMessagesDropped(int count) = 0;
     virtual void authenticationRequired(QSharedPointer<AuthenticationDialogController>) = 0;
     virtual void runGeolocationPermissionRequest(const QUrl &securityOrigin) = 0;
     virtual void runMediaAccessPermissionRequest(const QUrl &securityOrigin, MediaRequestFlags requestFlags) = 0;
@@ -453,6 +473,10 @@ public:
     virtual bool isEnabled() const = 0;
     virtual const QObject *holdingQObject() const = 0;
     virtual void setToolTip(const QString& toolTipText) = 0;
+    virtual void lifecycleStateChanged(LifecycleState state) = 0;
+    // Called right before the WebContents is discarded, the returned image is kept as a
+    // placeholder for the page until it is restored.
+    virtual QImage discardSnapshot() = 0;
 
     virtual BrowserContextAdapter *browserContextAdapter() = 0;
     virtual WebContentsAdapter* webContentsAdapter() = 0;
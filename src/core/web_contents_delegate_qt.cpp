@@ -50,6 +50,8 @@
 #include "file_picker_controller.h"
 #include "media_capture_devices_dispatcher.h"
 #include "net/network_delegate_qt.h"
+#include "net/network_metrics_qt.h"
+#include "profile_io_data_qt.h"
 #include "profile_qt.h"
 #include "qwebengineregisterprotocolhandlerrequest.h"
 #include "register_protocol_handler_request_controller_impl.h"
@@ -96,14 +98,31 @@ static WebContentsAdapterClient::JavaScriptConsoleMessageLevel mapToJavascriptCo
     return WebContentsAdapterClient::Warning;
 }
 
-WebContentsDelegateQt::WebContentsDelegateQt(content::WebContents *webContents, WebContentsAdapterClient *adapterClient)
+// Messages are delivered in batches while a console message filter is active.
+static const int kConsoleFlushDelayMs = 100;
+static const int kConsoleRateWindowMs = 1000;
+
+WebContentsDelegateQt::WebContentsDelegateQt(content::WebContents *webContents, WebContentsAdapterClient *adapterClient,
+                                             NetworkMetricsQt *networkMetrics)
     : m_viewClient(adapterClient)
     , m_lastReceivedFindReply(0)
     , m_faviconManager(new FaviconManager(webContents, adapterClient))
     , m_lastLoadProgress(-1)
+    , m_lastUploadPosition(0)
+    , m_consoleMinimumLevel(WebContentsAdapterClient::Info)
+    , m_consoleMaxMessagesPerSecond(0)
+    , m_consoleMessagesInWindow(0)
+    , m_droppedConsoleMessages(0)
+    , m_networkMetrics(networkMetrics ? networkMetrics : new NetworkMetricsQt)
 {
     webContents->SetDelegate(this);
     Observe(webContents);
+
+    // Adopted web contents may already have frames issuing requests.
+    ProfileIODataQt *ioData = profileIOData();
+    for (content::RenderFrameHost *frame : webContents->GetAllFrames())
+        ioData->registerFrameMetrics(frame->GetProcess()->GetID(), frame->GetRoutingID(),
+                                     frame->GetFrameTreeNodeId(), m_networkMetrics.get());
 }
 
 WebContentsDelegateQt::~WebContentsDelegateQt()
@@ -111,6 +130,12 @@ WebContentsDelegateQt::~WebContentsDelegateQt()
     // The destruction of this object should take place before
     // WebContents destruction since WebContentsAdapterClient
     // might be already deleted.
+    profileIOData()->unregisterFrameMetrics(m_networkMetrics.get());
+}
+
+ProfileIODataQt *WebContentsDelegateQt::profileIOData() const
+{
+    return static_cast<ProfileQt *>(web_contents()->GetBrowserContext())->m_profileIOData.get();
 }
 
 content::WebContents *WebContentsDelegateQt::OpenURLFromTab(content::WebContents *source, const content::OpenURLParams &params)
@@ -208,6 +233,16 @@ void WebContentsDelegateQt::NavigationStateChanged(content::WebContents* source,
         }
     }
 
+    if (changed_flags & content::INVALIDATE_TYPE_LOAD) {
+        const uint64_t uploadSize = source->GetUploadSize();
+        const uint64_t uploadPosition = uploadSize ? source->GetUploadPosition() : 0;
+        if (uploadPosition != m_lastUploadPosition) {
+            m_lastUploadPosition = uploadPosition;
+            if (uploadSize)
+                m_viewClient->uploadProgress(uploadPosition, uploadSize);
+        }
+    }
+
     // NavigationStateChanged gets called with INVALIDATE_TYPE_TAB by AudioStateProvider::Notify,
     // whenever an audio sound gets played or stopped, this is the only way to actually figure out
     // if there was a recently played audio sound.
@@ -252,9 +287,21 @@ void WebContentsDelegateQt::HandleKeyboardEvent(content::WebContents *, const co
         m_viewClient->unhandledKeyEvent(reinterpret_cast<QKeyEvent *>(event.os_event));
 }
 
+void WebContentsDelegateQt::RenderFrameCreated(content::RenderFrameHost *render_frame_host)
+{
+    profileIOData()->registerFrameMetrics(render_frame_host->GetProcess()->GetID(), render_frame_host->GetRoutingID(),
+                                          render_frame_host->GetFrameTreeNodeId(), m_networkMetrics.get());
+}
+
 void WebContentsDelegateQt::RenderFrameDeleted(content::RenderFrameHost *render_frame_host)
 {
     m_loadingErrorFrameList.removeOne(render_frame_host->GetRoutingID());
+    profileIOData()->unregisterFrameRoute(render_frame_host->GetProcess()->GetID(), render_frame_host->GetRoutingID());
+}
+
+void WebContentsDelegateQt::FrameDeleted(content::RenderFrameHost *render_frame_host)
+{
+    profileIOData()->unregisterFrameTreeNode(render_frame_host->GetFrameTreeNodeId());
 }
 
 void WebContentsDelegateQt::EmitLoadStarted(const QUrl &url, bool isErrorPage)
@@ -457,8 +504,67 @@ void WebContentsDelegateQt::RunFileChooser(content::RenderFrameHost *frameHost,
 bool WebContentsDelegateQt::DidAddMessageToConsole(content::WebContents *source, int32_t level, const base::string16 &message, int32_t line_no, const base::string16 &source_id)
 {
     Q_UNUSED(source)
-    m_viewClient->javaScriptConsoleMessage(mapToJavascriptConsoleMessageLevel(level), toQt(message), static_cast<int>(line_no), toQt(source_id));
-    return false;
+    const WebContentsAdapterClient::JavaScriptConsoleMessageLevel mappedLevel = mapToJavascriptConsoleMessageLevel(level);
+    if (!isConsoleMessageFilterActive()) {
+        m_viewClient->javaScriptConsoleMessage(mappedLevel, toQt(message), static_cast<int>(line_no), toQt(source_id));
+        return false;
+    }
+
+    // The renderer sends every console message, including those of console.assert(),
+    // console.count() and friends, so all levels are filtered here. Chromium has no
+    // embedder hook to drop them before RenderFrameImpl sends them.
+    bool drop = mappedLevel < m_consoleMinimumLevel;
+    if (!drop && m_consoleMaxMessagesPerSecond) {
+        const base::TimeTicks now = base::TimeTicks::Now();
+        if (now - m_consoleWindowStart >= base::TimeDelta::FromMilliseconds(kConsoleRateWindowMs)) {
+            m_consoleWindowStart = now;
+            m_consoleMessagesInWindow = 0;
+        }
+        drop = ++m_consoleMessagesInWindow > m_consoleMaxMessagesPerSecond;
+    }
+
+    if (drop)
+        ++m_droppedConsoleMessages;
+    else
+        m_pendingConsoleMessages.append(ConsoleMessage{ mappedLevel, toQt(message), static_cast<int>(line_no), toQt(source_id) });
+    scheduleConsoleFlush();
+    return true;
+}
+
+void WebContentsDelegateQt::setConsoleMessageFilter(int minimumLevel, int maxMessagesPerSecond)
+{
+    m_consoleMinimumLevel = minimumLevel;
+    m_consoleMaxMessagesPerSecond = maxMessagesPerSecond;
+    m_consoleMessagesInWindow = 0;
+    if (!isConsoleMessageFilterActive())
+        flushConsoleMessages();
+}
+
+bool WebContentsDelegateQt::isConsoleMessageFilterActive() const
+{
+    return m_consoleMinimumLevel > WebContentsAdapterClient::Info || m_consoleMaxMessagesPerSecond > 0;
+}
+
+void WebContentsDelegateQt::scheduleConsoleFlush()
+{
+    if (!m_consoleFlushTimer.IsRunning())
+        m_consoleFlushTimer.Start(FROM_HERE, base::TimeDelta::FromMilliseconds(kConsoleFlushDelayMs),
+                                  base::Bind(&WebContentsDelegateQt::flushConsoleMessages, base::Unretained(this)));
+}
+
+void WebContentsDelegateQt::flushConsoleMessages()
+{
+    m_consoleFlushTimer.Stop();
+    const QVector<ConsoleMessage> pending = std::move(m_pendingConsoleMessages);
+    m_pendingConsoleMessages.clear();
+    for (const ConsoleMessage &message : pending)
+        m_viewClient->javaScriptConsoleMessage(static_cast<WebContentsAdapterClient::JavaScriptConsoleMessageLevel>(message.level),
+                                               message.message, message.lineNumber, message.sourceId);
+    if (m_droppedConsoleMessages) {
+        const int dropped = m_droppedConsoleMessages;
+        m_droppedConsoleMessages = 0;
+        m_viewClient->javaScriptConsoleMessagesDropped(dropped);
+    }
 }
 
 void WebContentsDelegateQt::FindReply(content::WebContents *source, int request_id, int number_of_matches, const gfx::Rect& selection_rect, int active_match_ordinal, bool final_update)
@@ -45,6 +45,9 @@
 #include "third_party/skia/include/core/SkColor.h"
 
 #include "base/callback.h"
+#include "base/memory/ref_counted.h"
+#include "base/time/time.h"
+#include "base/timer/timer.h"
 
 #include "color_chooser_controller.h"
 #include "favicon_manager.h"
@@ -67,6 +70,8 @@ namespace content {
 
 namespace QtWebEngineCore {
 
+class NetworkMetricsQt;
+class ProfileIODataQt;
 class WebContentsAdapter;
 class WebContentsAdapterClient;
 class WebEngineSettings;
@@ -92,7 +97,7 @@ class WebContentsDelegateQt : public content::WebContentsDelegate
                             , public content::WebContentsObserver
 {
 public:
-    WebContentsDelegateQt(content::WebContents*, WebContentsAdapterClient *adapterClient);
+    WebContentsDelegateQt(content::WebContents*, WebContentsAdapterClient *adapterClient, NetworkMetricsQt *networkMetrics = nullptr);
     ~WebContentsDelegateQt();
     QString lastSearchedString() const { return m_lastSearchedString; }
     void setLastSearchedString(const QString &s) { m_lastSearchedString = s; }
@@ -101,6 +106,8 @@ public:
     QUrl url() const { return m_url; }
     QString title() const { return m_title; }
 
+    void setConsoleMessageFilter(int minimumLevel, int maxMessagesPerSecond);
+
     // WebContentsDelegate overrides
     content::WebContents *OpenURLFromTab(content::WebContents *source, const content::OpenURLParams &params) override;
     void NavigationStateChanged(content::WebContents* source, content::InvalidateTypes changed_flags) override;
@@ -129,7 +136,9 @@ public:
     void UnregisterProtocolHandler(content::WebContents* web_contents, const std::string& protocol, const GURL& url, bool user_gesture) override;
 
     // WebContentsObserver overrides
+    void RenderFrameCreated(content::RenderFrameHost *render_frame_host) override;
     void RenderFrameDeleted(content::RenderFrameHost *render_frame_host) override;
+    void FrameDeleted(content::RenderFrameHost *render_frame_host) override;
     void DidStartNavigation(content::NavigationHandle *navigation_handle) override;
     void DidFinishNavigation(content::NavigationHandle *navigation_handle) override;
     void DidFailLoad(content::RenderFrameHost* render_frame_host, const GURL& validated_url, int error_code, const base::string16& error_description) override;
@@ -152,11 +161,23 @@ public:
 
     WebEngineSettings *webEngineSettings() const;
     WebContentsAdapter *webContentsAdapter() const;
+    NetworkMetricsQt *networkMetrics() const { return m_networkMetrics.get(); }
 
 private:
     QWeakPointer<WebContentsAdapter> createWindow(content::WebContents *new_contents, WindowOpenDisposition disposition, const gfx::Rect& initial_pos, bool user_gesture);
     void EmitLoadStarted(const QUrl &url, bool isErrorPage = false);
     void EmitLoadFinished(bool success, const QUrl &url, bool isErrorPage = false, int errorCode = 0, const QString &errorDescription = QString());
+    bool isConsoleMessageFilterActive() const;
+    void scheduleConsoleFlush();
+    void flushConsoleMessages();
+    ProfileIODataQt *profileIOData() const;
+
+    struct ConsoleMessage {
+        int level;
+        QString message;
+        int lineNumber;
+        QString sourceId;
+    };
 
     WebContentsAdapterClient *m_viewClient;
     QString m_lastSearchedString;
@@ -167,9 +188,20 @@ private:
     QSharedPointer<FilePickerController> m_filePickerController;
     QUrl m_initialTargetUrl;
     int m_lastLoadProgress;
+    uint64_t m_lastUploadPosition;
 
     QUrl m_url;
     QString m_title;
+
+    int m_consoleMinimumLevel;
+    int m_consoleMaxMessagesPerSecond;
+    int m_consoleMessagesInWindow;
+    int m_droppedConsoleMessages;
+    base::TimeTicks m_consoleWindowStart;
+    QVector<ConsoleMessage> m_pendingConsoleMessages;
+    base::OneShotTimer m_consoleFlushTimer;
+
+    scoped_refptr<NetworkMetricsQt> m_networkMetrics;
 };
 
 } // namespace QtWebEngineCore
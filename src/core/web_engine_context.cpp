@@ -47,6 +47,7 @@
 #include "base/message_loop/message_loop.h"
 #include "base/run_loop.h"
 #include "base/threading/thread_restrictions.h"
+#include "base/trace_event/trace_event.h"
 #include "cc/base/switches.h"
 #if BUILDFLAG(ENABLE_BASIC_PRINTING)
 #include "chrome/browser/printing/print_job_manager.h"
@@ -97,6 +98,7 @@
 
 #include <QFileInfo>
 #include <QGuiApplication>
+#include <QLoggingCategory>
 #include <QOffscreenSurface>
 #ifndef QT_NO_OPENGL
 # include <QOpenGLContext>
@@ -104,6 +106,7 @@
 #include <QQuickWindow>
 #include <QStringList>
 #include <QSurfaceFormat>
+#include <QTimer>
 #include <QVector>
 #include <qpa/qplatformnativeinterface.h>
 
@@ -117,6 +120,8 @@ QT_END_NAMESPACE
 
 namespace {
 
+Q_LOGGING_CATEGORY(startupLog, "qt.webengine.startup")
+
 #ifndef QT_NO_OPENGL
 bool usingANGLE()
 {
@@ -212,6 +217,7 @@ void WebEngineContext::removeBrowserContext(BrowserContextAdapter *contextAdapte
 
 void WebEngineContext::destroy()
 {
+    base::trace_event::TraceLog::GetInstance()->RemoveEnabledStateObserver(this);
     if (m_devtoolsServer)
         m_devtoolsServer->stop();
     base::MessagePump::Delegate *delegate =
@@ -310,12 +316,70 @@ static void appendToFeatureSwitch(base::CommandLine *commandLine, const char *fe
     }
 }
 
+// Records a finished startup phase and returns its end time. The phases are
+// logged to the qt.webengine.startup category and added to Chromium's trace
+// under the "startup" category.
+base::TimeTicks WebEngineContext::recordStartupPhase(const char *name, base::TimeTicks begin)
+{
+    const base::TimeTicks end = base::TimeTicks::Now();
+    qCDebug(startupLog, "%s: %.1f ms (done %.1f ms after start)", name,
+            (end - begin).InMillisecondsF(), (end - m_startupBegin).InMillisecondsF());
+    base::AutoLock lock(m_startupPhasesLock);
+    m_startupPhases.push_back({ name, begin, end });
+    // Phases recorded before the context is complete are traced all at once at its end.
+    if (!m_startupEnd.is_null()) {
+        TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP0("startup", name, TRACE_ID_LOCAL(this), begin);
+        TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0("startup", name, TRACE_ID_LOCAL(this), end);
+    }
+    return end;
+}
+
+// Adds all phases to the trace with their original timestamps. This is done again whenever
+// tracing is enabled, since trace events are dropped while it is off.
+void WebEngineContext::traceStartupPhases()
+{
+    base::AutoLock lock(m_startupPhasesLock);
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP0("startup", "WebEngineContext", TRACE_ID_LOCAL(this), m_startupBegin);
+    for (const StartupPhase &phase : m_startupPhases) {
+        TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP0("startup", phase.name, TRACE_ID_LOCAL(this), phase.begin);
+        TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0("startup", phase.name, TRACE_ID_LOCAL(this), phase.end);
+    }
+    TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0("startup", "WebEngineContext", TRACE_ID_LOCAL(this), m_startupEnd);
+}
+
+void WebEngineContext::OnTraceLogEnabled()
+{
+    traceStartupPhases();
+}
+
+// Services not needed for the first navigation are started once the event loop is running.
+void WebEngineContext::startDeferredServices()
+{
+    base::TimeTicks phaseBegin = base::TimeTicks::Now();
+    m_devtoolsServer->start();
+    phaseBegin = recordStartupPhase("DevToolsServer", phaseBegin);
+
+#if BUILDFLAG(ENABLE_PLUGINS)
+    // Creating pepper plugins from the page (which calls PluginService::GetPluginInfoArray)
+    // might fail unless the page queried the list of available plugins at least once
+    // (which ends up calling PluginService::GetPlugins). Since the plugins list can only
+    // be created from the FILE thread, and that GetPluginInfoArray is synchronous, it
+    // can't loads plugins synchronously from the IO thread to serve the render process' request
+    // and we need to make sure that it happened beforehand. No plugin can be created before
+    // the first page has been loaded, so starting it from the event loop is early enough.
+    content::PluginService::GetInstance()->GetPlugins(base::Bind(&dummyGetPluginCallback));
+    recordStartupPhase("PluginService", phaseBegin);
+#endif
+}
+
 WebEngineContext::WebEngineContext()
     : m_mainDelegate(new ContentMainDelegateQt)
     , m_contentRunner(content::ContentMainRunner::Create())
     , m_browserRunner(content::BrowserMainRunner::Create())
     , m_globalQObject(new QObject())
+    , m_startupBegin(base::TimeTicks::Now())
 {
+    base::TimeTicks phaseBegin = m_startupBegin;
 #if defined(USE_X11)
     QString platform = qApp->platformName();
     if (platform != QLatin1String("xcb")) {
@@ -433,6 +497,7 @@ WebEngineContext::WebEngineContext()
     base::FeatureList::InitializeInstance(
         parsedCommandLine->GetSwitchValueASCII(switches::kEnableFeatures),
         parsedCommandLine->GetSwitchValueASCII(switches::kDisableFeatures));
+    phaseBegin = recordStartupPhase("CommandLine", phaseBegin);
 
     GLContextHelper::initialize();
 
@@ -524,6 +589,7 @@ WebEngineContext::WebEngineContext()
     } else {
         parsedCommandLine->AppendSwitch(switches::kDisableGpu);
     }
+    phaseBegin = recordStartupPhase("GLProbe", phaseBegin);
 
     content::UtilityProcessHostImpl::RegisterUtilityMainThreadFactory(content::CreateInProcessUtilityThread);
     content::RenderProcessHostImpl::RegisterRendererMainThreadFactory(content::CreateInProcessRendererThread);
@@ -538,14 +604,15 @@ WebEngineContext::WebEngineContext()
     contentMainParams.sandbox_info = &sandbox_info;
 #endif
     m_contentRunner->Initialize(contentMainParams);
+    phaseBegin = recordStartupPhase("ContentMainRunner", phaseBegin);
     m_browserRunner->Initialize(content::MainFunctionParams(*base::CommandLine::ForCurrentProcess()));
 
     // Once the MessageLoop has been created, attach a top-level RunLoop.
     m_runLoop.reset(new base::RunLoop);
     m_runLoop->BeforeRun();
+    phaseBegin = recordStartupPhase("BrowserMainRunner", phaseBegin);
 
     m_devtoolsServer.reset(new DevToolsServerQt());
-    m_devtoolsServer->start();
     // Force the initialization of MediaCaptureDevicesDispatcher on the UI
     // thread to avoid a thread check assertion in its constructor when it
     // first gets referenced on the IO thread.
@@ -565,26 +632,24 @@ WebEngineContext::WebEngineContext()
     media::AudioManager::SetGlobalAppName(QCoreApplication::applicationName().toStdString());
 #endif
 
-#if BUILDFLAG(ENABLE_PLUGINS)
-    // Creating pepper plugins from the page (which calls PluginService::GetPluginInfoArray)
-    // might fail unless the page queried the list of available plugins at least once
-    // (which ends up calling PluginService::GetPlugins). Since the plugins list can only
-    // be created from the FILE thread, and that GetPluginInfoArray is synchronous, it
-    // can't loads plugins synchronously from the IO thread to serve the render process' request
-    // and we need to make sure that it happened beforehand.
-    content::PluginService::GetInstance()->GetPlugins(base::Bind(&dummyGetPluginCallback));
-#endif
-
-#if BUILDFLAG(ENABLE_BASIC_PRINTING)
-    m_printJobManager.reset(new printing::PrintJobManager());
-#endif // defined(ENABLE_BASIC_PRINTING)
-
     content::WebUIControllerFactory::RegisterFactory(WebUIControllerFactoryQt::GetInstance());
+    const base::TimeTicks startupEnd = recordStartupPhase("BrowserServices", phaseBegin);
+    {
+        base::AutoLock lock(m_startupPhasesLock);
+        m_startupEnd = startupEnd;
+    }
+    traceStartupPhases();
+    base::trace_event::TraceLog::GetInstance()->AddEnabledStateObserver(this);
+
+    QTimer::singleShot(0, m_globalQObject.get(), [this] () { startDeferredServices(); });
 }
 
 #if BUILDFLAG(ENABLE_BASIC_PRINTING)
 printing::PrintJobManager* WebEngineContext::getPrintJobManager()
 {
+    // Created on first use, which is the launch of the first render process.
+    if (!m_printJobManager)
+        m_printJobManager.reset(new printing::PrintJobManager());
     return m_printJobManager.get();
 }
 #endif // defined(ENABLE_BASIC_PRINTING)
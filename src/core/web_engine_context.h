@@ -45,6 +45,9 @@
 #include "build/build_config.h"
 
 #include "base/memory/ref_counted.h"
+#include "base/synchronization/lock.h"
+#include "base/time/time.h"
+#include "base/trace_event/trace_log.h"
 #include "base/values.h"
 #include "printing/features/features.h"
 #include <QVector>
@@ -75,7 +78,8 @@ class SurfaceFactoryQt;
 
 bool usingSoftwareDynamicGL();
 
-class WebEngineContext : public base::RefCounted<WebEngineContext> {
+class WebEngineContext : public base::RefCounted<WebEngineContext>
+                       , public base::trace_event::TraceLog::EnabledStateObserver {
 public:
     static WebEngineContext *current();
     static void destroyContextPostRoutine();
@@ -97,11 +101,31 @@ private:
     WebEngineContext();
     ~WebEngineContext();
 
+    base::TimeTicks recordStartupPhase(const char *name, base::TimeTicks begin);
+    void traceStartupPhases();
+    void startDeferredServices();
+
+    // base::trace_event::TraceLog::EnabledStateObserver
+    void OnTraceLogEnabled() override;
+    void OnTraceLogDisabled() override {}
+
     std::unique_ptr<base::RunLoop> m_runLoop;
     std::unique_ptr<ContentMainDelegateQt> m_mainDelegate;
     std::unique_ptr<content::ContentMainRunner> m_contentRunner;
     std::unique_ptr<content::BrowserMainRunner> m_browserRunner;
     std::unique_ptr<QObject> m_globalQObject;
+
+    struct StartupPhase {
+        const char *name;
+        base::TimeTicks begin;
+        base::TimeTicks end;
+    };
+    // Tracing may be enabled from another thread.
+    base::Lock m_startupPhasesLock;
+    std::vector<StartupPhase> m_startupPhases;
+    base::TimeTicks m_startupBegin;
+    base::TimeTicks m_startupEnd;
+
     std::unique_ptr<BrowserContextAdapter> m_defaultBrowserContext;
     std::unique_ptr<DevToolsServerQt> m_devtoolsServer;
     QVector<BrowserContextAdapter*> m_browserContextAdapters;
@@ -59,6 +59,8 @@
 #include <QTimer>
 #include <QTouchDevice>
 
+#include <algorithm>
+
 namespace QtWebEngineCore {
 
 QHash<WebEngineSettings::Attribute, bool> WebEngineSettings::s_defaultAttributes;
@@ -67,27 +69,113 @@ QHash<WebEngineSettings::FontSize, int> WebEngineSettings::s_defaultFontSizes;
 
 static const int batchTimerTimeout = 0;
 
+// Applies the settings scheduled during one event loop iteration in a single pass.
 class BatchTimer : public QTimer {
     Q_OBJECT
 public:
-    BatchTimer(WebEngineSettings *settings)
-        : m_settings(settings)
+    BatchTimer()
     {
         setSingleShot(true);
         setInterval(batchTimerTimeout);
         connect(this, SIGNAL(timeout()), SLOT(onTimeout()));
     }
 
+    void schedule(WebEngineSettings *settings)
+    {
+        m_pendingSettings.insert(settings);
+        if (!isActive())
+            start();
+    }
+
+    void unschedule(WebEngineSettings *settings)
+    {
+        m_pendingSettings.remove(settings);
+    }
+
 private Q_SLOTS:
     void onTimeout()
     {
-        m_settings->doApply();
+        const QSet<WebEngineSettings *> pendingSettings = m_pendingSettings;
+        m_pendingSettings.clear();
+        for (WebEngineSettings *settings : pendingSettings)
+            settings->doApply();
     }
 
 private:
-    WebEngineSettings *m_settings;
+    QSet<WebEngineSettings *> m_pendingSettings;
 };
 
+Q_GLOBAL_STATIC(BatchTimer, batchTimer)
+
+// Keep in sync with the last values of the enums in WebEngineSettings.
+static const int attributeCount = WebEngineSettings::JavascriptCanPaste + 1;
+static const int fontFamilyCount = WebEngineSettings::PictographFont + 1;
+static const int fontSizeCount = WebEngineSettings::DefaultFixedFontSize + 1;
+
+// The values of a settings object resolved through its parents. Identical values are
+// interned, so that pages with the same effective settings share one object and can
+// detect unchanged settings by comparing pointers.
+struct ResolvedSettings {
+    bool attributes[attributeCount];
+    bool playbackRequiresUserGestureSet;
+    QString fontFamilies[fontFamilyCount];
+    int fontSizes[fontSizeCount];
+    std::string defaultEncoding;
+    uint hash;
+
+    void computeHash()
+    {
+        hash = qHashBits(attributes, sizeof(attributes));
+        hash = 31 * hash + qHashBits(fontSizes, sizeof(fontSizes));
+        for (const QString &family : fontFamilies)
+            hash = 31 * hash + qHash(family);
+        hash = 31 * hash + qHashBits(defaultEncoding.data(), defaultEncoding.size());
+        hash = 31 * hash + uint(playbackRequiresUserGestureSet);
+    }
+
+    bool operator==(const ResolvedSettings &other) const
+    {
+        return hash == other.hash
+            && playbackRequiresUserGestureSet == other.playbackRequiresUserGestureSet
+            && std::equal(attributes, attributes + attributeCount, other.attributes)
+            && std::equal(fontSizes, fontSizes + fontSizeCount, other.fontSizes)
+            && std::equal(fontFamilies, fontFamilies + fontFamilyCount, other.fontFamilies)
+            && defaultEncoding == other.defaultEncoding;
+    }
+};
+
+typedef QMultiHash<uint, QWeakPointer<const ResolvedSettings>> ResolvedSettingsTable;
+Q_GLOBAL_STATIC(ResolvedSettingsTable, internedSettings)
+
+static void releaseResolvedSettings(ResolvedSettings *settings)
+{
+    if (!internedSettings.isDestroyed()) {
+        auto it = internedSettings->find(settings->hash);
+        while (it != internedSettings->end() && it.key() == settings->hash) {
+            if (it.value().isNull())
+                it = internedSettings->erase(it);
+            else
+                ++it;
+        }
+    }
+    delete settings;
+}
+
+static QSharedPointer<const ResolvedSettings> internResolvedSettings(ResolvedSettings *settings)
+{
+    settings->computeHash();
+    for (auto it = internedSettings->find(settings->hash); it != internedSettings->end() && it.key() == settings->hash; ++it) {
+        QSharedPointer<const ResolvedSettings> interned = it.value().toStrongRef();
+        if (interned && *interned == *settings) {
+            delete settings;
+            return interned;
+        }
+    }
+    QSharedPointer<const ResolvedSettings> interned(settings, releaseResolvedSettings);
+    internedSettings->insert(settings->hash, interned);
+    return interned;
+}
+
 static inline bool isTouchEventsAPIEnabled() {
     static bool initialized = false;
     static bool touchEventsAPIEnabled = false;
@@ -113,7 +201,6 @@ static inline bool isTouchEventsAPIEnabled() {
 
 WebEngineSettings::WebEngineSettings(WebEngineSettings *_parentSettings)
     : m_adapter(0)
-    , m_batchTimer(new BatchTimer(this))
     , parentSettings(_parentSettings)
     , m_unknownUrlSchemePolicy(WebEngineSettings::InheritedUnknownUrlSchemePolicy)
 {
@@ -123,6 +210,8 @@ WebEngineSettings::WebEngineSettings(WebEngineSettings *_parentSettings)
 
 WebEngineSettings::~WebEngineSettings()
 {
+    if (!batchTimer.isDestroyed())
+        batchTimer->unschedule(this);
     if (parentSettings)
         parentSettings->childSettings.remove(this);
     // In QML the profile and its settings may be garbage collected before the page and its settings.
@@ -133,17 +222,20 @@ WebEngineSettings::~WebEngineSettings()
 
 void WebEngineSettings::overrideWebPreferences(content::WebContents *webContents, content::WebPreferences *prefs)
 {
+    const QSharedPointer<const ResolvedSettings> settings = resolvedSettings();
     // Apply our settings on top of those.
-    applySettingsToWebPreferences(prefs);
+    applySettingsToWebPreferences(*settings, prefs);
     // Store the current webPreferences in use if this is the first time we get here
     // as the host process already overides some of the default WebPreferences values
     // before we get here (e.g. number_of_cpu_cores).
-    if (webPreferences.isNull())
+    if (webPreferences.isNull()) {
         webPreferences.reset(new content::WebPreferences(*prefs));
+        m_appliedSettings = settings;
+    }
 
     if (webContents
             && webContents->GetRenderViewHost()
-            && applySettingsToRendererPreferences(webContents->GetMutableRendererPrefs())) {
+            && applySettingsToRendererPreferences(*settings, webContents->GetMutableRendererPrefs())) {
         webContents->GetRenderViewHost()->SyncRendererPrefs();
     }
 }
@@ -334,24 +426,61 @@ void WebEngineSettings::initDefaults()
 
 void WebEngineSettings::scheduleApply()
 {
-    if (!m_batchTimer->isActive())
-        m_batchTimer->start();
+    batchTimer->schedule(this);
 }
 
 void WebEngineSettings::doApply()
 {
     if (webPreferences.isNull())
         return;
+    const QSharedPointer<const ResolvedSettings> settings = resolvedSettings();
+    // Pages whose effective settings did not change skip the update and its IPC.
+    if (settings == m_appliedSettings)
+        return;
+    m_appliedSettings = settings;
+
     // Override with our settings when applicable
-    applySettingsToWebPreferences(webPreferences.data());
+    applySettingsToWebPreferences(*settings, webPreferences.data());
     Q_ASSERT(m_adapter);
     m_adapter->updateWebPreferences(*webPreferences.data());
 
-    if (applySettingsToRendererPreferences(m_adapter->webContents()->GetMutableRendererPrefs()))
+    if (applySettingsToRendererPreferences(*settings, m_adapter->webContents()->GetMutableRendererPrefs()))
         m_adapter->webContents()->GetRenderViewHost()->SyncRendererPrefs();
 }
 
-void WebEngineSettings::applySettingsToWebPreferences(content::WebPreferences *prefs)
+QSharedPointer<const ResolvedSettings> WebEngineSettings::resolvedSettings()
+{
+    if (m_resolvedSettings)
+        return m_resolvedSettings;
+
+    // Objects without values of their own share the values of their parent.
+    if (parentSettings && m_attributes.isEmpty() && m_fontFamilies.isEmpty() && m_fontSizes.isEmpty()
+            && m_defaultEncoding.isEmpty()) {
+        m_resolvedSettings = parentSettings->resolvedSettings();
+        return m_resolvedSettings;
+    }
+
+    ResolvedSettings *settings = new ResolvedSettings;
+    for (int i = 0; i < attributeCount; ++i)
+        settings->attributes[i] = testAttribute(Attribute(i));
+    settings->playbackRequiresUserGestureSet = isAttributeExplicitlySet(PlaybackRequiresUserGesture);
+    for (int i = 0; i < fontFamilyCount; ++i)
+        settings->fontFamilies[i] = fontFamily(FontFamily(i));
+    for (int i = 0; i < fontSizeCount; ++i)
+        settings->fontSizes[i] = fontSize(FontSize(i));
+    settings->defaultEncoding = defaultTextEncoding().toStdString();
+    m_resolvedSettings = internResolvedSettings(settings);
+    return m_resolvedSettings;
+}
+
+void WebEngineSettings::invalidateResolvedSettings()
+{
+    m_resolvedSettings.reset();
+    for (WebEngineSettings *settings : qAsConst(childSettings))
+        settings->invalidateResolvedSettings();
+}
+
+void WebEngineSettings::applySettingsToWebPreferences(const ResolvedSettings &settings, content::WebPreferences *prefs)
 {
     // Override for now
     prefs->touch_event_feature_detection_enabled = isTouchEventsAPIEnabled();
@@ -363,55 +492,55 @@ void WebEngineSettings::applySettingsToWebPreferences(content::WebPreferences *p
     }
 
     // Attributes mapping.
-    prefs->loads_images_automatically = testAttribute(AutoLoadImages);
-    prefs->javascript_enabled = testAttribute(JavascriptEnabled);
-    prefs->javascript_can_access_clipboard = testAttribute(JavascriptCanAccessClipboard);
-    prefs->tabs_to_links = testAttribute(LinksIncludedInFocusChain);
-    prefs->local_storage_enabled = testAttribute(LocalStorageEnabled);
-    prefs->databases_enabled = testAttribute(LocalStorageEnabled);
-    prefs->allow_universal_access_from_file_urls = testAttribute(LocalContentCanAccessRemoteUrls);
-    prefs->xss_auditor_enabled = testAttribute(XSSAuditingEnabled);
-    prefs->spatial_navigation_enabled = testAttribute(SpatialNavigationEnabled);
-    prefs->allow_file_access_from_file_urls = testAttribute(LocalContentCanAccessFileUrls);
-    prefs->hyperlink_auditing_enabled = testAttribute(HyperlinkAuditingEnabled);
-    prefs->enable_scroll_animator = testAttribute(ScrollAnimatorEnabled);
-    prefs->enable_error_page = testAttribute(ErrorPageEnabled);
-    prefs->plugins_enabled = testAttribute(PluginsEnabled);
-    prefs->fullscreen_supported = testAttribute(FullScreenSupportEnabled);
-    prefs->accelerated_2d_canvas_enabled = testAttribute(Accelerated2dCanvasEnabled);
-    prefs->webgl1_enabled = prefs->webgl2_enabled = testAttribute(WebGLEnabled);
-    prefs->should_print_backgrounds = testAttribute(PrintElementBackgrounds);
-    prefs->allow_running_insecure_content = testAttribute(AllowRunningInsecureContent);
-    prefs->allow_geolocation_on_insecure_origins = testAttribute(AllowGeolocationOnInsecureOrigins);
-    prefs->hide_scrollbars = !testAttribute(ShowScrollBars);
-    if (isAttributeExplicitlySet(PlaybackRequiresUserGesture)) {
-        prefs->autoplay_policy = testAttribute(PlaybackRequiresUserGesture)
+    prefs->loads_images_automatically = settings.attributes[AutoLoadImages];
+    prefs->javascript_enabled = settings.attributes[JavascriptEnabled];
+    prefs->javascript_can_access_clipboard = settings.attributes[JavascriptCanAccessClipboard];
+    prefs->tabs_to_links = settings.attributes[LinksIncludedInFocusChain];
+    prefs->local_storage_enabled = settings.attributes[LocalStorageEnabled];
+    prefs->databases_enabled = settings.attributes[LocalStorageEnabled];
+    prefs->allow_universal_access_from_file_urls = settings.attributes[LocalContentCanAccessRemoteUrls];
+    prefs->xss_auditor_enabled = settings.attributes[XSSAuditingEnabled];
+    prefs->spatial_navigation_enabled = settings.attributes[SpatialNavigationEnabled];
+    prefs->allow_file_access_from_file_urls = settings.attributes[LocalContentCanAccessFileUrls];
+    prefs->hyperlink_auditing_enabled = settings.attributes[HyperlinkAuditingEnabled];
+    prefs->enable_scroll_animator = settings.attributes[ScrollAnimatorEnabled];
+    prefs->enable_error_page = settings.attributes[ErrorPageEnabled];
+    prefs->plugins_enabled = settings.attributes[PluginsEnabled];
+    prefs->fullscreen_supported = settings.attributes[FullScreenSupportEnabled];
+    prefs->accelerated_2d_canvas_enabled = settings.attributes[Accelerated2dCanvasEnabled];
+    prefs->webgl1_enabled = prefs->webgl2_enabled = settings.attributes[WebGLEnabled];
+    prefs->should_print_backgrounds = settings.attributes[PrintElementBackgrounds];
+    prefs->allow_running_insecure_content = settings.attributes[AllowRunningInsecureContent];
+    prefs->allow_geolocation_on_insecure_origins = settings.attributes[AllowGeolocationOnInsecureOrigins];
+    prefs->hide_scrollbars = !settings.attributes[ShowScrollBars];
+    if (settings.playbackRequiresUserGestureSet) {
+        prefs->autoplay_policy = settings.attributes[PlaybackRequiresUserGesture]
                                ? content::AutoplayPolicy::kUserGestureRequired
                                : content::AutoplayPolicy::kNoUserGestureRequired;
     }
-    prefs->dom_paste_enabled = testAttribute(JavascriptCanPaste);
+    prefs->dom_paste_enabled = settings.attributes[JavascriptCanPaste];
 
     // Fonts settings.
-    prefs->standard_font_family_map[content::kCommonScript] = toString16(fontFamily(StandardFont));
-    prefs->fixed_font_family_map[content::kCommonScript] = toString16(fontFamily(FixedFont));
-    prefs->serif_font_family_map[content::kCommonScript] = toString16(fontFamily(SerifFont));
-    prefs->sans_serif_font_family_map[content::kCommonScript] = toString16(fontFamily(SansSerifFont));
-    prefs->cursive_font_family_map[content::kCommonScript] = toString16(fontFamily(CursiveFont));
-    prefs->fantasy_font_family_map[content::kCommonScript] = toString16(fontFamily(FantasyFont));
-    prefs->pictograph_font_family_map[content::kCommonScript] = toString16(fontFamily(PictographFont));
-    prefs->default_font_size = fontSize(DefaultFontSize);
-    prefs->default_fixed_font_size = fontSize(DefaultFixedFontSize);
-    prefs->minimum_font_size = fontSize(MinimumFontSize);
-    prefs->minimum_logical_font_size = fontSize(MinimumLogicalFontSize);
-    prefs->default_encoding = defaultTextEncoding().toStdString();
+    prefs->standard_font_family_map[content::kCommonScript] = toString16(settings.fontFamilies[StandardFont]);
+    prefs->fixed_font_family_map[content::kCommonScript] = toString16(settings.fontFamilies[FixedFont]);
+    prefs->serif_font_family_map[content::kCommonScript] = toString16(settings.fontFamilies[SerifFont]);
+    prefs->sans_serif_font_family_map[content::kCommonScript] = toString16(settings.fontFamilies[SansSerifFont]);
+    prefs->cursive_font_family_map[content::kCommonScript] = toString16(settings.fontFamilies[CursiveFont]);
+    prefs->fantasy_font_family_map[content::kCommonScript] = toString16(settings.fontFamilies[FantasyFont]);
+    prefs->pictograph_font_family_map[content::kCommonScript] = toString16(settings.fontFamilies[PictographFont]);
+    prefs->default_font_size = settings.fontSizes[DefaultFontSize];
+    prefs->default_fixed_font_size = settings.fontSizes[DefaultFixedFontSize];
+    prefs->minimum_font_size = settings.fontSizes[MinimumFontSize];
+    prefs->minimum_logical_font_size = settings.fontSizes[MinimumLogicalFontSize];
+    prefs->default_encoding = settings.defaultEncoding;
 }
 
-bool WebEngineSettings::applySettingsToRendererPreferences(content::RendererPreferences *prefs)
+bool WebEngineSettings::applySettingsToRendererPreferences(const ResolvedSettings &settings, content::RendererPreferences *prefs)
 {
     bool changed = false;
 #if BUILDFLAG(ENABLE_WEBRTC)
     if (!base::CommandLine::ForCurrentProcess()->HasSwitch(switches::kForceWebRtcIPHandlingPolicy)) {
-        std::string webrtc_ip_handling_policy = testAttribute(WebEngineSettings::WebRTCPublicInterfacesOnly)
+        std::string webrtc_ip_handling_policy = settings.attributes[WebEngineSettings::WebRTCPublicInterfacesOnly]
                                               ? content::kWebRTCIPHandlingDefaultPublicInterfaceOnly
                                               : content::kWebRTCIPHandlingDefault;
         if (prefs->webrtc_ip_handling_policy != webrtc_ip_handling_policy) {
@@ -425,6 +554,7 @@ bool WebEngineSettings::applySettingsToRendererPreferences(content::RendererPref
 
 void WebEngineSettings::scheduleApplyRecursively()
 {
+    invalidateResolvedSettings();
     scheduleApply();
     Q_FOREACH (WebEngineSettings *settings, childSettings) {
         settings->scheduleApply();
@@ -443,6 +573,7 @@ void WebEngineSettings::setParentSettings(WebEngineSettings *_parentSettings)
     parentSettings = _parentSettings;
     if (parentSettings)
         parentSettings->childSettings.insert(this);
+    invalidateResolvedSettings();
 }
 
 } // namespace QtWebEngineCore
@@ -43,6 +43,7 @@
 #include "qtwebenginecoreglobal.h"
 
 #include <QScopedPointer>
+#include <QSharedPointer>
 #include <QHash>
 #include <QUrl>
 #include <QSet>
@@ -55,6 +56,7 @@ struct WebPreferences;
 namespace QtWebEngineCore {
 
 class BatchTimer;
+struct ResolvedSettings;
 class WebContentsAdapter;
 
 class QWEBENGINE_EXPORT WebEngineSettings {
@@ -155,8 +157,10 @@ public:
 
 private:
     void doApply();
-    void applySettingsToWebPreferences(content::WebPreferences *);
-    bool applySettingsToRendererPreferences(content::RendererPreferences *);
+    QSharedPointer<const ResolvedSettings> resolvedSettings();
+    void invalidateResolvedSettings();
+    static void applySettingsToWebPreferences(const ResolvedSettings &, content::WebPreferences *);
+    static bool applySettingsToRendererPreferences(const ResolvedSettings &, content::RendererPreferences *);
     void setWebContentsAdapter(WebContentsAdapter *adapter) { m_adapter = adapter; }
 
     WebContentsAdapter* m_adapter;
@@ -165,7 +169,9 @@ private:
     QHash<FontSize, int> m_fontSizes;
     QString m_defaultEncoding;
     QScopedPointer<content::WebPreferences> webPreferences;
-    QScopedPointer<BatchTimer> m_batchTimer;
+    // Interned values of this object and its parents, and the values last sent to the page.
+    QSharedPointer<const ResolvedSettings> m_resolvedSettings;
+    QSharedPointer<const ResolvedSettings> m_appliedSettings;
 
     WebEngineSettings *parentSettings;
     QSet<WebEngineSettings *> childSettings;
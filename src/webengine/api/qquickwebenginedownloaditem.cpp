@@ -107,6 +107,7 @@ QQuickWebEngineDownloadItemPrivate::QQuickWebEngineDownloadItemPrivate(QQuickWeb
     , receivedBytes(0)
     , downloadFinished(false)
     , downloadPaused(false)
+    , inMemory(false)
 {
 }
 
@@ -591,6 +592,53 @@ bool QQuickWebEngineDownloadItem::isPaused() const
     return d->downloadPaused;
 }
 
+/*!
+    \qmlproperty bool WebEngineDownloadItem::inMemory
+    \since QtWebEngine 1.8
+
+    Whether the downloaded data is delivered in chunks through the dataReceived()
+    signal instead of being written to \l path.
+
+    This can only be set in response to the WebEngineProfile::downloadRequested()
+    signal before the download is accepted. It is ignored for web page downloads.
+
+    The data still passes through a temporary file, which is deleted once the data
+    has been delivered. The download therefore needs as much free temporary disk
+    space as the full size of the downloaded data. If the data is not consumed as
+    fast as it arrives, the download is paused until the consumer catches up.
+
+    \sa dataReceived()
+*/
+
+bool QQuickWebEngineDownloadItem::isInMemory() const
+{
+    Q_D(const QQuickWebEngineDownloadItem);
+    return d->inMemory && !isSavePageDownload();
+}
+
+void QQuickWebEngineDownloadItem::setInMemory(bool inMemory)
+{
+    Q_D(QQuickWebEngineDownloadItem);
+    if (d->downloadState != QQuickWebEngineDownloadItem::DownloadRequested) {
+        qWarning("Changing the download destination is not allowed after the download has been accepted.");
+        return;
+    }
+    if (d->inMemory != inMemory) {
+        d->inMemory = inMemory;
+        Q_EMIT inMemoryChanged();
+    }
+}
+
+/*!
+    \qmlsignal WebEngineDownloadItem::dataReceived(ArrayBuffer data)
+    \since QtWebEngine 1.8
+
+    This signal is emitted with the next chunk of \a data of a download that is
+    delivered in memory.
+
+    \sa inMemory
+*/
+
 QQuickWebEngineDownloadItem::QQuickWebEngineDownloadItem(QQuickWebEngineDownloadItemPrivate *p, QObject *parent)
     : QObject(parent)
     , d_ptr(p)
@@ -134,6 +134,7 @@ public:
     Q_PROPERTY(bool isFinished READ isFinished NOTIFY isFinishedChanged REVISION 5 FINAL)
     Q_PROPERTY(bool isPaused READ isPaused NOTIFY isPausedChanged REVISION 5 FINAL)
     Q_PROPERTY(bool isSavePageDownload READ isSavePageDownload CONSTANT REVISION 6 FINAL)
+    Q_PROPERTY(bool inMemory READ isInMemory WRITE setInMemory NOTIFY inMemoryChanged REVISION 7 FINAL)
 
     Q_INVOKABLE void accept();
     Q_INVOKABLE void cancel();
@@ -155,6 +156,8 @@ public:
     bool isFinished() const;
     bool isPaused() const;
     bool isSavePageDownload() const;
+    bool isInMemory() const;
+    void setInMemory(bool inMemory);
 
 Q_SIGNALS:
     void stateChanged();
@@ -167,6 +170,8 @@ Q_SIGNALS:
     Q_REVISION(4) void interruptReasonChanged();
     Q_REVISION(5) void isFinishedChanged();
     Q_REVISION(5) void isPausedChanged();
+    Q_REVISION(7) void inMemoryChanged();
+    Q_REVISION(7) void dataReceived(const QByteArray &data);
 
 private:
     QQuickWebEngineDownloadItem(QQuickWebEngineDownloadItemPrivate*, QObject *parent = 0);
@@ -81,6 +81,7 @@ public:
     QString downloadPath;
     bool downloadFinished;
     bool downloadPaused;
+    bool inMemory;
 
     void update(const QtWebEngineCore::BrowserContextAdapterClient::DownloadItemInfo &info);
     void updateState(QQuickWebEngineDownloadItem::DownloadState newState);
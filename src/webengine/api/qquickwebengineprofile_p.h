@@ -82,6 +82,7 @@ public:
 
     void downloadRequested(DownloadItemInfo &info) override;
     void downloadUpdated(const DownloadItemInfo &info) override;
+    void downloadDataReceived(quint32 downloadId, const QByteArray &data) override;
 
     // QQmlListPropertyHelpers
     static void userScripts_append(QQmlListProperty<QQuickWebEngineScript> *p, QQuickWebEngineScript *script);
@@ -563,6 +563,12 @@ void QQuickWebEngineViewPrivate::javaScriptConsoleMessage(JavaScriptConsoleMessa
     }
 }
 
+void QQuickWebEngineViewPrivate::javaScriptConsoleMessagesDropped(int count)
+{
+    // The console message filter is not exposed to QML.
+    Q_UNUSED(count);
+}
+
 void QQuickWebEngineViewPrivate::authenticationRequired(QSharedPointer<AuthenticationDialogController> controller)
 {
     Q_Q(QQuickWebEngineView);
@@ -983,6 +989,12 @@ void QQuickWebEngineViewPrivate::didPrintPageToPdf(const QString &filePath, bool
     Q_EMIT q->pdfPrintingFinished(filePath, success);
 }
 
+void QQuickWebEngineViewPrivate::uploadProgress(qint64 bytesSent, qint64 bytesTotal)
+{
+    Q_Q(QQuickWebEngineView);
+    Q_EMIT q->uploadProgress(bytesSent, bytesTotal);
+}
+
 void QQuickWebEngineViewPrivate::updateScrollPosition(const QPointF &position)
 {
     Q_Q(QQuickWebEngineView);
@@ -1041,6 +1053,18 @@ void QQuickWebEngineViewPrivate::setToolTip(const QString &toolTipText)
     ui()->showToolTip(toolTipText);
 }
 
+void QQuickWebEngineViewPrivate::lifecycleStateChanged(LifecycleState state)
+{
+    Q_Q(QQuickWebEngineView);
+    Q_EMIT q->lifecycleStateChanged(static_cast<QQuickWebEngineView::LifecycleState>(state));
+}
+
+QImage QQuickWebEngineViewPrivate::discardSnapshot()
+{
+    // Grabbing a hidden item is asynchronous and needs a window, there is nothing to keep here.
+    return QImage();
+}
+
 bool QQuickWebEngineView::isLoading() const
 {
     Q_D(const QQuickWebEngineView);
@@ -1303,6 +1327,28 @@ void QQuickWebEngineView::setDevToolsView(QQuickWebEngineView *devToolsView)
     Q_EMIT devToolsViewChanged();
 }
 
+QQuickWebEngineView::LifecycleState QQuickWebEngineView::lifecycleState() const
+{
+    Q_D(const QQuickWebEngineView);
+    return static_cast<LifecycleState>(d->adapter->lifecycleState());
+}
+
+void QQuickWebEngineView::setLifecycleState(LifecycleState state)
+{
+    Q_D(QQuickWebEngineView);
+    d->adapter->setLifecycleState(static_cast<WebContentsAdapterClient::LifecycleState>(state));
+}
+
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::LifecycleState::Active, QQuickWebEngineView::LifecycleState::Active)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::LifecycleState::Frozen, QQuickWebEngineView::LifecycleState::Frozen)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::LifecycleState::Discarded, QQuickWebEngineView::LifecycleState::Discarded)
+
+bool QQuickWebEngineView::delegatesReady() const
+{
+    Q_D(const QQuickWebEngineView);
+    return d->m_uIDelegatesManager && d->m_uIDelegatesManager->componentsReady();
+}
+
 void QQuickWebEngineView::grantFeaturePermission(const QUrl &securityOrigin, QQuickWebEngineView::Feature feature, bool granted)
 {
     if (!granted && ((feature >= MediaAudioCapture && feature <= MediaAudioVideoCapture) ||
@@ -1710,6 +1756,9 @@ void QQuickWebEngineView::lazyInitialize()
 {
     Q_D(QQuickWebEngineView);
     d->ensureContentsAdapter();
+    // Compile the dialog and menu delegates in the background, so that the first
+    // one shown only needs to be instantiated. Views of the same engine share them.
+    d->ui()->preloadComponents();
 }
 
 QQuickWebEngineFullScreenRequest::QQuickWebEngineFullScreenRequest()
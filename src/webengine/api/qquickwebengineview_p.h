@@ -102,7 +102,7 @@ private:
     const bool m_toggleOn;
 };
 
-#define LATEST_WEBENGINEVIEW_REVISION 7
+#define LATEST_WEBENGINEVIEW_REVISION 8
 
 class Q_WEBENGINE_PRIVATE_EXPORT QQuickWebEngineView : public QQuickItem {
     Q_OBJECT
@@ -130,6 +130,8 @@ class Q_WEBENGINE_PRIVATE_EXPORT QQuickWebEngineView : public QQuickItem {
 
     Q_PROPERTY(QQuickWebEngineView *inspectedView READ inspectedView WRITE setInspectedView NOTIFY inspectedViewChanged REVISION 7 FINAL)
     Q_PROPERTY(QQuickWebEngineView *devToolsView READ devToolsView WRITE setDevToolsView NOTIFY devToolsViewChanged REVISION 7 FINAL)
+    Q_PROPERTY(LifecycleState lifecycleState READ lifecycleState WRITE setLifecycleState NOTIFY lifecycleStateChanged REVISION 8 FINAL)
+    Q_PROPERTY(bool delegatesReady READ delegatesReady NOTIFY delegatesReadyChanged REVISION 8 FINAL)
 #ifdef ENABLE_QML_TESTSUPPORT_API
     Q_PROPERTY(QQuickWebEngineTestSupport *testSupport READ testSupport WRITE setTestSupport NOTIFY testSupportChanged FINAL)
 #endif
@@ -289,6 +291,14 @@ public:
     };
     Q_ENUM(RenderProcessTerminationStatus)
 
+    // must match WebContentsAdapterClient::LifecycleState
+    enum class LifecycleState {
+        Active,
+        Frozen,
+        Discarded,
+    };
+    Q_ENUM(LifecycleState)
+
     enum FindFlag {
         FindBackward = 1,
         FindCaseSensitively = 2,
@@ -486,6 +496,11 @@ public:
     void setDevToolsView(QQuickWebEngineView *);
     QQuickWebEngineView *devToolsView() const;
 
+    LifecycleState lifecycleState() const;
+    void setLifecycleState(LifecycleState state);
+
+    bool delegatesReady() const;
+
 public Q_SLOTS:
     void runJavaScript(const QString&, const QJSValue & = QJSValue());
     Q_REVISION(3) void runJavaScript(const QString&, quint32 worldId, const QJSValue & = QJSValue());
@@ -546,6 +561,9 @@ Q_SIGNALS:
     Q_REVISION(7) void inspectedViewChanged();
     Q_REVISION(7) void devToolsViewChanged();
     Q_REVISION(7) void registerProtocolHandlerRequested(const QWebEngineRegisterProtocolHandlerRequest &request);
+    Q_REVISION(8) void lifecycleStateChanged(LifecycleState state);
+    Q_REVISION(8) void uploadProgress(qint64 bytesSent, qint64 bytesTotal);
+    Q_REVISION(8) void delegatesReadyChanged();
 
 #ifdef ENABLE_QML_TESTSUPPORT_API
     void testSupportChanged();
@@ -126,11 +126,15 @@ public:
     void didRunJavaScript(quint64, const QVariant&) override;
     void didFetchDocumentMarkup(quint64, const QString&) override { }
     void didFetchDocumentInnerText(quint64, const QString&) override { }
+    void didStreamDocumentContent(quint64, const QByteArray &) override { }
+    void didGrabImage(quint64, const QImage &) override { }
     void didFindText(quint64, int) override;
     void didPrintPage(quint64 requestId, const QByteArray &result) override;
     void didPrintPageToPdf(const QString &filePath, bool success) override;
+    void uploadProgress(qint64 bytesSent, qint64 bytesTotal) override;
     void passOnFocus(bool reverse) override;
     void javaScriptConsoleMessage(JavaScriptConsoleMessageLevel level, const QString& message, int lineNumber, const QString& sourceID) override;
+    void javaScriptConsoleMessagesDropped(int count) override;
     void authenticationRequired(QSharedPointer<QtWebEngineCore::AuthenticationDialogController>) override;
     void runMediaAccessPermissionRequest(const QUrl &securityOrigin, MediaRequestFlags requestFlags) override;
     void runMouseLockPermissionRequest(const QUrl &securityOrigin) override;
@@ -149,6 +153,8 @@ public:
     bool supportsDragging() const override;
     bool isEnabled() const override;
     void setToolTip(const QString &toolTipText) override;
+    void lifecycleStateChanged(LifecycleState state) override;
+    QImage discardSnapshot() override;
     const QObject *holdingQObject() const override;
 
     QtWebEngineCore::BrowserContextAdapter *browserContextAdapter() override;
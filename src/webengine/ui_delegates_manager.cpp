@@ -154,47 +154,63 @@ bool UIDelegatesManager::initializeImportDirs(QStringList &dirs, QQmlEngine *eng
     return false;
 }
 
-bool UIDelegatesManager::ensureComponentLoaded(ComponentType type)
+UIDelegatesComponentCache *UIDelegatesManager::componentCache()
 {
-    QQmlEngine* engine = qmlEngine(m_view);
-    if (m_importDirs.isEmpty() && !initializeImportDirs(m_importDirs, engine))
-        return false;
+    if (m_componentCache)
+        return m_componentCache;
+    QQmlEngine *engine = qmlEngine(m_view);
+    if (!engine)
+        return nullptr;
+    m_componentCache = UIDelegatesComponentCache::find(engine, controlsVersion());
+    if (!m_componentCache) {
+        QStringList importDirs;
+        if (!initializeImportDirs(importDirs, engine))
+            return nullptr;
+        m_componentCache = new UIDelegatesComponentCache(engine, controlsVersion(), importDirs);
+    }
+    return m_componentCache;
+}
 
-    QQmlComponent **component;
+void UIDelegatesManager::preloadComponents()
+{
+    UIDelegatesComponentCache *cache = componentCache();
+    if (!cache)
+        return;
+    if (cache->isReady()) {
+        // Compiled for an earlier view of the engine.
+        Q_EMIT m_view->delegatesReadyChanged();
+        return;
+    }
+    QObject::connect(cache, &UIDelegatesComponentCache::ready, m_view, &QQuickWebEngineView::delegatesReadyChanged,
+                     Qt::UniqueConnection);
+    cache->preload();
+}
+
+bool UIDelegatesManager::componentsReady() const
+{
+    return m_componentCache && m_componentCache->isReady();
+}
+
+bool UIDelegatesManager::ensureComponentLoaded(ComponentType type)
+{
+    QPointer<QQmlComponent> *component;
     switch (type) {
     FOR_EACH_COMPONENT_TYPE(COMPONENT_MEMBER_CASE_STATEMENT, NO_SEPARATOR)
     default:
         Q_UNREACHABLE();
         return false;
     }
-    QString fileName(fileNameForComponent(type));
 #ifndef UI_DELEGATES_DEBUG
     if (*component)
         return true;
 #else // Unconditionally reload the components each time.
-    fprintf(stderr, "%s: %s\n", Q_FUNC_INFO, qPrintable(fileName));
+    fprintf(stderr, "%s: %s\n", Q_FUNC_INFO, qPrintable(fileNameForComponent(type)));
 #endif
-    if (!engine)
+    UIDelegatesComponentCache *cache = componentCache();
+    if (!cache)
         return false;
-
-    foreach (const QString &importDir, m_importDirs) {
-        QFileInfo fi(importDir % QLatin1Char('/') % fileName);
-        if (!fi.exists())
-            continue;
-        // FIXME: handle async loading
-        *component = (new QQmlComponent(engine, QUrl::fromLocalFile(fi.absoluteFilePath()),
-                                        QQmlComponent::PreferSynchronous, m_view));
-
-        if ((*component)->status() != QQmlComponent::Ready) {
-            foreach (const QQmlError &err, (*component)->errors())
-                qWarning("QtWebEngine: component error: %s\n", qPrintable(err.toString()));
-            delete *component;
-            *component = nullptr;
-            return false;
-        }
-        return true;
-    }
-    return false;
+    *component = cache->component(type);
+    return *component;
 }
 
 #define CHECK_QML_SIGNAL_PROPERTY(prop, location) \
@@ -568,6 +584,133 @@ void UIDelegatesManager::showToolTip(const QString &text)
     QMetaObject::invokeMethod(m_toolTip.data(), "open");
 }
 
+UIDelegatesComponentCache *UIDelegatesComponentCache::find(QQmlEngine *engine, int controlsVersion)
+{
+    const QList<UIDelegatesComponentCache *> caches =
+            engine->findChildren<UIDelegatesComponentCache *>(QString(), Qt::FindDirectChildrenOnly);
+    for (UIDelegatesComponentCache *cache : caches) {
+        if (cache->controlsVersion() == controlsVersion)
+            return cache;
+    }
+    return nullptr;
+}
+
+UIDelegatesComponentCache::UIDelegatesComponentCache(QQmlEngine *engine, int controlsVersion, const QStringList &importDirs)
+    : QObject(engine)
+    , m_engine(engine)
+    , m_controlsVersion(controlsVersion)
+    , m_importDirs(importDirs)
+    , m_pendingCount(0)
+    , m_preloadStarted(false)
+{
+    for (int i = 0; i < UIDelegatesManager::ComponentTypeCount; ++i) {
+        m_urlResolved[i] = false;
+        m_components[i] = nullptr;
+        m_pending[i] = false;
+    }
+}
+
+QUrl UIDelegatesComponentCache::componentUrl(UIDelegatesManager::ComponentType type)
+{
+    if (!m_urlResolved[type]) {
+        m_urlResolved[type] = true;
+        const QString fileName = fileNameForComponent(type);
+        foreach (const QString &importDir, m_importDirs) {
+            QFileInfo fi(importDir % QLatin1Char('/') % fileName);
+            if (fi.exists()) {
+                m_urls[type] = QUrl::fromLocalFile(fi.absoluteFilePath());
+                break;
+            }
+        }
+    }
+    return m_urls[type];
+}
+
+// Compiles all components on the type loader thread. The GUI thread is only
+// involved once a component is needed.
+void UIDelegatesComponentCache::preload()
+{
+    if (m_preloadStarted)
+        return;
+    m_preloadStarted = true;
+    for (int i = 0; i < UIDelegatesManager::ComponentTypeCount; ++i) {
+        const UIDelegatesManager::ComponentType type = UIDelegatesManager::ComponentType(i);
+        if (m_components[type])
+            continue;
+        const QUrl url = componentUrl(type);
+        if (url.isEmpty())
+            continue;
+        m_components[type] = new QQmlComponent(m_engine, url, QQmlComponent::Asynchronous, this);
+        if (!m_components[type]->isLoading()) {
+            takeLoadedComponent(type);
+            continue;
+        }
+        m_pending[type] = true;
+        ++m_pendingCount;
+        connect(m_components[type], &QQmlComponent::statusChanged, this, [this, type]() {
+            componentStatusChanged(type);
+        });
+    }
+    if (!m_pendingCount)
+        Q_EMIT ready();
+}
+
+void UIDelegatesComponentCache::componentStatusChanged(UIDelegatesManager::ComponentType type)
+{
+    if (m_components[type]->isLoading())
+        return;
+    takeLoadedComponent(type);
+    if (m_pending[type]) {
+        m_pending[type] = false;
+        if (--m_pendingCount == 0)
+            Q_EMIT ready();
+    }
+}
+
+bool UIDelegatesComponentCache::takeLoadedComponent(UIDelegatesManager::ComponentType type)
+{
+    QQmlComponent *component = m_components[type];
+    if (component->status() == QQmlComponent::Ready)
+        return true;
+    foreach (const QQmlError &err, component->errors())
+        qWarning("QtWebEngine: component error: %s\n", qPrintable(err.toString()));
+    // Might be called from the component's own signal.
+    component->deleteLater();
+    m_components[type] = nullptr;
+    return false;
+}
+
+QQmlComponent *UIDelegatesComponentCache::component(UIDelegatesManager::ComponentType type)
+{
+#ifdef UI_DELEGATES_DEBUG
+    if (m_components[type] && !m_pending[type]) {
+        m_components[type]->deleteLater();
+        m_components[type] = nullptr;
+    }
+#endif
+    if (m_components[type] && m_components[type]->status() == QQmlComponent::Ready)
+        return m_components[type];
+    const QUrl url = componentUrl(type);
+    if (url.isEmpty())
+        return nullptr;
+
+    if (QQmlComponent *loading = m_components[type]) {
+        // Needed before the background compilation finished. A synchronous component
+        // for the same URL takes over the compilation already in progress.
+        loading->disconnect(this);
+        loading->deleteLater();
+        m_components[type] = nullptr;
+        if (m_pending[type]) {
+            m_pending[type] = false;
+            if (--m_pendingCount == 0)
+                Q_EMIT ready();
+        }
+    }
+    m_components[type] = new QQmlComponent(m_engine, url, QQmlComponent::PreferSynchronous, this);
+    takeLoadedComponent(type);
+    return m_components[type];
+}
+
 UI2DelegatesManager::UI2DelegatesManager(QQuickWebEngineView *view) : UIDelegatesManager(view)
 {
 
@@ -47,7 +47,9 @@
 #include <QCoreApplication>
 #include <QExplicitlySharedDataPointer>
 #include <QPoint>
+#include <QPointer>
 #include <QSharedPointer>
+#include <QUrl>
 
 #define FOR_EACH_COMPONENT_TYPE(F, SEPARATOR) \
     F(Menu, menu) SEPARATOR \
@@ -66,7 +68,7 @@
 #define ENUM_DECLARATION(TYPE, COMPONENT) \
     TYPE
 #define MEMBER_DECLARATION(TYPE, COMPONENT) \
-    QQmlComponent *COMPONENT##Component
+    QPointer<QQmlComponent> COMPONENT##Component
 
 QT_BEGIN_NAMESPACE
 class QQmlContext;
@@ -92,6 +94,8 @@ Q_SIGNALS:
     void triggered();
 };
 
+class UIDelegatesComponentCache;
+
 class UIDelegatesManager
 {
     Q_DECLARE_TR_FUNCTIONS(UIDelegatesManager)
@@ -106,6 +110,8 @@ public:
     virtual ~UIDelegatesManager();
 
     virtual bool initializeImportDirs(QStringList &dirs, QQmlEngine *engine);
+    void preloadComponents();
+    bool componentsReady() const;
     virtual void addMenuItem(MenuItemHandler *menuItemHandler, const QString &text,
                              const QString &iconName = QString(),
                              bool enabled = true,
@@ -123,11 +129,15 @@ public:
 
 protected:
     bool ensureComponentLoaded(ComponentType);
+    UIDelegatesComponentCache *componentCache();
+    // Identifies the delegate set, managers with the same set share a component cache.
+    virtual int controlsVersion() const { return 1; }
 
     QQuickWebEngineView *m_view;
     QScopedPointer<QObject> m_toolTip;
-    QStringList m_importDirs;
+    QPointer<UIDelegatesComponentCache> m_componentCache;
 
+    // Owned by m_componentCache, which is owned by the QML engine and can replace them.
     FOR_EACH_COMPONENT_TYPE(MEMBER_DECLARATION, SEMICOLON_SEPARATOR)
 
     Q_DISABLE_COPY(UIDelegatesManager)
@@ -150,6 +160,45 @@ public:
     void showMenu(QObject *menu) override;
     Q_DISABLE_COPY(UI2DelegatesManager)
 
+protected:
+    int controlsVersion() const override { return 2; }
+
+};
+
+// Compiled delegate components of one delegate set, shared by all views of a QQmlEngine.
+// The components are compiled asynchronously by preload(), a component that is needed
+// before it is ready finishes loading synchronously.
+class UIDelegatesComponentCache : public QObject
+{
+    Q_OBJECT
+public:
+    static UIDelegatesComponentCache *find(QQmlEngine *engine, int controlsVersion);
+    UIDelegatesComponentCache(QQmlEngine *engine, int controlsVersion, const QStringList &importDirs);
+
+    int controlsVersion() const { return m_controlsVersion; }
+    QQmlComponent *component(UIDelegatesManager::ComponentType type);
+    void preload();
+    bool isReady() const { return m_preloadStarted && !m_pendingCount; }
+
+Q_SIGNALS:
+    void ready();
+
+private:
+    QUrl componentUrl(UIDelegatesManager::ComponentType type);
+    bool takeLoadedComponent(UIDelegatesManager::ComponentType type);
+    void componentStatusChanged(UIDelegatesManager::ComponentType type);
+
+    QQmlEngine *m_engine;
+    int m_controlsVersion;
+    QStringList m_importDirs;
+    QUrl m_urls[UIDelegatesManager::ComponentTypeCount];
+    bool m_urlResolved[UIDelegatesManager::ComponentTypeCount];
+    QQmlComponent *m_components[UIDelegatesManager::ComponentTypeCount];
+    bool m_pending[UIDelegatesManager::ComponentTypeCount];
+    int m_pendingCount;
+    bool m_preloadStarted;
+
+    Q_DISABLE_COPY(UIDelegatesComponentCache)
 };
 
 } // namespace QtWebEngineCore
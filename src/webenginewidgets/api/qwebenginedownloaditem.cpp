@@ -167,6 +167,7 @@ QWebEngineDownloadItemPrivate::QWebEngineDownloadItemPrivate(QWebEngineProfilePr
     , interruptReason(QWebEngineDownloadItem::NoReason)
     , downloadUrl(url)
     , downloadPaused(false)
+    , inMemory(false)
     , totalBytes(-1)
     , receivedBytes(0)
 {
@@ -208,6 +209,16 @@ void QWebEngineDownloadItemPrivate::update(const BrowserContextAdapterClient::Do
     }
 }
 
+void QWebEngineDownloadItemPrivate::dataReceived(const QByteArray &data)
+{
+    Q_Q(QWebEngineDownloadItem);
+
+    if (device && device->write(data) != data.size())
+        qWarning("Failed to write the downloaded data to the device: %s", qPrintable(device->errorString()));
+
+    Q_EMIT q->dataReceived(data);
+}
+
 /*!
     Accepts the current download request, which will start the download.
 
@@ -341,6 +352,16 @@ quint32 QWebEngineDownloadItem::id() const
     \sa state(), DownloadState
 */
 
+/*!
+    \fn void QWebEngineDownloadItem::dataReceived(const QByteArray &data)
+    \since 5.12
+
+    This signal is emitted for each chunk of \a data received by an in-memory
+    download, after it has been written to device(), if any.
+
+    \sa setInMemory(), setDevice()
+*/
+
 /*!
     \fn void QWebEngineDownloadItem::downloadProgress(qint64 bytesReceived, qint64 bytesTotal)
 
@@ -604,6 +625,94 @@ bool QWebEngineDownloadItem::isSavePageDownload() const
     return d->type == QWebEngineDownloadItem::SavePage;
 }
 
+/*!
+    Returns the device the downloaded data is written to, or \c nullptr if the
+    download is written to path().
+    \since 5.12
+
+    \sa setDevice(), isInMemory()
+*/
+
+QIODevice *QWebEngineDownloadItem::device() const
+{
+    Q_D(const QWebEngineDownloadItem);
+    return d->device;
+}
+
+/*!
+    Writes the downloaded data to \a device instead of the file at path().
+    \since 5.12
+
+    The device must be open for writing and outlive the download. The data is
+    also delivered with the dataReceived() signal. Setting a device implies
+    setInMemory(true), so the data passes through a temporary file of its full
+    size first, see setInMemory().
+
+    The device can only be set in response to the
+    QWebEngineProfile::downloadRequested() signal before the download is
+    accepted. It is ignored for web page downloads.
+
+    \sa device(), dataReceived()
+*/
+
+void QWebEngineDownloadItem::setDevice(QIODevice *device)
+{
+    Q_D(QWebEngineDownloadItem);
+    if (d->downloadState != QWebEngineDownloadItem::DownloadRequested) {
+        qWarning("Setting the download device is not allowed after the download has been accepted.");
+        return;
+    }
+
+    d->device = device;
+    d->inMemory = d->inMemory || device;
+}
+
+/*!
+    Returns whether the downloaded data is delivered through dataReceived()
+    instead of being written to path().
+    \since 5.12
+
+    \sa setInMemory()
+*/
+
+bool QWebEngineDownloadItem::isInMemory() const
+{
+    Q_D(const QWebEngineDownloadItem);
+    return d->inMemory && !isSavePageDownload();
+}
+
+/*!
+    Sets whether the downloaded data is delivered in chunks through the
+    dataReceived() signal instead of being written to path(), according to
+    \a inMemory.
+    \since 5.12
+
+    This can only be set in response to the
+    QWebEngineProfile::downloadRequested() signal before the download is
+    accepted. It is ignored for web page downloads.
+
+    The data still passes through a temporary file in QDir::tempPath(), which
+    is deleted once the data has been delivered. The download therefore needs
+    as much free temporary disk space as the full size of the downloaded data.
+    If the data is not consumed as fast as it arrives, the download is paused
+    until the consumer catches up.
+
+    \sa isInMemory(), setDevice()
+*/
+
+void QWebEngineDownloadItem::setInMemory(bool inMemory)
+{
+    Q_D(QWebEngineDownloadItem);
+    if (d->downloadState != QWebEngineDownloadItem::DownloadRequested) {
+        qWarning("Changing the download destination is not allowed after the download has been accepted.");
+        return;
+    }
+
+    d->inMemory = inMemory;
+    if (!inMemory)
+        d->device = nullptr;
+}
+
 /*!
     Returns the reason why the download was interrupted.
     \since 5.9
@@ -46,6 +46,7 @@
 
 QT_BEGIN_NAMESPACE
 
+class QIODevice;
 class QWebEngineDownloadItemPrivate;
 class QWebEngineProfilePrivate;
 
@@ -127,6 +128,10 @@ public:
     DownloadInterruptReason interruptReason() const;
     QString interruptReasonString() const;
     bool isSavePageDownload() const;
+    QIODevice *device() const;
+    void setDevice(QIODevice *device);
+    bool isInMemory() const;
+    void setInMemory(bool inMemory);
 
 public Q_SLOTS:
     void accept();
@@ -139,6 +144,7 @@ Q_SIGNALS:
     void stateChanged(QWebEngineDownloadItem::DownloadState state);
     void downloadProgress(qint64 bytesReceived, qint64 bytesTotal);
     void isPausedChanged(bool isPaused);
+    void dataReceived(const QByteArray &data);
 
 private:
     Q_DISABLE_COPY(QWebEngineDownloadItem)
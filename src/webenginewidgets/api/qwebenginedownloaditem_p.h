@@ -55,6 +55,8 @@
 
 #include "qwebenginedownloaditem_p.h"
 #include "qwebengineprofile_p.h"
+#include <QIODevice>
+#include <QPointer>
 #include <QString>
 
 QT_BEGIN_NAMESPACE
@@ -78,11 +80,14 @@ public:
     const QUrl downloadUrl;
     QString mimeType;
     bool downloadPaused;
+    QPointer<QIODevice> device;
+    bool inMemory;
 
     qint64 totalBytes;
     qint64 receivedBytes;
 
     void update(const QtWebEngineCore::BrowserContextAdapterClient::DownloadItemInfo &info);
+    void dataReceived(const QByteArray &data);
 };
 
 QT_END_NAMESPACE
@@ -398,6 +398,12 @@ void QWebEnginePagePrivate::didPrintPageToPdf(const QString &filePath, bool succ
     Q_EMIT q->pdfPrintingFinished(filePath, success);
 }
 
+void QWebEnginePagePrivate::uploadProgress(qint64 bytesSent, qint64 bytesTotal)
+{
+    Q_Q(QWebEnginePage);
+    Q_EMIT q->uploadProgress(bytesSent, bytesTotal);
+}
+
 void QWebEnginePagePrivate::focusContainer()
 {
     if (view) {
@@ -491,6 +497,19 @@ void QWebEnginePagePrivate::didFetchDocumentInnerText(quint64 requestId, const Q
     m_callbacks.invoke(requestId, result);
 }
 
+void QWebEnginePagePrivate::didGrabImage(quint64 requestId, const QImage &image)
+{
+    m_callbacks.invoke(requestId, image);
+}
+
+void QWebEnginePagePrivate::didStreamDocumentContent(quint64 requestId, const QByteArray &chunk)
+{
+    if (chunk.isEmpty())
+        m_callbacks.invoke(requestId, chunk);
+    else
+        m_callbacks.invokePartial(requestId, chunk);
+}
+
 void QWebEnginePagePrivate::didFindText(quint64 requestId, int matchCount)
 {
     m_callbacks.invoke(requestId, matchCount > 0);
@@ -804,6 +823,21 @@ QWebEnginePage::QWebEnginePage(QObject* parent)
     \sa printToPdf()
 */
 
+/*!
+    \fn void QWebEnginePage::uploadProgress(qint64 bytesSent, qint64 bytesTotal)
+    \since 5.12
+
+    This signal is emitted while the body of a navigation request, such as a
+    submitted form or a QWebEngineHttpRequest with POST data, is being uploaded.
+    \a bytesSent is the number of bytes uploaded so far, and \a bytesTotal the
+    size of the body.
+
+    The upload position is sampled by the network stack, so the signal is not
+    emitted for small bodies that are sent at once.
+
+    \sa QWebEngineHttpRequest::setPostDataFile(), QWebEngineHttpRequest::setPostDataDevice()
+*/
+
 /*!
     \property QWebEnginePage::scrollPosition
     \since 5.7
@@ -838,6 +872,15 @@ QWebEnginePage::QWebEnginePage(QObject* parent)
     delay}, from the moment the audio is paused.
 */
 
+/*!
+    \fn void QWebEnginePage::javaScriptConsoleMessagesDropped(int count)
+    \since 5.12
+
+    This signal is emitted after a batch of JavaScript console messages has been
+    delivered, when \a count messages were dropped by the filter set with
+    setJavaScriptConsoleMessageFilter().
+*/
+
 /*!
     \fn void QWebEnginePage::iconUrlChanged(const QUrl &url)
 
@@ -1039,6 +1082,195 @@ bool QWebEnginePage::recentlyAudible() const
     return d->adapter->isInitialized() && d->adapter->recentlyAudible();
 }
 
+/*!
+    \enum QWebEnginePage::LifecycleState
+    \since 5.12
+
+    This enum describes the lifecycle state of the page:
+
+    \value  Active
+            Normal state.
+    \value  Frozen
+            Low CPU usage state where most HTML task sources are suspended.
+    \value  Discarded
+            Very low resource usage state where the entire browsing context is discarded.
+            The navigation history and a snapshot of the page are kept, and the page is
+            reloaded transparently when it becomes visible again.
+
+    \sa lifecycleState, discardedSnapshot()
+*/
+
+/*!
+    \property QWebEnginePage::lifecycleState
+    \since 5.12
+
+    \brief The current lifecycle state of the page.
+
+    The following restrictions are enforced:
+
+    \list
+    \li A visible page must remain in the \c{Active} state.
+    \li Calling runJavaScript(), load() or reload() on a page that is not
+        \c{Active} brings it back to the \c{Active} state.
+    \endlist
+
+    Pages can also be frozen and discarded automatically by their profile, see
+    QWebEngineProfile::setLifecycleFreezeDelay() and
+    QWebEngineProfile::setLifecycleMemoryBudget().
+
+    The default value is \c{Active}.
+
+    \sa LifecycleState, discardedSnapshot()
+*/
+QWebEnginePage::LifecycleState QWebEnginePage::lifecycleState() const
+{
+    Q_D(const QWebEnginePage);
+    return static_cast<LifecycleState>(d->adapter->lifecycleState());
+}
+
+void QWebEnginePage::setLifecycleState(LifecycleState state)
+{
+    Q_D(QWebEnginePage);
+    d->adapter->setLifecycleState(static_cast<WebContentsAdapterClient::LifecycleState>(state));
+}
+
+/*!
+    \since 5.12
+
+    Returns the image of the page taken right before it was discarded, or a null image
+    if the page is not in the \c{Discarded} state or it had no view to take the image from.
+
+    \sa lifecycleState
+*/
+QImage QWebEnginePage::discardedSnapshot() const
+{
+    Q_D(const QWebEnginePage);
+    return d->adapter->discardedSnapshot();
+}
+
+/*!
+    \since 5.12
+
+    Filters the JavaScript console messages of the page before they reach
+    javaScriptConsoleMessage().
+
+    Messages with a level lower than \a minimumLevel are dropped. If
+    \a maxMessagesPerSecond is greater than zero, messages exceeding that rate
+    are dropped as well. The filter applies to messages of every kind, including
+    those generated by \c console.assert(), \c console.count(), and the engine
+    itself. The page's \c console object is left untouched.
+
+    The filter runs in the browser process. The render process still sends every
+    message, so the filter does not reduce inter-process communication. It saves
+    converting the dropped messages and delivering them to the application.
+
+    While a filter is set, messages are delivered in batches, and the number of
+    dropped messages is reported by the javaScriptConsoleMessagesDropped() signal.
+
+    Setting \c InfoMessageLevel without a rate limit, which is the default,
+    removes the filter.
+
+    \sa javaScriptConsoleMessageMinimumLevel(), javaScriptConsoleMessageRateLimit()
+*/
+void QWebEnginePage::setJavaScriptConsoleMessageFilter(JavaScriptConsoleMessageLevel minimumLevel, int maxMessagesPerSecond)
+{
+    Q_D(QWebEnginePage);
+    d->adapter->setJavaScriptConsoleMessageFilter(static_cast<WebContentsAdapterClient::JavaScriptConsoleMessageLevel>(minimumLevel),
+                                                  maxMessagesPerSecond);
+}
+
+/*!
+    \since 5.12
+
+    Returns the minimum level of the JavaScript console messages delivered to
+    javaScriptConsoleMessage().
+
+    \sa setJavaScriptConsoleMessageFilter()
+*/
+QWebEnginePage::JavaScriptConsoleMessageLevel QWebEnginePage::javaScriptConsoleMessageMinimumLevel() const
+{
+    Q_D(const QWebEnginePage);
+    return static_cast<JavaScriptConsoleMessageLevel>(d->adapter->javaScriptConsoleMessageMinimumLevel());
+}
+
+/*!
+    \since 5.12
+
+    Returns the maximum number of JavaScript console messages delivered per
+    second, or \c 0 if the messages are not rate limited.
+
+    \sa setJavaScriptConsoleMessageFilter()
+*/
+int QWebEnginePage::javaScriptConsoleMessageRateLimit() const
+{
+    Q_D(const QWebEnginePage);
+    return d->adapter->javaScriptConsoleMessageRateLimit();
+}
+
+/*!
+    \since 5.12
+
+    Limits the accessibility events the page sends to assistive technology to
+    \a maxEventsPerSecond. Events are always merged per accessible element and
+    delivered at most once per frame. Under the limit, pending events keep being
+    merged until they can be delivered. Events are always delivered in the order they
+    were queued. Focus changes are delivered right away unless the limit is reached.
+
+    The default of \c 0 does not limit the event rate.
+
+    \sa accessibilityEventRateLimit()
+*/
+void QWebEnginePage::setAccessibilityEventRateLimit(int maxEventsPerSecond)
+{
+    Q_D(QWebEnginePage);
+    d->adapter->setAccessibilityEventRateLimit(maxEventsPerSecond);
+}
+
+/*!
+    \since 5.12
+
+    Returns the maximum number of accessibility events delivered per second, or
+    \c 0 if they are not limited.
+
+    \sa setAccessibilityEventRateLimit()
+*/
+int QWebEnginePage::accessibilityEventRateLimit() const
+{
+    Q_D(const QWebEnginePage);
+    return d->adapter->accessibilityEventRateLimit();
+}
+
+/*!
+    \since 5.12
+
+    Returns a snapshot of the network traffic of the page since it was created or
+    since resetNetworkMetrics() was last called.
+
+    Requests of the page's frames and their subresources are counted, including
+    those of frames that have been navigated away from. Requests of workers are
+    only counted by the profile().
+
+    \sa resetNetworkMetrics(), QWebEngineProfile::networkMetrics()
+*/
+QWebEngineNetworkMetrics QWebEnginePage::networkMetrics() const
+{
+    Q_D(const QWebEnginePage);
+    return d->adapter->networkMetrics();
+}
+
+/*!
+    \since 5.12
+
+    Sets all network traffic counters of the page back to zero.
+
+    \sa networkMetrics()
+*/
+void QWebEnginePage::resetNetworkMetrics()
+{
+    Q_D(QWebEnginePage);
+    d->adapter->resetNetworkMetrics();
+}
+
 void QWebEnginePage::setView(QWidget *view)
 {
     QWebEngineViewPrivate::bind(qobject_cast<QWebEngineView*>(view), this);
@@ -1642,6 +1874,12 @@ void QWebEnginePagePrivate::javaScriptConsoleMessage(JavaScriptConsoleMessageLev
     q->javaScriptConsoleMessage(static_cast<QWebEnginePage::JavaScriptConsoleMessageLevel>(level), message, lineNumber, sourceID);
 }
 
+void QWebEnginePagePrivate::javaScriptConsoleMessagesDropped(int count)
+{
+    Q_Q(QWebEnginePage);
+    Q_EMIT q->javaScriptConsoleMessagesDropped(count);
+}
+
 void QWebEnginePagePrivate::renderProcessTerminated(RenderProcessTerminationStatus terminationStatus,
                                                 int exitCode)
 {
@@ -1704,6 +1942,19 @@ void QWebEnginePagePrivate::setToolTip(const QString &toolTipText)
         view->setToolTip(wrappedTip);
 }
 
+void QWebEnginePagePrivate::lifecycleStateChanged(LifecycleState state)
+{
+    Q_Q(QWebEnginePage);
+    Q_EMIT q->lifecycleStateChanged(static_cast<QWebEnginePage::LifecycleState>(state));
+}
+
+QImage QWebEnginePagePrivate::discardSnapshot()
+{
+    if (!view)
+        return QImage();
+    return view->grab().toImage();
+}
+
 QMenu *QWebEnginePage::createStandardContextMenu()
 {
     Q_D(QWebEnginePage);
@@ -1860,6 +2111,35 @@ void QWebEnginePage::toPlainText(const QWebEngineCallback<const QString &> &resu
     d->m_callbacks.registerCallback(requestId, resultCallback);
 }
 
+void QWebEnginePage::streamHtml(const QWebEngineCallback<const QByteArray &> &chunkCallback, qint64 maxBytes,
+                                const QStringList &subframeOrigins) const
+{
+    Q_D(const QWebEnginePage);
+    d->ensureInitialized();
+    quint64 requestId = d->adapter->streamDocumentMarkup(maxBytes, subframeOrigins);
+    d->m_callbacks.registerCallback(requestId, chunkCallback);
+}
+
+void QWebEnginePage::streamPlainText(const QWebEngineCallback<const QByteArray &> &chunkCallback, qint64 maxBytes) const
+{
+    Q_D(const QWebEnginePage);
+    d->ensureInitialized();
+    quint64 requestId = d->adapter->streamDocumentInnerText(maxBytes);
+    d->m_callbacks.registerCallback(requestId, chunkCallback);
+}
+
+void QWebEnginePage::grabToImage(const QRect &rect, qreal scale, const QWebEngineCallback<const QImage &> &resultCallback) const
+{
+    Q_D(const QWebEnginePage);
+    d->ensureInitialized();
+    quint64 requestId = d->adapter->grabImage(rect, scale);
+    if (!requestId) {
+        d->m_callbacks.invokeEmpty(resultCallback);
+        return;
+    }
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
 void QWebEnginePage::setHtml(const QString &html, const QUrl &baseUrl)
 {
     setContent(html.toUtf8(), QStringLiteral("text/html;charset=UTF-8"), baseUrl);
@@ -1977,6 +2257,70 @@ void QWebEnginePage::runJavaScript(const QString& scriptSource, quint32 worldId,
     d->m_callbacks.registerCallback(requestId, resultCallback);
 }
 
+/*!
+    \since 5.12
+
+    Runs the JavaScript code contained in \a scriptSource in the world specified by
+    \a worldId, and calls \a resultCallback with the result of the last executed
+    statement converted as specified by \a format.
+
+    The \c JsonResult and \c CborResult formats serialize the result directly into
+    a QByteArray, which is much cheaper than building nested QVariantMap and
+    QVariantList values for large results. \c JsonValueResult delivers a QJsonValue
+    that is only converted as it is accessed.
+
+    \sa JavaScriptResultFormat
+*/
+void QWebEnginePage::runJavaScript(const QString &scriptSource, quint32 worldId, JavaScriptResultFormat format,
+                                   const QWebEngineCallback<const QVariant &> &resultCallback)
+{
+    Q_D(QWebEnginePage);
+    d->ensureInitialized();
+    quint64 requestId = d->adapter->runJavaScriptCallbackResult(scriptSource, worldId,
+                                                                WebContentsAdapterClient::JavaScriptResultFormat(format));
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Runs the JavaScript code contained in \a scriptSource in the world specified by
+    \a worldId in every frame of the page whose security origin matches
+    \a originPattern, such as \c {https://*.example.com}. An empty pattern matches
+    all frames. Patterns have the form \c {scheme://host:port}, where the scheme, the
+    host, and the port can be \c {*}, and the host can start with \c {*.} to include
+    all of its subdomains. Without a port, only the default port of the scheme matches.
+    An invalid pattern matches no frame.
+
+    \a resultCallback is called once with a QVariantList holding a QVariantMap for
+    each frame the script was run in, with the following keys:
+
+    \table
+    \header \li Key \li Value
+    \row \li \c url \li The URL of the document in the frame.
+    \row \li \c origin \li The serialized security origin of the frame.
+    \row \li \c frameName \li The name of the frame.
+    \row \li \c result \li The result of the last executed statement, converted as
+         by runJavaScript().
+    \row \li \c timedOut \li \c true if the frame did not reply in time, or went away
+         before replying. The frame has no \c result then.
+    \endtable
+
+    If \a timeoutMs is positive, the callback is called after that many milliseconds
+    at the latest, and replies of frames arriving afterwards are dropped. Without a
+    deadline, frames that are alive but never reply keep the callback waiting.
+
+    \sa runJavaScript()
+*/
+void QWebEnginePage::runJavaScriptInFrames(const QString &scriptSource, quint32 worldId, const QString &originPattern,
+                                           int timeoutMs, const QWebEngineCallback<const QVariant &> &resultCallback)
+{
+    Q_D(QWebEnginePage);
+    d->ensureInitialized();
+    quint64 requestId = d->adapter->runJavaScriptInFrames(scriptSource, worldId, originPattern, timeoutMs);
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
 /*!
     Returns the collection of scripts that are injected into the page.
 
@@ -2092,6 +2436,13 @@ void QWebEnginePage::setDevToolsPage(QWebEnginePage *devToolsPage)
     }
 }
 
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::VariantResult, QWebEnginePage::VariantResult)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::JsonResult, QWebEnginePage::JsonResult)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::CborResult, QWebEnginePage::CborResult)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::JsonValueResult, QWebEnginePage::JsonValueResult)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::LifecycleState::Active, QWebEnginePage::LifecycleState::Active)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::LifecycleState::Frozen, QWebEnginePage::LifecycleState::Frozen)
+ASSERT_ENUMS_MATCH(WebContentsAdapterClient::LifecycleState::Discarded, QWebEnginePage::LifecycleState::Discarded)
 ASSERT_ENUMS_MATCH(FilePickerController::Open, QWebEnginePage::FileSelectOpen)
 ASSERT_ENUMS_MATCH(FilePickerController::OpenMultiple, QWebEnginePage::FileSelectOpenMultiple)
 
@@ -45,8 +45,11 @@
 #include <QtWebEngineWidgets/qwebenginedownloaditem.h>
 #include <QtWebEngineCore/qwebenginecallback.h>
 #include <QtWebEngineCore/qwebenginehttprequest.h>
+#include <QtWebEngineCore/qwebenginenetworkmetrics.h>
 
 #include <QtCore/qobject.h>
+#include <QtCore/qrect.h>
+#include <QtCore/qstringlist.h>
 #include <QtCore/qurl.h>
 #include <QtCore/qvariant.h>
 #include <QtGui/qpagelayout.h>
@@ -54,6 +57,7 @@
 #include <QtWidgets/qwidget.h>
 
 QT_BEGIN_NAMESPACE
+class QImage;
 class QMenu;
 class QPrinter;
 
@@ -70,6 +74,8 @@ class QWebEngineRegisterProtocolHandlerRequest;
 class QWebEngineScriptCollection;
 class QWebEngineSettings;
 
+Q_DECLARE_SHARED(QWebEngineCallback<const QImage &>)
+
 class QWEBENGINEWIDGETS_EXPORT QWebEnginePage : public QObject {
     Q_OBJECT
     Q_PROPERTY(QString selectedText READ selectedText)
@@ -87,6 +93,7 @@ class QWEBENGINEWIDGETS_EXPORT QWebEnginePage : public QObject {
     Q_PROPERTY(QPointF scrollPosition READ scrollPosition NOTIFY scrollPositionChanged)
     Q_PROPERTY(bool audioMuted READ isAudioMuted WRITE setAudioMuted NOTIFY audioMutedChanged)
     Q_PROPERTY(bool recentlyAudible READ recentlyAudible NOTIFY recentlyAudibleChanged)
+    Q_PROPERTY(LifecycleState lifecycleState READ lifecycleState WRITE setLifecycleState NOTIFY lifecycleStateChanged)
 
 public:
     enum WebAction {
@@ -213,6 +220,15 @@ public:
     };
     Q_ENUM(JavaScriptConsoleMessageLevel)
 
+    // must match WebContentsAdapterClient::JavaScriptResultFormat
+    enum JavaScriptResultFormat {
+        VariantResult = 0,
+        JsonResult,
+        CborResult,
+        JsonValueResult
+    };
+    Q_ENUM(JavaScriptResultFormat)
+
     // must match WebContentsAdapterClient::RenderProcessTerminationStatus
     enum RenderProcessTerminationStatus {
         NormalTerminationStatus = 0,
@@ -222,6 +238,14 @@ public:
     };
     Q_ENUM(RenderProcessTerminationStatus)
 
+    // must match WebContentsAdapterClient::LifecycleState
+    enum class LifecycleState {
+        Active,
+        Frozen,
+        Discarded,
+    };
+    Q_ENUM(LifecycleState)
+
     explicit QWebEnginePage(QObject *parent = Q_NULLPTR);
     QWebEnginePage(QWebEngineProfile *profile, QObject *parent = Q_NULLPTR);
     ~QWebEnginePage();
@@ -258,6 +282,10 @@ public:
 
     void toHtml(const QWebEngineCallback<const QString &> &resultCallback) const;
     void toPlainText(const QWebEngineCallback<const QString &> &resultCallback) const;
+    void streamHtml(const QWebEngineCallback<const QByteArray &> &chunkCallback, qint64 maxBytes = -1,
+                    const QStringList &subframeOrigins = QStringList()) const;
+    void streamPlainText(const QWebEngineCallback<const QByteArray &> &chunkCallback, qint64 maxBytes = -1) const;
+    void grabToImage(const QRect &rect, qreal scale, const QWebEngineCallback<const QImage &> &resultCallback) const;
 
     QString title() const;
     void setUrl(const QUrl &url);
@@ -276,6 +304,10 @@ public:
     void runJavaScript(const QString& scriptSource, quint32 worldId);
     void runJavaScript(const QString& scriptSource, const QWebEngineCallback<const QVariant &> &resultCallback);
     void runJavaScript(const QString& scriptSource, quint32 worldId, const QWebEngineCallback<const QVariant &> &resultCallback);
+    void runJavaScript(const QString &scriptSource, quint32 worldId, JavaScriptResultFormat format,
+                       const QWebEngineCallback<const QVariant &> &resultCallback);
+    void runJavaScriptInFrames(const QString &scriptSource, quint32 worldId, const QString &originPattern,
+                               int timeoutMs, const QWebEngineCallback<const QVariant &> &resultCallback);
     QWebEngineScriptCollection &scripts();
     QWebEngineSettings *settings() const;
 
@@ -292,6 +324,20 @@ public:
     void setAudioMuted(bool muted);
     bool recentlyAudible() const;
 
+    LifecycleState lifecycleState() const;
+    void setLifecycleState(LifecycleState state);
+    QImage discardedSnapshot() const;
+
+    void setJavaScriptConsoleMessageFilter(JavaScriptConsoleMessageLevel minimumLevel, int maxMessagesPerSecond = 0);
+    JavaScriptConsoleMessageLevel javaScriptConsoleMessageMinimumLevel() const;
+    int javaScriptConsoleMessageRateLimit() const;
+
+    void setAccessibilityEventRateLimit(int maxEventsPerSecond);
+    int accessibilityEventRateLimit() const;
+
+    QWebEngineNetworkMetrics networkMetrics() const;
+    void resetNetworkMetrics();
+
     void printToPdf(const QString &filePath, const QPageLayout &layout = QPageLayout(QPageSize(QPageSize::A4), QPageLayout::Portrait, QMarginsF()));
     void printToPdf(const QWebEngineCallback<const QByteArray&> &resultCallback, const QPageLayout &layout = QPageLayout(QPageSize(QPageSize::A4), QPageLayout::Portrait, QMarginsF()));
     void print(QPrinter *printer, const QWebEngineCallback<bool> &resultCallback);
@@ -334,8 +380,11 @@ Q_SIGNALS:
     void contentsSizeChanged(const QSizeF &size);
     void audioMutedChanged(bool muted);
     void recentlyAudibleChanged(bool recentlyAudible);
+    void lifecycleStateChanged(LifecycleState state);
+    void javaScriptConsoleMessagesDropped(int count);
 
     void pdfPrintingFinished(const QString &filePath, bool success);
+    void uploadProgress(qint64 bytesSent, qint64 bytesTotal);
 
 protected:
     virtual QWebEnginePage *createWindow(WebWindowType type);
@@ -122,11 +122,15 @@ public:
     void didRunJavaScript(quint64 requestId, const QVariant& result) override;
     void didFetchDocumentMarkup(quint64 requestId, const QString& result) override;
     void didFetchDocumentInnerText(quint64 requestId, const QString& result) override;
+    void didStreamDocumentContent(quint64 requestId, const QByteArray &chunk) override;
+    void didGrabImage(quint64 requestId, const QImage &image) override;
     void didFindText(quint64 requestId, int matchCount) override;
     void didPrintPage(quint64 requestId, const QByteArray &result) override;
     void didPrintPageToPdf(const QString &filePath, bool success) override;
+    void uploadProgress(qint64 bytesSent, qint64 bytesTotal) override;
     void passOnFocus(bool reverse) override;
     void javaScriptConsoleMessage(JavaScriptConsoleMessageLevel level, const QString& message, int lineNumber, const QString& sourceID) override;
+    void javaScriptConsoleMessagesDropped(int count) override;
     void authenticationRequired(QSharedPointer<QtWebEngineCore::AuthenticationDialogController>) override;
     void runMediaAccessPermissionRequest(const QUrl &securityOrigin, MediaRequestFlags requestFlags) override;
     void runGeolocationPermissionRequest(const QUrl &securityOrigin) override;
@@ -145,6 +149,8 @@ public:
     bool supportsDragging() const override;
     bool isEnabled() const override;
     void setToolTip(const QString &toolTipText) override;
+    void lifecycleStateChanged(LifecycleState state) override;
+    QImage discardSnapshot() override;
     const QObject *holdingQObject() const override;
 
     QtWebEngineCore::BrowserContextAdapter *browserContextAdapter() override;
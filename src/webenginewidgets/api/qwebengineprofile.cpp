@@ -59,6 +59,29 @@ ASSERT_ENUMS_MATCH(QWebEngineDownloadItem::SingleHtmlSaveFormat, QtWebEngineCore
 ASSERT_ENUMS_MATCH(QWebEngineDownloadItem::CompleteHtmlSaveFormat, QtWebEngineCore::BrowserContextAdapterClient::CompleteHtmlSaveFormat)
 ASSERT_ENUMS_MATCH(QWebEngineDownloadItem::MimeHtmlSaveFormat, QtWebEngineCore::BrowserContextAdapterClient::MimeHtmlSaveFormat)
 
+ASSERT_ENUMS_MATCH(QWebEngineProfile::AllowStorageAccess, QtWebEngineCore::BrowserContextAdapter::AllowStorageAccess)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::BlockThirdPartyStorageAccess, QtWebEngineCore::BrowserContextAdapter::BlockThirdPartyStorageAccess)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::BlockStorageAccess, QtWebEngineCore::BrowserContextAdapter::BlockStorageAccess)
+
+ASSERT_ENUMS_MATCH(QWebEngineProfile::IdlePrefetchPriority, QtWebEngineCore::BrowserContextAdapter::IdlePrefetchPriority)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::LowPrefetchPriority, QtWebEngineCore::BrowserContextAdapter::LowPrefetchPriority)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::MediumPrefetchPriority, QtWebEngineCore::BrowserContextAdapter::MediumPrefetchPriority)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::HighPrefetchPriority, QtWebEngineCore::BrowserContextAdapter::HighPrefetchPriority)
+
+ASSERT_ENUMS_MATCH(QWebEngineProfile::AnyHttpAuthScheme, QtWebEngineCore::BrowserContextAdapter::AnyHttpAuthScheme)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::BasicHttpAuthScheme, QtWebEngineCore::BrowserContextAdapter::BasicHttpAuthScheme)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::DigestHttpAuthScheme, QtWebEngineCore::BrowserContextAdapter::DigestHttpAuthScheme)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::NtlmHttpAuthScheme, QtWebEngineCore::BrowserContextAdapter::NtlmHttpAuthScheme)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::NegotiateHttpAuthScheme, QtWebEngineCore::BrowserContextAdapter::NegotiateHttpAuthScheme)
+
+ASSERT_ENUMS_MATCH(QWebEngineProfile::GeolocationPermission, QtWebEngineCore::BrowserContextAdapter::GeolocationPermission)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::AudioCapturePermission, QtWebEngineCore::BrowserContextAdapter::AudioCapturePermission)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::VideoCapturePermission, QtWebEngineCore::BrowserContextAdapter::VideoCapturePermission)
+
+ASSERT_ENUMS_MATCH(QWebEngineProfile::AskPermission, QtWebEngineCore::BrowserContextAdapter::AskPermission)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::GrantedPermission, QtWebEngineCore::BrowserContextAdapter::GrantedPermission)
+ASSERT_ENUMS_MATCH(QWebEngineProfile::DeniedPermission, QtWebEngineCore::BrowserContextAdapter::DeniedPermission)
+
 using QtWebEngineCore::BrowserContextAdapter;
 
 /*!
@@ -131,6 +154,76 @@ using QtWebEngineCore::BrowserContextAdapter;
             Both session and persistent cookies are saved to and restored from disk.
 */
 
+/*!
+    \enum QWebEngineProfile::StorageAccessPolicy
+    \since 5.12
+
+    This enum describes the policy for access to web storage, that is DOM storage,
+    IndexedDB, web databases and the filesystem API:
+
+    \value  AllowStorageAccess
+            Storage access is only restricted by the cookie filter. This is the default setting.
+    \value  BlockThirdPartyStorageAccess
+            Frames from a different site than the top-level frame cannot access storage.
+    \value  BlockStorageAccess
+            No frame can access storage.
+
+    \sa QWebEngineCookieStore::setCookieFilter()
+*/
+
+/*!
+    \enum QWebEngineProfile::CertificateHashType
+    \since 5.12
+
+    This enum describes what the hash of a certificate exception is computed from.
+
+    \value  CertificateHash
+            The DER encoded certificate of the server.
+    \value  PublicKeyHash
+            The subject public key info of the server's certificate.
+
+    \sa addCertificateException()
+*/
+
+/*!
+    \enum QWebEngineProfile::PrefetchPriority
+    \since 5.12
+
+    This enum describes the network priority of a prefetch request. Even high priority
+    prefetches are scheduled after the main resources of the profile's pages.
+
+    \value  IdlePrefetchPriority
+            The request is only started when the network is otherwise idle. This is the default.
+    \value  LowPrefetchPriority
+            The request has the priority of a low priority subresource.
+    \value  MediumPrefetchPriority
+            The request has the priority of a script or an image.
+    \value  HighPrefetchPriority
+            The request has the priority of a synchronous script.
+
+    \sa prefetch()
+*/
+
+/*!
+    \enum QWebEngineProfile::HttpAuthScheme
+    \since 5.12
+
+    This enum describes the HTTP authentication scheme stored credentials are given for.
+
+    \value  AnyHttpAuthScheme
+            The credentials answer a challenge of any scheme.
+    \value  BasicHttpAuthScheme
+            The credentials answer Basic challenges.
+    \value  DigestHttpAuthScheme
+            The credentials answer Digest challenges.
+    \value  NtlmHttpAuthScheme
+            The credentials answer NTLM challenges.
+    \value  NegotiateHttpAuthScheme
+            The credentials answer Negotiate challenges.
+
+    \sa addHttpAuthCredentials()
+*/
+
 /*!
   \fn QWebEngineProfile::downloadRequested(QWebEngineDownloadItem *download)
 
@@ -215,6 +308,7 @@ void QWebEngineProfilePrivate::downloadRequested(DownloadItemInfo &info)
     info.savePageFormat = static_cast<QtWebEngineCore::BrowserContextAdapterClient::SavePageFormat>(
                 download->savePageFormat());
     info.accepted = state != QWebEngineDownloadItem::DownloadCancelled;
+    info.inMemory = download->isInMemory();
 
     if (state == QWebEngineDownloadItem::DownloadRequested) {
         // Delete unaccepted downloads.
@@ -242,6 +336,38 @@ void QWebEngineProfilePrivate::downloadUpdated(const DownloadItemInfo &info)
         m_ongoingDownloads.remove(info.id);
 }
 
+void QWebEngineProfilePrivate::downloadDataReceived(quint32 downloadId, const QByteArray &data)
+{
+    QWebEngineDownloadItem *download = m_ongoingDownloads.value(downloadId).data();
+    if (download)
+        download->d_func()->dataReceived(data);
+}
+
+void QWebEngineProfilePrivate::networkPredictionFinished(quint64 requestId, bool success)
+{
+    m_callbacks.invoke(requestId, success);
+}
+
+void QWebEngineProfilePrivate::httpCacheEntriesReceived(quint64 requestId, const QVector<QWebEngineHttpCacheEntry> &entries)
+{
+    m_callbacks.invoke(requestId, entries);
+}
+
+void QWebEngineProfilePrivate::httpCacheStatisticsReceived(quint64 requestId, const QWebEngineHttpCacheStatistics &statistics)
+{
+    m_callbacks.invoke(requestId, statistics);
+}
+
+void QWebEngineProfilePrivate::httpCacheEntryInserted(quint64 requestId, bool success)
+{
+    m_callbacks.invoke(requestId, success);
+}
+
+void QWebEngineProfilePrivate::httpCacheEntriesRemoved(quint64 requestId, int count)
+{
+    m_callbacks.invoke(requestId, count);
+}
+
 /*!
     Constructs a new off-the-record profile with the parent \a parent.
 
@@ -316,7 +442,8 @@ bool QWebEngineProfile::isOffTheRecord() const
 /*!
     Returns the path used to store persistent data for the browser and web content.
 
-    Persistent data includes persistent cookies, HTML5 local storage, and visited links.
+    Persistent data includes persistent cookies, HTML5 local storage, visited links, and
+    permission decisions.
 
     By default, this is below QStandardPaths::DataLocation in a QtWebengine/StorageName specific
     subdirectory.
@@ -753,4 +880,717 @@ void QWebEngineProfile::clearHttpCache()
     d->browserContext()->clearHttpCache();
 }
 
+/*!
+    \since 5.12
+
+    Lists the entries of the profile's HTTP cache.
+
+    The cache is enumerated on the network thread and \a resultCallback is called with
+    the entries when done. The list is empty if the profile has no HTTP cache.
+
+    \sa requestHttpCacheStatistics(), removeHttpCacheEntriesWithPrefix()
+*/
+void QWebEngineProfile::requestHttpCacheEntries(const QWebEngineCallback<const QVector<QWebEngineHttpCacheEntry> &> &resultCallback)
+{
+    Q_D(QWebEngineProfile);
+    quint64 requestId = d->browserContext()->requestHttpCacheEntries();
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Computes the number of entries and the total size of the profile's HTTP cache and
+    calls \a resultCallback with them. The statistics are invalid if the profile has
+    no HTTP cache.
+
+    \sa requestHttpCacheEntries()
+*/
+void QWebEngineProfile::requestHttpCacheStatistics(const QWebEngineCallback<const QWebEngineHttpCacheStatistics &> &resultCallback)
+{
+    Q_D(QWebEngineProfile);
+    quint64 requestId = d->browserContext()->requestHttpCacheStatistics();
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Stores a response to a GET request of \a url in the profile's HTTP cache, replacing
+    an existing entry of the URL.
+
+    \a headers holds the raw response headers separated by \c{"\r\n"}, optionally preceded
+    by a status line. Without a status line the response is stored as \c{200 OK}. The
+    headers decide whether and for how long the entry is used, like those of a response
+    received from the network. \a body is the response body, it is stored as is, so it
+    must not use a content encoding that the headers do not announce.
+
+    \a resultCallback is called with \c true when the entry was written. Only HTTP and
+    HTTPS URLs can be inserted.
+
+    \sa removeHttpCacheEntry()
+*/
+void QWebEngineProfile::insertHttpCacheEntry(const QUrl &url, const QByteArray &headers, const QByteArray &body,
+                                             const QWebEngineCallback<bool> &resultCallback)
+{
+    Q_D(QWebEngineProfile);
+    quint64 requestId = d->browserContext()->insertHttpCacheEntry(url, headers, body);
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Removes the cached response to a GET request of \a url from the profile's HTTP cache.
+    \a resultCallback is called with the number of removed entries.
+
+    \sa removeHttpCacheEntriesWithPrefix(), clearHttpCache()
+*/
+void QWebEngineProfile::removeHttpCacheEntry(const QUrl &url, const QWebEngineCallback<int> &resultCallback)
+{
+    Q_D(QWebEngineProfile);
+    quint64 requestId = d->browserContext()->removeHttpCacheEntry(url);
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Removes the entries of the profile's HTTP cache whose URL starts with \a urlPrefix,
+    for example \c{https://www.example.com/assets/}. The prefix is compared with the
+    encoded form of the URLs. \a resultCallback is called with the number of removed
+    entries.
+
+    \sa removeHttpCacheEntry(), clearHttpCache()
+*/
+void QWebEngineProfile::removeHttpCacheEntriesWithPrefix(const QString &urlPrefix, const QWebEngineCallback<int> &resultCallback)
+{
+    Q_D(QWebEngineProfile);
+    quint64 requestId = d->browserContext()->removeHttpCacheEntriesWithPrefix(urlPrefix);
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Returns the time in milliseconds after which hidden pages of this profile are
+    frozen automatically.
+
+    Will return \c 0 if pages are never frozen automatically.
+
+    \sa setLifecycleFreezeDelay(), QWebEnginePage::lifecycleState
+*/
+int QWebEngineProfile::lifecycleFreezeDelay() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->lifecycleFreezeDelay();
+}
+
+/*!
+    \since 5.12
+
+    Sets the time after which hidden pages of this profile are moved to the
+    \l{QWebEnginePage::LifecycleState}{Frozen} state to \a msecs milliseconds.
+    Pages that are playing audio or being inspected are not frozen.
+
+    Setting it to \c 0 disables automatic freezing, which is the default.
+
+    \sa lifecycleFreezeDelay(), setLifecycleMemoryBudget()
+*/
+void QWebEngineProfile::setLifecycleFreezeDelay(int msecs)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->setLifecycleFreezeDelay(msecs);
+}
+
+/*!
+    \since 5.12
+
+    Returns the renderer memory budget of this profile in bytes.
+
+    Will return \c 0 if pages are never discarded automatically.
+
+    \sa setLifecycleMemoryBudget(), QWebEnginePage::lifecycleState
+*/
+qint64 QWebEngineProfile::lifecycleMemoryBudget() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->lifecycleMemoryBudget();
+}
+
+/*!
+    \since 5.12
+
+    Sets the renderer memory budget of this profile to \a bytes.
+
+    While the render processes of the profile's pages use more memory than the budget, the
+    hidden page that has been hidden for the longest time is moved to the
+    \l{QWebEnginePage::LifecycleState}{Discarded} state. Discarded pages are restored
+    when they are shown again.
+
+    Setting it to \c 0 disables automatic discarding, which is the default.
+
+    \sa lifecycleMemoryBudget(), setLifecycleFreezeDelay()
+*/
+void QWebEngineProfile::setLifecycleMemoryBudget(qint64 bytes)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->setLifecycleMemoryBudget(bytes);
+}
+
+/*!
+    \since 5.12
+
+    Requests \a count render processes to be launched ahead of time for this profile.
+
+    The next navigations of the profile's pages that need a new render process adopt
+    a pre-launched one instead of paying for the process startup. At most one spare
+    render process is kept running at a time, the next one is launched when the
+    previous one has been adopted. The number of outstanding requests is limited by
+    maximumSpareRenderProcesses().
+
+    The spare render process is shared by all profiles. Profiles with outstanding
+    requests take turns, so warming up one profile does not shut down the spare of
+    another. A navigation of another profile that needs a new render process can
+    still shut down the spare, which is then launched again afterwards.
+
+    Spare render processes are not launched in single process mode or when the
+    render process limit is reached, and they are shut down under memory pressure.
+
+    \sa spareRenderProcessHitCount(), spareRenderProcessMissCount()
+*/
+void QWebEngineProfile::warmUpRenderProcesses(int count)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->warmUpRenderProcesses(count);
+}
+
+/*!
+    \since 5.12
+
+    Returns the maximum number of outstanding spare render process requests of this profile.
+    The default is \c 1.
+
+    \sa setMaximumSpareRenderProcesses(), warmUpRenderProcesses()
+*/
+int QWebEngineProfile::maximumSpareRenderProcesses() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->maximumSpareRenderProcesses();
+}
+
+/*!
+    \since 5.12
+
+    Limits the number of outstanding spare render process requests of this profile to \a count.
+    Setting it to \c 0 disables pre-launching and shuts down a running spare render process.
+
+    \sa maximumSpareRenderProcesses(), warmUpRenderProcesses()
+*/
+void QWebEngineProfile::setMaximumSpareRenderProcesses(int count)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->setMaximumSpareRenderProcesses(count);
+}
+
+/*!
+    \since 5.12
+
+    Returns how many times a navigation of this profile adopted a spare render process.
+
+    \sa spareRenderProcessMissCount(), warmUpRenderProcesses()
+*/
+int QWebEngineProfile::spareRenderProcessHitCount() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->spareRenderProcessHitCount();
+}
+
+/*!
+    \since 5.12
+
+    Returns how many times a navigation of this profile had to launch a new render
+    process while spare render processes were requested but none was ready.
+
+    \sa spareRenderProcessHitCount(), warmUpRenderProcesses()
+*/
+int QWebEngineProfile::spareRenderProcessMissCount() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->spareRenderProcessMissCount();
+}
+
+/*!
+    \since 5.12
+
+    Opens \a numSockets connections to the origin of \a url ahead of a request to it.
+
+    The connections are opened through the proxy of the profile, if any, and can only be
+    reused by requests that share their cookie settings, so origins blocked by the cookie
+    filter are connected in privacy mode. Connections that are not used are closed by the
+    network stack after a while. Nothing is reported when the connections are established.
+
+    \sa prefetchHostName(), prefetch()
+*/
+void QWebEngineProfile::preconnect(const QUrl &url, int numSockets)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->preconnect(url, numSockets);
+}
+
+/*!
+    \since 5.12
+
+    Resolves \a hostName into the host cache of the profile ahead of a request to it.
+
+    \a resultCallback is called with \c true when the host name was resolved and with
+    \c false when the resolution failed or was cancelled. Host names of requests going
+    through a proxy are resolved by the proxy, in that case nothing is resolved locally
+    and \c true is reported.
+
+    \sa preconnect(), prefetch()
+*/
+void QWebEngineProfile::prefetchHostName(const QString &hostName, const QWebEngineCallback<bool> &resultCallback)
+{
+    Q_D(QWebEngineProfile);
+    quint64 requestId = d->browserContext()->prefetchHostName(hostName);
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Loads \a url into the HTTP cache of the profile with the network priority \a priority.
+
+    The request uses the proxy, the cookies and the cookie filter of the profile and is
+    seen by its request interceptor, its response body is only stored in the cache.
+    \a resultCallback is called with \c true when the response was loaded successfully
+    and with \c false on network errors, HTTP error responses or when the request was
+    cancelled. Only HTTP and HTTPS URLs can be prefetched.
+
+    \note Responses are only kept when the cache of the profile is enabled and they can
+    be cached, see httpCacheType().
+
+    \sa preconnect(), prefetchHostName()
+*/
+void QWebEngineProfile::prefetch(const QUrl &url, PrefetchPriority priority, const QWebEngineCallback<bool> &resultCallback)
+{
+    Q_D(QWebEngineProfile);
+    quint64 requestId = d->browserContext()->prefetch(url, BrowserContextAdapter::PrefetchPriority(priority));
+    d->m_callbacks.registerCallback(requestId, resultCallback);
+}
+
+/*!
+    \since 5.12
+
+    Returns the storage access policy of this profile.
+
+    \sa setStorageAccessPolicy()
+*/
+QWebEngineProfile::StorageAccessPolicy QWebEngineProfile::storageAccessPolicy() const
+{
+    const Q_D(QWebEngineProfile);
+    return QWebEngineProfile::StorageAccessPolicy(d->browserContext()->storageAccessPolicy());
+}
+
+/*!
+    \since 5.12
+
+    Sets the storage access policy of this profile to \a policy.
+
+    The policy is combined with the cookie filter of the profile's cookieStore(). Render
+    processes answer storage access checks from a snapshot of both that is updated whenever
+    either changes, so that they do not have to wait for the browser process.
+
+    \sa storageAccessPolicy(), QWebEngineCookieStore::setCookieFilter()
+*/
+void QWebEngineProfile::setStorageAccessPolicy(QWebEngineProfile::StorageAccessPolicy policy)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->setStorageAccessPolicy(BrowserContextAdapter::StorageAccessPolicy(policy));
+}
+
+/*!
+    \since 5.12
+
+    Returns the minimum interval in milliseconds between two progress updates
+    of a download.
+
+    \sa setDownloadProgressInterval()
+*/
+int QWebEngineProfile::downloadProgressInterval() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->downloadProgressInterval();
+}
+
+/*!
+    \since 5.12
+
+    Sets the minimum interval between two progress updates of a download to
+    \a msecs milliseconds.
+
+    Progress updates of downloads in progress that arrive sooner are dropped.
+    Changes of the state, of the paused state, and the final update of a
+    download are always delivered. The default of \c 0 delivers every update.
+
+    Download updates are only delivered to the profile that accepted the
+    download.
+
+    \sa downloadProgressInterval(), QWebEngineDownloadItem::downloadProgress()
+*/
+void QWebEngineProfile::setDownloadProgressInterval(int msecs)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->setDownloadProgressInterval(msecs);
+}
+
+/*!
+    \since 5.12
+
+    Returns a snapshot of the network traffic of all pages and workers using this
+    profile since it was created or since resetNetworkMetrics() was last called.
+
+    The counters are updated on the network thread without locking, so taking a
+    snapshot is cheap and does not slow down loading.
+
+    \sa resetNetworkMetrics(), QWebEnginePage::networkMetrics()
+*/
+QWebEngineNetworkMetrics QWebEngineProfile::networkMetrics() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->networkMetrics();
+}
+
+/*!
+    \since 5.12
+
+    Sets all network traffic counters of this profile back to zero. The counters
+    of the pages using the profile are not affected.
+
+    \sa networkMetrics(), QWebEnginePage::resetNetworkMetrics()
+*/
+void QWebEngineProfile::resetNetworkMetrics()
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->resetNetworkMetrics();
+}
+
+/*!
+    \enum QWebEngineProfile::PermissionType
+    \since 5.12
+
+    This enum describes the permissions that can be decided for a profile:
+
+    \value GeolocationPermission Location hardware or service. Corresponds to
+           QWebEnginePage::Geolocation.
+    \value AudioCapturePermission Audio capture devices, such as microphones.
+           Corresponds to QWebEnginePage::MediaAudioCapture.
+    \value VideoCapturePermission Video devices, such as cameras. Corresponds to
+           QWebEnginePage::MediaVideoCapture.
+
+    QWebEnginePage::MediaAudioVideoCapture is granted when both the audio and the
+    video capture permissions are.
+*/
+
+/*!
+    \enum QWebEngineProfile::PermissionState
+    \since 5.12
+
+    This enum describes the decision for a permission:
+
+    \value AskPermission
+           No decision is stored, pages emit QWebEnginePage::featurePermissionRequested().
+    \value GrantedPermission
+           The permission is granted.
+    \value DeniedPermission
+           The permission is denied.
+*/
+
+/*!
+    \since 5.12
+
+    Sets the permission \a state of \a type on all origins matching
+    \a originPattern, and returns whether the pattern is valid.
+
+    \a originPattern is either an origin, like \c{https://www.example.com}, or a
+    pattern of the form \c{scheme://host:port} where any of the parts can be \c{*},
+    and the host can start with \c{*.} to match all of its subdomains, like
+    \c{https://*.example.com:*}. A pattern without a port only matches the default
+    port of the scheme.
+
+    Pages using the profile are granted or denied the permission without emitting
+    QWebEnginePage::featurePermissionRequested(). A decision for an origin takes
+    precedence over patterns matching it, and patterns apply in the order they were
+    first set. \l AskPermission removes the decision for \a originPattern.
+
+    Unless the profile is off-the-record, the decisions set with this function or
+    importPermissions() are saved in the persistentStoragePath(). The replies given
+    to QWebEnginePage::setFeaturePermission() only last until the profile is
+    destroyed, and a decision set here for the same origin replaces them.
+
+    \sa permission(), importPermissions()
+*/
+bool QWebEngineProfile::setPermission(const QString &originPattern, PermissionType type, PermissionState state)
+{
+    Q_D(QWebEngineProfile);
+    if (!d->browserContext()->setPermission(originPattern, BrowserContextAdapter::PermissionType(type),
+                                            BrowserContextAdapter::PermissionState(state))) {
+        qWarning("QWebEngineProfile::setPermission: invalid origin pattern %s", qPrintable(originPattern));
+        return false;
+    }
+    return true;
+}
+
+/*!
+    \since 5.12
+
+    Returns the permission state of \a type for \a origin, including the replies
+    given to QWebEnginePage::setFeaturePermission().
+
+    \sa setPermission()
+*/
+QWebEngineProfile::PermissionState QWebEngineProfile::permission(const QUrl &origin, PermissionType type) const
+{
+    const Q_D(QWebEngineProfile);
+    return PermissionState(d->browserContext()->permissionState(origin, BrowserContextAdapter::PermissionType(type)));
+}
+
+/*!
+    \since 5.12
+
+    Removes all permission decisions of the profile.
+
+    \sa setPermission()
+*/
+void QWebEngineProfile::clearPermissions()
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->clearPermissions();
+}
+
+/*!
+    \since 5.12
+
+    Returns all permission decisions of the profile as a JSON document that can be
+    passed to importPermissions().
+
+    \sa importPermissions()
+*/
+QByteArray QWebEngineProfile::exportPermissions() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->exportPermissions();
+}
+
+/*!
+    \since 5.12
+
+    Adds the permission decisions in \a data, as returned by exportPermissions(),
+    to the profile. Decisions for the same origins or patterns are replaced.
+
+    This can be used to pre-seed a profile with the permissions of many origins at
+    once. Returns \c false if \a data or some of its entries are invalid, in which
+    case the valid entries are still imported.
+
+    \sa exportPermissions(), setPermission()
+*/
+bool QWebEngineProfile::importPermissions(const QByteArray &data)
+{
+    Q_D(QWebEngineProfile);
+    return d->browserContext()->importPermissions(data);
+}
+
+/*!
+    \since 5.12
+
+    Allows certificate errors for \a host when the server presents a certificate
+    matching \a sha256, the SHA-256 hash of either the DER encoded certificate or,
+    if \a type is \c PublicKeyHash, the subject public key info of the server's
+    certificate. Keys of intermediate certificates are not matched, since a server
+    can present any intermediate certificate along with its own. The exception
+    expires at \a expirationTime, or never if it is not valid.
+
+    Connections to hosts with a matching exception are accepted while the certificate
+    is verified, without QWebEnginePage::certificateError() being called.
+
+    Unless the profile is off-the-record, exceptions are saved in the
+    persistentStoragePath(). Exceptions made by accepting a QWebEngineCertificateError
+    apply to that error and certificate chain only, and last for the session unless
+    rememberCertificateErrorDecisions() is enabled.
+
+    Returns \c false if \a host is empty or \a sha256 is not 32 bytes long.
+
+    \sa removeCertificateExceptions(), importCertificateExceptions()
+*/
+bool QWebEngineProfile::addCertificateException(const QString &host, CertificateHashType type,
+                                                const QByteArray &sha256, const QDateTime &expirationTime)
+{
+    Q_D(QWebEngineProfile);
+    return d->browserContext()->addCertificateException(host, type == PublicKeyHash, sha256, expirationTime);
+}
+
+/*!
+    \since 5.12
+
+    Removes all certificate error exceptions for \a host.
+
+    \sa addCertificateException()
+*/
+void QWebEngineProfile::removeCertificateExceptions(const QString &host)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->removeCertificateExceptions(host);
+}
+
+/*!
+    \since 5.12
+
+    Removes all certificate error exceptions of the profile.
+
+    \sa addCertificateException()
+*/
+void QWebEngineProfile::clearCertificateExceptions()
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->clearCertificateExceptions();
+}
+
+/*!
+    \since 5.12
+
+    Returns the certificate error exceptions of the profile that have not expired
+    as a JSON document that can be passed to importCertificateExceptions().
+
+    \sa importCertificateExceptions()
+*/
+QByteArray QWebEngineProfile::exportCertificateExceptions() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->exportCertificateExceptions();
+}
+
+/*!
+    \since 5.12
+
+    Adds the certificate error exceptions in \a data to the profile. Besides the
+    output of exportCertificateExceptions(), \a data can be written by hand to pin
+    many hosts at once:
+
+    \code
+    {
+        "version": 1,
+        "exceptions": [
+            { "host": "build.example.com", "type": "publicKey",
+              "hash": "sha256/47DEQpj8HBSa+/TImW+5JCeuQeRkm5NMpJWZG3hSuFU=" },
+            { "host": "test.example.com", "type": "certificate",
+              "hash": "sha256/...", "expires": "2019-01-01T00:00:00Z" }
+        ]
+    }
+    \endcode
+
+    Hashes are base64 encoded and prefixed with \c sha256/, like HTTP public key
+    pins. Returns \c false if \a data or some of its entries are invalid, in which
+    case the valid entries are still imported.
+
+    \sa exportCertificateExceptions(), addCertificateException()
+*/
+bool QWebEngineProfile::importCertificateExceptions(const QByteArray &data)
+{
+    Q_D(QWebEngineProfile);
+    return d->browserContext()->importCertificateExceptions(data);
+}
+
+/*!
+    \since 5.12
+
+    Returns whether exceptions made by accepting a QWebEngineCertificateError are
+    saved along with the other certificate exceptions of the profile.
+
+    \sa setRememberCertificateErrorDecisions()
+*/
+bool QWebEngineProfile::rememberCertificateErrorDecisions() const
+{
+    const Q_D(QWebEngineProfile);
+    return d->browserContext()->rememberCertificateErrorDecisions();
+}
+
+/*!
+    \since 5.12
+
+    Sets whether exceptions made by accepting a QWebEngineCertificateError are saved
+    in the persistentStoragePath() and exported by exportCertificateExceptions(), to
+    \a remember. Remembered decisions expire after a week. By default, decisions
+    only last for the session.
+
+    \sa rememberCertificateErrorDecisions(), addCertificateException()
+*/
+void QWebEngineProfile::setRememberCertificateErrorDecisions(bool remember)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->setRememberCertificateErrorDecisions(remember);
+}
+
+/*!
+    \since 5.12
+
+    Adds the credentials \a user and \a password for HTTP and proxy authentication
+    challenges from \a origin to the profile. The scheme, host, and port of \a origin
+    have to match the server or proxy that sends a challenge, like
+    \c{https://www.example.com} or \c{http://proxy.example.com:3128}. An empty \a realm
+    matches any realm and AnyHttpAuthScheme matches any \a scheme; when several
+    credentials match a challenge, the ones naming its realm are preferred. Credentials
+    for the same origin, realm and scheme replace each other.
+
+    Challenges with matching credentials are answered by the network stack without
+    emitting QWebEnginePage::authenticationRequired() or
+    QWebEnginePage::proxyAuthenticationRequired(). If the server rejects them, the
+    page is asked as usual.
+
+    If \a sendPreemptively is \c true, credentials for BasicHttpAuthScheme with a
+    non-empty \a realm are sent to \a origin without waiting for a challenge. Basic
+    credentials are not encrypted, so this should only be used for \c https origins
+    or trusted networks.
+
+    The credentials are kept in memory only. Returns \c false if \a origin is not
+    an HTTP or HTTPS origin.
+
+    \sa removeHttpAuthCredentials(), clearHttpAuthCredentials()
+*/
+bool QWebEngineProfile::addHttpAuthCredentials(const QUrl &origin, const QString &realm, HttpAuthScheme scheme,
+                                               const QString &user, const QString &password, bool sendPreemptively)
+{
+    Q_D(QWebEngineProfile);
+    return d->browserContext()->addHttpAuthCredentials(origin, realm, BrowserContextAdapter::HttpAuthScheme(scheme),
+                                                       user, password, sendPreemptively);
+}
+
+/*!
+    \since 5.12
+
+    Removes the HTTP authentication credentials added for \a origin. Credentials that
+    have already been accepted by the server may still be used by the network stack
+    for the rest of the session.
+
+    \sa addHttpAuthCredentials(), clearHttpAuthCredentials()
+*/
+void QWebEngineProfile::removeHttpAuthCredentials(const QUrl &origin)
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->removeHttpAuthCredentials(origin);
+}
+
+/*!
+    \since 5.12
+
+    Removes all HTTP authentication credentials added to the profile.
+
+    \sa addHttpAuthCredentials(), removeHttpAuthCredentials()
+*/
+void QWebEngineProfile::clearHttpAuthCredentials()
+{
+    Q_D(QWebEngineProfile);
+    d->browserContext()->clearHttpAuthCredentials();
+}
+
 QT_END_NAMESPACE
@@ -41,7 +41,11 @@
 #define QWEBENGINEPROFILE_H
 
 #include <QtWebEngineWidgets/qtwebenginewidgetsglobal.h>
+#include <QtWebEngineCore/qwebenginecallback.h>
+#include <QtWebEngineCore/qwebenginehttpcacheentry.h>
+#include <QtWebEngineCore/qwebenginenetworkmetrics.h>
 
+#include <QtCore/qdatetime.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qscopedpointer.h>
 #include <QtCore/qstring.h>
@@ -60,6 +64,9 @@ class QWebEngineScriptCollection;
 class QWebEngineUrlRequestInterceptor;
 class QWebEngineUrlSchemeHandler;
 
+Q_DECLARE_SHARED(QWebEngineCallback<const QVector<QWebEngineHttpCacheEntry> &>)
+Q_DECLARE_SHARED(QWebEngineCallback<const QWebEngineHttpCacheStatistics &>)
+
 class QWEBENGINEWIDGETS_EXPORT QWebEngineProfile : public QObject {
     Q_OBJECT
 public:
@@ -81,6 +88,50 @@ public:
     };
     Q_ENUM(PersistentCookiesPolicy)
 
+    enum StorageAccessPolicy {
+        AllowStorageAccess,
+        BlockThirdPartyStorageAccess,
+        BlockStorageAccess
+    };
+    Q_ENUM(StorageAccessPolicy)
+
+    enum CertificateHashType {
+        CertificateHash,
+        PublicKeyHash
+    };
+    Q_ENUM(CertificateHashType)
+
+    enum PrefetchPriority {
+        IdlePrefetchPriority,
+        LowPrefetchPriority,
+        MediumPrefetchPriority,
+        HighPrefetchPriority
+    };
+    Q_ENUM(PrefetchPriority)
+
+    enum HttpAuthScheme {
+        AnyHttpAuthScheme,
+        BasicHttpAuthScheme,
+        DigestHttpAuthScheme,
+        NtlmHttpAuthScheme,
+        NegotiateHttpAuthScheme
+    };
+    Q_ENUM(HttpAuthScheme)
+
+    enum PermissionType {
+        GeolocationPermission = 1,
+        AudioCapturePermission = 3,
+        VideoCapturePermission = 4
+    };
+    Q_ENUM(PermissionType)
+
+    enum PermissionState {
+        AskPermission,
+        GrantedPermission,
+        DeniedPermission
+    };
+    Q_ENUM(PermissionState)
+
     QString storageName() const;
     bool isOffTheRecord() const;
 
@@ -122,12 +173,65 @@ public:
     void removeAllUrlSchemeHandlers();
 
     void clearHttpCache();
+    void requestHttpCacheEntries(const QWebEngineCallback<const QVector<QWebEngineHttpCacheEntry> &> &resultCallback);
+    void requestHttpCacheStatistics(const QWebEngineCallback<const QWebEngineHttpCacheStatistics &> &resultCallback);
+    void insertHttpCacheEntry(const QUrl &url, const QByteArray &headers, const QByteArray &body,
+                              const QWebEngineCallback<bool> &resultCallback = QWebEngineCallback<bool>());
+    void removeHttpCacheEntry(const QUrl &url, const QWebEngineCallback<int> &resultCallback = QWebEngineCallback<int>());
+    void removeHttpCacheEntriesWithPrefix(const QString &urlPrefix,
+                                          const QWebEngineCallback<int> &resultCallback = QWebEngineCallback<int>());
 
     void setSpellCheckLanguages(const QStringList &languages);
     QStringList spellCheckLanguages() const;
     void setSpellCheckEnabled(bool enabled);
     bool isSpellCheckEnabled() const;
 
+    int lifecycleFreezeDelay() const;
+    void setLifecycleFreezeDelay(int msecs);
+    qint64 lifecycleMemoryBudget() const;
+    void setLifecycleMemoryBudget(qint64 bytes);
+
+    void warmUpRenderProcesses(int count = 1);
+    int maximumSpareRenderProcesses() const;
+    void setMaximumSpareRenderProcesses(int count);
+    int spareRenderProcessHitCount() const;
+    int spareRenderProcessMissCount() const;
+
+    void preconnect(const QUrl &url, int numSockets = 1);
+    void prefetchHostName(const QString &hostName,
+                          const QWebEngineCallback<bool> &resultCallback = QWebEngineCallback<bool>());
+    void prefetch(const QUrl &url, PrefetchPriority priority = IdlePrefetchPriority,
+                  const QWebEngineCallback<bool> &resultCallback = QWebEngineCallback<bool>());
+
+    StorageAccessPolicy storageAccessPolicy() const;
+    void setStorageAccessPolicy(QWebEngineProfile::StorageAccessPolicy policy);
+
+    int downloadProgressInterval() const;
+    void setDownloadProgressInterval(int msecs);
+
+    QWebEngineNetworkMetrics networkMetrics() const;
+    void resetNetworkMetrics();
+
+    bool setPermission(const QString &originPattern, PermissionType type, PermissionState state);
+    PermissionState permission(const QUrl &origin, PermissionType type) const;
+    void clearPermissions();
+    QByteArray exportPermissions() const;
+    bool importPermissions(const QByteArray &data);
+
+    bool addCertificateException(const QString &host, CertificateHashType type, const QByteArray &sha256,
+                                 const QDateTime &expirationTime = QDateTime());
+    void removeCertificateExceptions(const QString &host);
+    void clearCertificateExceptions();
+    QByteArray exportCertificateExceptions() const;
+    bool importCertificateExceptions(const QByteArray &data);
+    bool rememberCertificateErrorDecisions() const;
+    void setRememberCertificateErrorDecisions(bool remember);
+
+    bool addHttpAuthCredentials(const QUrl &origin, const QString &realm, HttpAuthScheme scheme,
+                                const QString &user, const QString &password, bool sendPreemptively = false);
+    void removeHttpAuthCredentials(const QUrl &origin);
+    void clearHttpAuthCredentials();
+
     static QWebEngineProfile *defaultProfile();
 
 Q_SIGNALS:
@@ -52,6 +52,7 @@
 //
 
 #include "browser_context_adapter_client.h"
+#include "qwebenginecallback_p.h"
 #include "qwebengineprofile.h"
 #include "qwebenginescriptcollection.h"
 
@@ -83,6 +84,14 @@ public:
 
     void downloadRequested(DownloadItemInfo &info) override;
     void downloadUpdated(const DownloadItemInfo &info) override;
+    void downloadDataReceived(quint32 downloadId, const QByteArray &data) override;
+    void networkPredictionFinished(quint64 requestId, bool success) override;
+    void httpCacheEntriesReceived(quint64 requestId, const QVector<QWebEngineHttpCacheEntry> &entries) override;
+    void httpCacheStatisticsReceived(quint64 requestId, const QWebEngineHttpCacheStatistics &statistics) override;
+    void httpCacheEntryInserted(quint64 requestId, bool success) override;
+    void httpCacheEntriesRemoved(quint64 requestId, int count) override;
+
+    QtWebEngineCore::CallbackDirectory m_callbacks;
 
 private:
     QWebEngineProfile *q_ptr;
@@ -185,7 +185,10 @@ static QStringList expectedAPI = QStringList()
     << "QQuickWebEngineDownloadItem.UserRequested --> DownloadType"
     << "QQuickWebEngineDownloadItem.accept() --> void"
     << "QQuickWebEngineDownloadItem.cancel() --> void"
+    << "QQuickWebEngineDownloadItem.dataReceived(QByteArray) --> void"
     << "QQuickWebEngineDownloadItem.id --> uint"
+    << "QQuickWebEngineDownloadItem.inMemory --> bool"
+    << "QQuickWebEngineDownloadItem.inMemoryChanged() --> void"
     << "QQuickWebEngineDownloadItem.interruptReason --> DownloadInterruptReason"
     << "QQuickWebEngineDownloadItem.interruptReasonChanged() --> void"
     << "QQuickWebEngineDownloadItem.interruptReasonString --> QString"
@@ -398,6 +401,7 @@ static QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.A9 --> PrintedPageSizeId"
     << "QQuickWebEngineView.AbnormalTerminationStatus --> RenderProcessTerminationStatus"
     << "QQuickWebEngineView.AcceptRequest --> NavigationRequestAction"
+    << "QQuickWebEngineView.Active --> LifecycleState"
     << "QQuickWebEngineView.AlignCenter --> WebAction"
     << "QQuickWebEngineView.AlignJustified --> WebAction"
     << "QQuickWebEngineView.AlignLeft --> WebAction"
@@ -441,6 +445,7 @@ static QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.DLE --> PrintedPageSizeId"
     << "QQuickWebEngineView.DesktopAudioVideoCapture --> Feature"
     << "QQuickWebEngineView.DesktopVideoCapture --> Feature"
+    << "QQuickWebEngineView.Discarded --> LifecycleState"
     << "QQuickWebEngineView.DnsErrorDomain --> ErrorDomain"
     << "QQuickWebEngineView.DoublePostcard --> PrintedPageSizeId"
     << "QQuickWebEngineView.DownloadImageToDisk --> WebAction"
@@ -495,6 +500,7 @@ static QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.Folio --> PrintedPageSizeId"
     << "QQuickWebEngineView.FormSubmittedNavigation --> NavigationType"
     << "QQuickWebEngineView.Forward --> WebAction"
+    << "QQuickWebEngineView.Frozen --> LifecycleState"
     << "QQuickWebEngineView.FtpErrorDomain --> ErrorDomain"
     << "QQuickWebEngineView.Geolocation --> Feature"
     << "QQuickWebEngineView.HttpErrorDomain --> ErrorDomain"
@@ -607,6 +613,8 @@ static QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.contentsSize --> QSizeF"
     << "QQuickWebEngineView.contentsSizeChanged(QSizeF) --> void"
     << "QQuickWebEngineView.contextMenuRequested(QQuickWebEngineContextMenuRequest*) --> void"
+    << "QQuickWebEngineView.delegatesReady --> bool"
+    << "QQuickWebEngineView.delegatesReadyChanged() --> void"
     << "QQuickWebEngineView.devToolsView --> QQuickWebEngineView*"
     << "QQuickWebEngineView.devToolsViewChanged() --> void"
     << "QQuickWebEngineView.featurePermissionRequested(QUrl,Feature) --> void"
@@ -630,6 +638,8 @@ static QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.isFullScreenChanged() --> void"
     << "QQuickWebEngineView.javaScriptConsoleMessage(JavaScriptConsoleMessageLevel,QString,int,QString) --> void"
     << "QQuickWebEngineView.javaScriptDialogRequested(QQuickWebEngineJavaScriptDialogRequest*) --> void"
+    << "QQuickWebEngineView.lifecycleState --> LifecycleState"
+    << "QQuickWebEngineView.lifecycleStateChanged(LifecycleState) --> void"
     << "QQuickWebEngineView.linkHovered(QUrl) --> void"
     << "QQuickWebEngineView.loadHtml(QString) --> void"
     << "QQuickWebEngineView.loadHtml(QString,QUrl) --> void"
@@ -671,6 +681,7 @@ static QStringList expectedAPI = QStringList()
     << "QQuickWebEngineView.title --> QString"
     << "QQuickWebEngineView.titleChanged() --> void"
     << "QQuickWebEngineView.triggerWebAction(WebAction) --> void"
+    << "QQuickWebEngineView.uploadProgress(qlonglong,qlonglong) --> void"
     << "QQuickWebEngineView.url --> QUrl"
     << "QQuickWebEngineView.urlChanged() --> void"
     << "QQuickWebEngineView.userScripts --> QQmlListProperty<QQuickWebEngineScript>"
@@ -88,6 +88,7 @@ private Q_SLOTS:
     void userScripts();
     void javascriptClipboard_data();
     void javascriptClipboard();
+    void delegatesReady();
 
 private:
     inline QQuickWebEngineView *newWebEngineView();
@@ -926,5 +927,28 @@ void tst_QQuickWebEngineView::javascriptClipboard()
                 (pasteResult ? QString("AnotherText") : QString("OriginalText")));
 }
 
+void tst_QQuickWebEngineView::delegatesReady()
+{
+    // The delegates are compiled in the background once the view is initialized.
+    QTRY_VERIFY_WITH_TIMEOUT(webEngineView()->delegatesReady(), 20000);
+
+    // A later view of the same engine reuses the compiled delegates.
+    QScopedPointer<QQuickWebEngineView> otherView(newWebEngineView());
+    QSignalSpy readySpy(otherView.data(), &QQuickWebEngineView::delegatesReadyChanged);
+    otherView->setParentItem(m_window->contentItem());
+    QTRY_COMPARE(readySpy.count(), 1);
+    QVERIFY(otherView->delegatesReady());
+
+    QQmlEngine *engine = qmlEngine(otherView.data());
+    QVERIFY(engine);
+    int caches = 0;
+    const QList<QObject *> children = engine->findChildren<QObject *>(QString(), Qt::FindDirectChildrenOnly);
+    for (QObject *child : children) {
+        if (qstrcmp(child->metaObject()->className(), "QtWebEngineCore::UIDelegatesComponentCache") == 0)
+            ++caches;
+    }
+    QCOMPARE(caches, 1);
+}
+
 QTEST_MAIN(tst_QQuickWebEngineView)
 #include "tst_qquickwebengineview.moc"
@@ -38,8 +38,10 @@ public Q_SLOTS:
 private Q_SLOTS:
     void noPage();
     void hierarchy();
+    void hitTestLargeContainer();
     void text();
     void value();
+    void coalescedEvents();
     void roles_data();
     void roles();
 };
@@ -142,6 +144,61 @@ void tst_QWebEngineAccessibility::hierarchy()
     QCOMPARE(input, child);
 }
 
+void tst_QWebEngineAccessibility::hitTestLargeContainer()
+{
+    QWebEngineView webView;
+    webView.resize(400, 400);
+    webView.setHtml("<html><body style='margin:0'>" \
+        "<div id='grid' role='group' aria-label='grid' style='position:relative;width:400px;height:400px'></div><script>" \
+        "var grid = document.getElementById('grid');" \
+        "for (var i = 0; i < 100; ++i) {" \
+        "    var button = document.createElement('button');" \
+        "    button.textContent = 'Button ' + i;" \
+        "    button.style.cssText = 'position:absolute;width:40px;height:40px;' +" \
+        "                           'left:' + (i % 10) * 40 + 'px;top:' + Math.floor(i / 10) * 40 + 'px';" \
+        "    grid.appendChild(button);" \
+        "}" \
+        "</script></body></html>");
+    webView.show();
+    QSignalSpy spyFinished(&webView, &QWebEngineView::loadFinished);
+    QVERIFY(spyFinished.wait());
+
+    QAccessibleInterface *view = QAccessible::queryAccessibleInterface(&webView);
+    QVERIFY(view);
+    auto findGrid = [view]() -> QAccessibleInterface * {
+        QVector<QAccessibleInterface *> nodes = { view };
+        while (!nodes.isEmpty()) {
+            QAccessibleInterface *node = nodes.takeLast();
+            if (node->role() == QAccessible::Grouping && node->text(QAccessible::Name) == QLatin1String("grid"))
+                return node;
+            for (int i = 0; i < node->childCount(); ++i)
+                nodes.append(node->child(i));
+        }
+        return nullptr;
+    };
+    QAccessibleInterface *grid = nullptr;
+    QTRY_VERIFY((grid = findGrid()) && grid->childCount() == 100);
+
+    for (int i : { 0, 9, 42, 99 }) {
+        QAccessibleInterface *button = grid->child(i);
+        QVERIFY(button);
+        QCOMPARE(button->text(QAccessible::Name), QStringLiteral("Button %1").arg(i));
+        const QPoint center = button->rect().center();
+        QCOMPARE(grid->childAt(center.x(), center.y()), button);
+    }
+
+    // Moved and renamed children are found under their new location and name.
+    QAccessibleInterface *button = grid->child(0);
+    evaluateJavaScriptSync(webView.page(), "var button = grid.firstElementChild;" \
+                                           "button.textContent = 'Moved';" \
+                                           "button.style.left = '200px';" \
+                                           "button.style.top = '360px';");
+    QTRY_COMPARE(button->text(QAccessible::Name), QStringLiteral("Moved"));
+    QTRY_COMPARE(button->rect().topLeft() - grid->child(1)->rect().topLeft(), QPoint(160, 360));
+    const QPoint center = button->rect().center();
+    QCOMPARE(grid->childAt(center.x(), center.y()), button);
+}
+
 void tst_QWebEngineAccessibility::text()
 {
     QWebEngineView webView;
@@ -250,6 +307,52 @@ void tst_QWebEngineAccessibility::value()
     QCOMPARE(progressBarValueInterface->maximumValue().toInt(), 99);
 }
 
+static int s_valueChangedEvents = 0;
+static int s_reorderEvents = 0;
+
+static void countAccessibilityEvents(QAccessibleEvent *event)
+{
+    if (event->type() == QAccessible::ValueChanged)
+        ++s_valueChangedEvents;
+    else if (event->type() == QAccessible::ObjectReorder)
+        ++s_reorderEvents;
+}
+
+void tst_QWebEngineAccessibility::coalescedEvents()
+{
+    QWebEngineView webView;
+    QCOMPARE(webView.page()->accessibilityEventRateLimit(), 0);
+    webView.page()->setAccessibilityEventRateLimit(30);
+    QCOMPARE(webView.page()->accessibilityEventRateLimit(), 30);
+
+    webView.setHtml("<html><body>" \
+        "<div id='slider' role='slider' aria-valuenow='0' aria-valuemin='0' aria-valuemax='100'></div>" \
+        "<ul id='list'></ul>" \
+        "</body></html>");
+    webView.show();
+    QSignalSpy spyFinished(&webView, &QWebEngineView::loadFinished);
+    QVERIFY(spyFinished.wait());
+
+    QAccessibleInterface *view = QAccessible::queryAccessibleInterface(&webView);
+    QTRY_VERIFY(view->child(0) && view->child(0)->childCount() > 0);
+
+    s_valueChangedEvents = 0;
+    s_reorderEvents = 0;
+    QAccessible::UpdateHandler previousHandler = QAccessible::installUpdateHandler(countAccessibilityEvents);
+    // Many changes within one frame are delivered as one event per element.
+    webView.page()->runJavaScript("var slider = document.getElementById('slider');" \
+                                  "var list = document.getElementById('list');" \
+                                  "for (var i = 1; i <= 50; ++i) {" \
+                                  "    slider.setAttribute('aria-valuenow', i);" \
+                                  "    list.appendChild(document.createElement('li'));" \
+                                  "}");
+    QTRY_VERIFY(s_valueChangedEvents > 0);
+    QTest::qWait(200);
+    QAccessible::installUpdateHandler(previousHandler);
+    QVERIFY(s_valueChangedEvents < 5);
+    QVERIFY(s_reorderEvents < 5);
+}
+
 void tst_QWebEngineAccessibility::roles_data()
 {
     QTest::addColumn<QString>("html");
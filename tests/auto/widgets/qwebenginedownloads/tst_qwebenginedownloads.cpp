@@ -26,6 +26,7 @@
 **
 ****************************************************************************/
 
+#include <QBuffer>
 #include <QCoreApplication>
 #include <QSignalSpy>
 #include <QStandardPaths>
@@ -67,6 +68,7 @@ private Q_SLOTS:
     void downloadViaSetUrl();
     void downloadFileNot1();
     void downloadFileNot2();
+    void downloadToDevice();
 
 private:
     void saveLink(QPoint linkPos);
@@ -790,5 +792,55 @@ void tst_QWebEngineDownloads::downloadFileNot2()
     QCOMPARE(downloadItem->state(), QWebEngineDownloadItem::DownloadCancelled);
 }
 
+void tst_QWebEngineDownloads::downloadToDevice()
+{
+    // Trigger file download via download() and receive the data in a buffer.
+
+    const QByteArray fileContents = QByteArray(100000, 'x');
+    int fileRequests = 0;
+    ScopedConnection sc1 = connect(m_server, &HttpServer::newRequest, [&](HttpReqRep *rr) {
+        if (rr->requestMethod() == "GET" && rr->requestPath() == "/file") {
+            ++fileRequests;
+            rr->setResponseHeader(QByteArrayLiteral("content-type"), QByteArrayLiteral("application/octet-stream"));
+            rr->setResponseBody(fileContents);
+            rr->sendResponse();
+        } else {
+            rr->setResponseStatus(404);
+            rr->sendResponse();
+        }
+    });
+
+    QBuffer buffer;
+    QVERIFY(buffer.open(QIODevice::WriteOnly));
+    QByteArray chunks;
+    QPointer<QWebEngineDownloadItem> downloadItem;
+    ScopedConnection sc2 = connect(m_profile, &QWebEngineProfile::downloadRequested, [&](QWebEngineDownloadItem *item) {
+        QVERIFY(!item->isInMemory());
+        item->setDevice(&buffer);
+        QVERIFY(item->isInMemory());
+        QCOMPARE(item->device(), &buffer);
+        connect(item, &QWebEngineDownloadItem::dataReceived, [&](const QByteArray &data) {
+            chunks.append(data);
+        });
+        item->accept();
+        downloadItem = item;
+    });
+
+    m_page->download(m_server->url(QByteArrayLiteral("/file")));
+    QTRY_VERIFY(downloadItem);
+    QTRY_VERIFY(downloadItem->isFinished());
+    QCOMPARE(downloadItem->state(), QWebEngineDownloadItem::DownloadCompleted);
+    QCOMPARE(downloadItem->receivedBytes(), qint64(fileContents.size()));
+    QCOMPARE(buffer.data(), fileContents);
+    QCOMPARE(chunks, fileContents);
+    // The data comes from the download itself, the resource is not fetched again.
+    QCOMPARE(fileRequests, 1);
+
+    // The destination cannot be changed once the download has been accepted.
+    QTest::ignoreMessage(QtWarningMsg, "Changing the download destination is not allowed after the download has been accepted.");
+    downloadItem->setInMemory(false);
+    QVERIFY(downloadItem->isInMemory());
+}
+
 QTEST_MAIN(tst_QWebEngineDownloads)
 #include "tst_qwebenginedownloads.moc"
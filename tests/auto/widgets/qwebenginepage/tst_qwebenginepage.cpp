@@ -47,6 +47,7 @@
 #include <qwebenginedownloaditem.h>
 #include <qwebenginefullscreenrequest.h>
 #include <qwebenginehistory.h>
+#include <qwebenginenetworkmetrics.h>
 #include <qwebenginepage.h>
 #include <qwebengineprofile.h>
 #include <qwebenginequotarequest.h>
@@ -99,6 +100,7 @@ private Q_SLOTS:
     void loadFinished();
     void actionStates();
     void pasteImage();
+    void pasteAfterClipboardChange();
     void popupFormSubmission();
     void userStyleSheet();
     void userStyleSheetFromLocalFileUrl();
@@ -160,6 +162,8 @@ private Q_SLOTS:
 
     void runJavaScript();
     void runJavaScriptDisabled();
+    void runJavaScriptResultFormats();
+    void runJavaScriptInFrames();
     void fullScreenRequested();
     void quotaRequested();
 
@@ -186,6 +190,8 @@ private Q_SLOTS:
     void evaluateWillCauseRepaint();
     void setContent_data();
     void setContent();
+    void setContentLarge();
+    void setContentFromMemory();
     void setCacheLoadControlAttribute();
     void setUrlWithPendingLoads();
     void setUrlToEmpty();
@@ -220,6 +226,12 @@ private Q_SLOTS:
     void devTools();
     void openLinkInDifferentProfile();
     void dynamicFrame();
+    void lifecycleState();
+    void streamContent();
+    void consoleMessageFilter();
+    void grabToImage();
+    void networkMetrics();
+    void qrcRangeAndConditionalRequests();
 
 private:
     static QPoint elementCenter(QWebEnginePage *page, const QString &id);
@@ -492,6 +504,30 @@ void tst_QWebEnginePage::pasteImage()
     QCOMPARE(image, origImage);
 }
 
+void tst_QWebEnginePage::pasteAfterClipboardChange()
+{
+    // Conversions of the clipboard contents are reused only until it changes.
+    QClipboard *clipboard = QGuiApplication::clipboard();
+    clipboard->setText(QStringLiteral("first"));
+    QWebEnginePage *page = m_view->page();
+    m_view->setHtml("<html><body><textarea id='input'></textarea></body></html>");
+    QSignalSpy spyFinished(m_view, &QWebEngineView::loadFinished);
+    QVERIFY(spyFinished.wait());
+    evaluateJavaScriptSync(page, "document.getElementById('input').focus()");
+
+    page->triggerAction(QWebEnginePage::Paste);
+    QTRY_COMPARE(evaluateJavaScriptSync(page, "document.getElementById('input').value").toString(),
+                 QStringLiteral("first"));
+    page->triggerAction(QWebEnginePage::Paste);
+    QTRY_COMPARE(evaluateJavaScriptSync(page, "document.getElementById('input').value").toString(),
+                 QStringLiteral("firstfirst"));
+
+    clipboard->setText(QStringLiteral("second"));
+    page->triggerAction(QWebEnginePage::Paste);
+    QTRY_COMPARE(evaluateJavaScriptSync(page, "document.getElementById('input').value").toString(),
+                 QStringLiteral("firstfirstsecond"));
+}
+
 class ConsolePage : public QWebEnginePage
 {
 public:
@@ -2731,6 +2767,85 @@ void tst_QWebEnginePage::runJavaScriptDisabled()
              QVariant(2));
 }
 
+void tst_QWebEnginePage::runJavaScriptResultFormats()
+{
+    QWebEnginePage page;
+    const QString script = QStringLiteral("({ rows: [[1, 'a'], [2.5, null]], ok: true })");
+
+    CallbackSpy<QVariant> jsonSpy;
+    page.runJavaScript(script, QWebEngineScript::MainWorld, QWebEnginePage::JsonResult, jsonSpy.ref());
+    const QVariant json = jsonSpy.waitForResult();
+    QCOMPARE(json.type(), QVariant::ByteArray);
+    const QJsonObject object = QJsonDocument::fromJson(json.toByteArray()).object();
+    QCOMPARE(object.value(QStringLiteral("ok")).toBool(), true);
+    QCOMPARE(object.value(QStringLiteral("rows")).toArray().at(1).toArray().at(0).toDouble(), 2.5);
+
+    CallbackSpy<QVariant> valueSpy;
+    page.runJavaScript(script, QWebEngineScript::MainWorld, QWebEnginePage::JsonValueResult, valueSpy.ref());
+    const QJsonValue value = valueSpy.waitForResult().value<QJsonValue>();
+    QVERIFY(value.isObject());
+    QCOMPARE(value.toObject().value(QStringLiteral("rows")).toArray().at(0).toArray().at(1).toString(), QStringLiteral("a"));
+
+    CallbackSpy<QVariant> cborSpy;
+    page.runJavaScript(QStringLiteral("[1, -2, 'a', true, null]"), QWebEngineScript::MainWorld,
+                       QWebEnginePage::CborResult, cborSpy.ref());
+    QCOMPARE(cborSpy.waitForResult().toByteArray(), QByteArray::fromHex("8501216161f5f6"));
+
+    CallbackSpy<QVariant> binarySpy;
+    page.runJavaScript(QStringLiteral("new Uint8Array([1, 2, 255]).buffer"), QWebEngineScript::MainWorld,
+                       QWebEnginePage::CborResult, binarySpy.ref());
+    QCOMPARE(binarySpy.waitForResult().toByteArray(), QByteArray::fromHex("430102ff"));
+
+    CallbackSpy<QVariant> variantSpy;
+    page.runJavaScript(QStringLiteral("new Uint8Array([1, 2, 255]).buffer"), QWebEngineScript::MainWorld,
+                       QWebEnginePage::VariantResult, variantSpy.ref());
+    QCOMPARE(variantSpy.waitForResult(), QVariant(QByteArray::fromHex("0102ff")));
+}
+
+void tst_QWebEnginePage::runJavaScriptInFrames()
+{
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+    page.setHtml(QStringLiteral("<html><body>"
+                                "<iframe name='first' srcdoc='<p>first</p>'></iframe>"
+                                "<iframe name='second' srcdoc='<p>second</p>'></iframe>"
+                                "</body></html>"));
+    QTRY_COMPARE(loadSpy.count(), 1);
+
+    CallbackSpy<QVariant> allSpy;
+    page.runJavaScriptInFrames(QStringLiteral("document.body.textContent"), QWebEngineScript::MainWorld,
+                               QString(), 10000, allSpy.ref());
+    const QVariantList results = allSpy.waitForResult().toList();
+    QCOMPARE(results.size(), 3);
+    QStringList texts;
+    for (const QVariant &result : results) {
+        const QVariantMap frame = result.toMap();
+        QCOMPARE(frame.value(QStringLiteral("timedOut")).toBool(), false);
+        texts.append(frame.value(QStringLiteral("result")).toString());
+    }
+    QVERIFY(texts.contains(QStringLiteral("first")));
+    QVERIFY(texts.contains(QStringLiteral("second")));
+
+    CallbackSpy<QVariant> filteredSpy;
+    page.runJavaScriptInFrames(QStringLiteral("1"), QWebEngineScript::MainWorld,
+                               QStringLiteral("https://*.example.com"), 10000, filteredSpy.ref());
+    QCOMPARE(filteredSpy.waitForResult().toList().size(), 0);
+    QVERIFY(filteredSpy.wasCalled());
+
+    QTest::ignoreMessage(QtWarningMsg, "Invalid origin pattern, the script is not run in any frame: example.com");
+    CallbackSpy<QVariant> invalidSpy;
+    page.runJavaScriptInFrames(QStringLiteral("1"), QWebEngineScript::MainWorld,
+                               QStringLiteral("example.com"), 0, invalidSpy.ref());
+    QCOMPARE(invalidSpy.waitForResult().toList().size(), 0);
+
+    // Frames removed before replying must not keep the callback waiting, even without a deadline.
+    CallbackSpy<QVariant> removedSpy;
+    page.runJavaScriptInFrames(QStringLiteral("if (window !== window.top) window.frameElement.remove(); 1"),
+                               QWebEngineScript::MainWorld, QString(), 0, removedSpy.ref());
+    QCOMPARE(removedSpy.waitForResult().toList().size(), 3);
+    QVERIFY(removedSpy.wasCalled());
+}
+
 void tst_QWebEnginePage::fullScreenRequested()
 {
     JavaScriptCallbackWatcher watcher;
@@ -3379,6 +3494,65 @@ void tst_QWebEnginePage::setContent()
     QCOMPARE(toPlainTextSync(m_view->page()), expected);
 }
 
+void tst_QWebEnginePage::setContentLarge()
+{
+    // Content larger than the maximum length of a data: URL is served from memory.
+    const QByteArray text(4 * 1024 * 1024, 'a');
+    const QByteArray html = "<html><body><div id='text'>" + text + "</div></body></html>";
+    const QUrl baseUrl("http://qt.io/report/");
+
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    page.setContent(html, "text/html;charset=UTF-8", baseUrl);
+    QTRY_COMPARE_WITH_TIMEOUT(loadSpy.count(), 1, 20000);
+    QVERIFY(loadSpy.takeFirst().value(0).toBool());
+    QCOMPARE(page.url(), baseUrl);
+
+    QCOMPARE(evaluateJavaScriptSync(&page, "document.getElementById('text').textContent.length").toInt(), text.size());
+    QCOMPARE(evaluateJavaScriptSync(&page, "new URL('image.png', document.baseURI).href").toString(),
+             QStringLiteral("http://qt.io/report/image.png"));
+}
+
+void tst_QWebEnginePage::setContentFromMemory()
+{
+    HttpServer server;
+    int networkRequests = 0;
+    QByteArray leakedHeader;
+    connect(&server, &HttpServer::newRequest, [&](HttpReqRep *rr) {
+        ++networkRequests;
+        leakedHeader += rr->requestHeader(QByteArrayLiteral("x-qtwebengine-content-resource"));
+        rr->setResponseBody(QByteArrayLiteral("network"));
+        rr->sendResponse();
+    });
+    QVERIFY(server.start());
+
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    page.setHtml(QStringLiteral("<html><body>first</body></html>"), server.url());
+    QTRY_COMPARE(loadSpy.count(), 1);
+    QVERIFY(loadSpy.takeFirst().value(0).toBool());
+    page.setHtml(QStringLiteral("<html><body>second</body></html>"), server.url());
+    QTRY_COMPARE(loadSpy.count(), 1);
+    QVERIFY(loadSpy.takeFirst().value(0).toBool());
+    QCOMPARE(toPlainTextSync(&page), QStringLiteral("second"));
+    QCOMPARE(networkRequests, 0);
+
+    // Scripts cannot get at the content by marking their own requests.
+    page.runJavaScript(QStringLiteral("fetch('/', { headers: { 'X-QtWebEngine-Content-Resource': '1' } })"
+                                      ".then(function(r) { return r.text(); })"
+                                      ".then(function(text) { document.title = text; })"));
+    QTRY_COMPARE(page.title(), QStringLiteral("network"));
+    QCOMPARE(networkRequests, 1);
+    QVERIFY(leakedHeader.isEmpty());
+
+    // Content of earlier calls stays available to the history.
+    page.triggerAction(QWebEnginePage::Back);
+    QTRY_COMPARE(loadSpy.count(), 1);
+    QVERIFY(loadSpy.takeFirst().value(0).toBool());
+    QCOMPARE(toPlainTextSync(&page), QStringLiteral("first"));
+    QCOMPARE(networkRequests, 1);
+}
+
 class CacheNetworkAccessManager : public QNetworkAccessManager {
 public:
     CacheNetworkAccessManager(QObject* parent = 0)
@@ -4428,6 +4602,259 @@ void tst_QWebEnginePage::dynamicFrame()
     QCOMPARE(toPlainTextSync(&page).trimmed(), QStringLiteral("foo"));
 }
 
+void tst_QWebEnginePage::lifecycleState()
+{
+    QWebEngineView view;
+    QWebEnginePage *page = view.page();
+    QSignalSpy loadSpy(page, &QWebEnginePage::loadFinished);
+    QSignalSpy stateSpy(page, &QWebEnginePage::lifecycleStateChanged);
+
+    page->setHtml("<html><head><title>Lifecycle</title></head><body>hello</body></html>");
+    QTRY_COMPARE(loadSpy.count(), 1);
+    QCOMPARE(page->lifecycleState(), QWebEnginePage::LifecycleState::Active);
+
+    view.resize(320, 240);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    // Visible pages stay active.
+    QTest::ignoreMessage(QtWarningMsg, "Cannot freeze or discard a visible page.");
+    page->setLifecycleState(QWebEnginePage::LifecycleState::Frozen);
+    QCOMPARE(page->lifecycleState(), QWebEnginePage::LifecycleState::Active);
+    QCOMPARE(stateSpy.count(), 0);
+
+    view.hide();
+    page->setLifecycleState(QWebEnginePage::LifecycleState::Frozen);
+    QCOMPARE(page->lifecycleState(), QWebEnginePage::LifecycleState::Frozen);
+    QCOMPARE(stateSpy.count(), 1);
+    QVERIFY(page->discardedSnapshot().isNull());
+
+    page->setLifecycleState(QWebEnginePage::LifecycleState::Discarded);
+    QCOMPARE(page->lifecycleState(), QWebEnginePage::LifecycleState::Discarded);
+    QCOMPARE(stateSpy.count(), 2);
+    QVERIFY(!page->discardedSnapshot().isNull());
+    QCOMPARE(page->title(), QStringLiteral("Lifecycle"));
+    QCOMPARE(page->history()->count(), 1);
+
+    // Showing the page again restores it.
+    view.show();
+    QCOMPARE(page->lifecycleState(), QWebEnginePage::LifecycleState::Active);
+    QCOMPARE(stateSpy.count(), 3);
+    QVERIFY(page->discardedSnapshot().isNull());
+    QTRY_COMPARE(loadSpy.count(), 2);
+    QCOMPARE(toPlainTextSync(page), QStringLiteral("hello"));
+
+    // Running scripts wakes up a hidden page.
+    view.hide();
+    page->setLifecycleState(QWebEnginePage::LifecycleState::Frozen);
+    QCOMPARE(evaluateJavaScriptSync(page, "document.title").toString(), QStringLiteral("Lifecycle"));
+    QCOMPARE(page->lifecycleState(), QWebEnginePage::LifecycleState::Active);
+}
+
+void tst_QWebEnginePage::streamContent()
+{
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+    const QString text = QString(200 * 1024, QLatin1Char('a')) + QStringLiteral("\u00e9");
+    page.setHtml(QStringLiteral("<html><body><p>") + text
+                 + QStringLiteral("</p><iframe srcdoc='<p>subframe</p>'></iframe></body></html>"));
+    QTRY_COMPARE(loadSpy.count(), 1);
+    QTRY_COMPARE(evaluateJavaScriptSync(&page, "window.frames[0].document.readyState").toString(), QStringLiteral("complete"));
+
+    QByteArrayList chunks;
+    bool finished = false;
+    auto collect = [&chunks, &finished] (const QByteArray &chunk) {
+        if (chunk.isEmpty())
+            finished = true;
+        else
+            chunks.append(chunk);
+    };
+
+    page.streamHtml(collect);
+    QTRY_VERIFY(finished);
+    QVERIFY(chunks.count() > 1);
+    for (const QByteArray &chunk : qAsConst(chunks))
+        QCOMPARE(QString::fromUtf8(chunk).toUtf8(), chunk);
+    QCOMPARE(QString::fromUtf8(chunks.join()), toHtmlSync(&page));
+
+    chunks.clear();
+    finished = false;
+    page.streamHtml(collect, -1, QStringList() << QStringLiteral("*"));
+    QTRY_VERIFY(finished);
+    QVERIFY(chunks.join().endsWith("<p>subframe</p></body></html>"));
+
+    chunks.clear();
+    finished = false;
+    page.streamPlainText(collect, 16);
+    QTRY_VERIFY(finished);
+    QCOMPARE(chunks.join(), QByteArray(16, 'a'));
+}
+
+void tst_QWebEnginePage::consoleMessageFilter()
+{
+    ConsolePage page;
+    QSignalSpy droppedSpy(&page, &QWebEnginePage::javaScriptConsoleMessagesDropped);
+    auto droppedCount = [&droppedSpy] () {
+        int count = 0;
+        for (const QList<QVariant> &arguments : qAsConst(droppedSpy))
+            count += arguments.at(0).toInt();
+        return count;
+    };
+    QCOMPARE(page.javaScriptConsoleMessageMinimumLevel(), QWebEnginePage::InfoMessageLevel);
+    QCOMPARE(page.javaScriptConsoleMessageRateLimit(), 0);
+
+    page.setJavaScriptConsoleMessageFilter(QWebEnginePage::WarningMessageLevel);
+    QCOMPARE(page.javaScriptConsoleMessageMinimumLevel(), QWebEnginePage::WarningMessageLevel);
+    evaluateJavaScriptSync(&page, "console.log('log'); console.warn('warn'); console.error('error');");
+    QTRY_COMPARE(page.messages, QStringList() << QStringLiteral("warn") << QStringLiteral("error"));
+    // The filter must keep the original source location.
+    QCOMPARE(page.lineNumbers.at(0), 1);
+    QTRY_COMPARE(droppedCount(), 1);
+    // The page must not be able to tell that its messages are filtered.
+    QCOMPARE(evaluateJavaScriptSync(&page, "console.log.name").toString(), QStringLiteral("log"));
+    QVERIFY(evaluateJavaScriptSync(&page, "console.log.toString().indexOf('[native code]') >= 0").toBool());
+
+    // Every kind of console call is filtered.
+    page.messages.clear();
+    droppedSpy.clear();
+    evaluateJavaScriptSync(&page, "console.count('counted'); console.assert(false, 'asserted'); console.assert(true, 'passed');");
+    QTRY_COMPARE(page.messages.count(), 1);
+    QVERIFY(page.messages.at(0).contains(QStringLiteral("asserted")));
+    QTRY_COMPARE(droppedCount(), 1);
+
+    page.messages.clear();
+    droppedSpy.clear();
+    page.setJavaScriptConsoleMessageFilter(QWebEnginePage::InfoMessageLevel, 10);
+    QCOMPARE(page.javaScriptConsoleMessageRateLimit(), 10);
+    evaluateJavaScriptSync(&page, "for (var i = 0; i < 100; ++i) console.log(i);");
+    QTRY_COMPARE(page.messages.count() + droppedCount(), 100);
+    QVERIFY(page.messages.count() <= 10);
+
+    page.messages.clear();
+    page.setJavaScriptConsoleMessageFilter(QWebEnginePage::InfoMessageLevel);
+    evaluateJavaScriptSync(&page, "console.log('unfiltered');");
+    QTRY_COMPARE(page.messages, QStringList() << QStringLiteral("unfiltered"));
+}
+
+void tst_QWebEnginePage::grabToImage()
+{
+    // The page is never shown.
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, SIGNAL(loadFinished(bool)));
+    page.setHtml("<html><body style='margin: 0'>"
+                 "<div style='width: 100px; height: 100px; background-color: #ff0000'></div>"
+                 "<div style='width: 100px; height: 100px; background-color: #0000ff'></div>"
+                 "</body></html>");
+    QTRY_COMPARE(loadSpy.count(), 1);
+
+    QImage image;
+    bool called = false;
+    page.grabToImage(QRect(0, 100, 100, 100), 0.5, [&](const QImage &result) {
+        image = result;
+        called = true;
+    });
+    QTRY_VERIFY(called);
+    QVERIFY(!image.isNull());
+    QCOMPARE(image.size(), QSize(50, 50));
+    QCOMPARE(image.pixelColor(25, 25), QColor(Qt::blue));
+
+    called = false;
+    page.grabToImage(QRect(), 1.0, [&](const QImage &result) {
+        image = result;
+        called = true;
+    });
+    QTRY_VERIFY(called);
+    QVERIFY(!image.isNull());
+    QCOMPARE(image.pixelColor(50, 50), QColor(Qt::red));
+
+    called = false;
+    page.grabToImage(QRect(), 0, [&](const QImage &result) {
+        image = result;
+        called = true;
+    });
+    QVERIFY(called);
+    QVERIFY(image.isNull());
+}
+
+void tst_QWebEnginePage::networkMetrics()
+{
+    HttpServer server;
+    connect(&server, &HttpServer::newRequest, [&](HttpReqRep *rr) {
+        if (rr->requestMethod() == "GET" && rr->requestPath() == "/") {
+            rr->setResponseBody(QByteArrayLiteral("<html><body><img src=\"/image.png\"></body></html>"));
+            rr->sendResponse();
+        } else {
+            rr->setResponseStatus(404);
+            rr->sendResponse();
+        }
+    });
+    QVERIFY(server.start());
+
+    QWebEngineProfile profile;
+    QWebEnginePage page(&profile);
+    QWebEnginePage otherPage(&profile);
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+
+    page.setUrl(server.url("/"));
+    QTRY_COMPARE(loadSpy.count(), 1);
+    QTRY_COMPARE(page.networkMetrics().requestCount(QWebEngineUrlRequestInfo::ResourceTypeImage), qint64(1));
+
+    QWebEngineNetworkMetrics metrics = page.networkMetrics();
+    QCOMPARE(metrics.requestCount(QWebEngineUrlRequestInfo::ResourceTypeMainFrame), qint64(1));
+    QVERIFY(metrics.requestCount() >= 2);
+    QVERIFY(metrics.bytesReceived() > 0);
+    QVERIFY(metrics.bytesSent() > 0);
+    QCOMPARE(metrics.failedRequestCount(), qint64(0));
+    QVERIFY(metrics.averageTimeToFirstByte() >= 0);
+
+    QWebEngineNetworkMetrics profileMetrics = profile.networkMetrics();
+    QVERIFY(profileMetrics.requestCount() >= metrics.requestCount());
+    QVERIFY(profileMetrics.bytesReceived() >= metrics.bytesReceived());
+    QCOMPARE(otherPage.networkMetrics().requestCount(), qint64(0));
+
+    page.resetNetworkMetrics();
+    QCOMPARE(page.networkMetrics().requestCount(), qint64(0));
+    QCOMPARE(page.networkMetrics().bytesReceived(), qint64(0));
+    QVERIFY(profile.networkMetrics().requestCount() >= metrics.requestCount());
+
+    profile.resetNetworkMetrics();
+    QCOMPARE(profile.networkMetrics().requestCount(), qint64(0));
+    QVERIFY(server.stop());
+}
+
+void tst_QWebEnginePage::qrcRangeAndConditionalRequests()
+{
+    QWebEnginePage page;
+    QSignalSpy loadSpy(&page, &QWebEnginePage::loadFinished);
+    page.load(QUrl("qrc:///resources/content.html"));
+    QTRY_COMPARE(loadSpy.count(), 1);
+    QVERIFY(loadSpy.takeFirst().value(0).toBool());
+
+    const QString fetch = QStringLiteral(
+            "(function() {"
+            "    var xhr = new XMLHttpRequest();"
+            "    xhr.open('GET', 'qrc:///resources/content.html', false);"
+            "    %1"
+            "    xhr.send();"
+            "    return [xhr.status, xhr.responseText, xhr.getResponseHeader('ETag') || ''];"
+            "})()");
+
+    QVariantList full = evaluateJavaScriptSync(&page, fetch.arg(QString())).toList();
+    QCOMPARE(full.size(), 3);
+    QCOMPARE(full.at(0).toInt(), 200);
+    QVERIFY(full.at(1).toString().contains(QStringLiteral("This is test content")));
+    const QString etag = full.at(2).toString();
+    QVERIFY(!etag.isEmpty());
+
+    QVariantList partial = evaluateJavaScriptSync(&page, fetch.arg(QStringLiteral("xhr.setRequestHeader('Range', 'bytes=0-5');"))).toList();
+    QCOMPARE(partial.at(0).toInt(), 206);
+    QCOMPARE(partial.at(1).toString(), QStringLiteral("<html>"));
+
+    QVariantList unchanged = evaluateJavaScriptSync(&page, fetch.arg(
+            QStringLiteral("xhr.setRequestHeader('If-None-Match', '%1');").arg(etag))).toList();
+    QCOMPARE(unchanged.at(0).toInt(), 304);
+}
+
 static QByteArrayList params = {QByteArrayLiteral("--use-fake-device-for-media-stream")};
 W_QTEST_MAIN(tst_QWebEnginePage, params)
 
@@ -28,7 +28,11 @@
 
 #include "../util.h"
 #include <QtCore/qbuffer.h>
+#include <QtNetwork/qauthenticator.h>
+#include <QtNetwork/qtcpserver.h>
+#include <QtNetwork/qtcpsocket.h>
 #include <QtTest/QtTest>
+#include <QtWebEngineCore/qwebenginecookiestore.h>
 #include <QtWebEngineCore/qwebengineurlrequestjob.h>
 #include <QtWebEngineCore/qwebengineurlschemehandler.h>
 #include <QtWebEngineWidgets/qwebengineprofile.h>
@@ -48,6 +52,7 @@ private Q_SLOTS:
     void testProfile();
     void clearDataFromCache();
     void disableCache();
+    void httpCacheEntries();
     void urlSchemeHandlers();
     void urlSchemeHandlerFailRequest();
     void urlSchemeHandlerFailOnRead();
@@ -56,6 +61,14 @@ private Q_SLOTS:
     void httpAcceptLanguage();
     void downloadItem();
     void changePersistentPath();
+    void lifecycleFreezeDelay();
+    void spareRenderProcesses();
+    void networkPrediction();
+    void storageAccessPolicy();
+    void permissions();
+    void persistentPermissions();
+    void certificateExceptions();
+    void httpAuthCredentials();
 };
 
 void tst_QWebEngineProfile::init()
@@ -311,6 +324,58 @@ static bool loadSync(QWebEngineView *view, const QUrl &url, int timeout = 5000)
     return false;
 }
 
+void tst_QWebEngineProfile::httpCacheEntries()
+{
+    QWebEngineProfile profile;
+    QCOMPARE(profile.httpCacheType(), QWebEngineProfile::MemoryHttpCache);
+
+    const QByteArray headers("Content-Type: text/html\r\nCache-Control: max-age=3600\r\n");
+    const QByteArray body("<html><body>Cached</body></html>");
+    const QUrl firstUrl(QStringLiteral("http://cache.test/assets/first.html"));
+    const QUrl secondUrl(QStringLiteral("http://cache.test/assets/second.html"));
+    const QUrl otherUrl(QStringLiteral("http://cache.test/index.html"));
+    for (const QUrl &url : { firstUrl, secondUrl, otherUrl }) {
+        CallbackSpy<bool> insertSpy;
+        profile.insertHttpCacheEntry(url, headers, body, insertSpy.ref());
+        QVERIFY(insertSpy.waitForResult());
+    }
+
+    CallbackSpy<bool> schemeSpy;
+    profile.insertHttpCacheEntry(QUrl(QStringLiteral("qrc:/index.html")), headers, body, schemeSpy.ref());
+    QVERIFY(!schemeSpy.waitForResult());
+    QVERIFY(schemeSpy.wasCalled());
+
+    CallbackSpy<QVector<QWebEngineHttpCacheEntry>> entriesSpy;
+    profile.requestHttpCacheEntries(entriesSpy.ref());
+    QVector<QWebEngineHttpCacheEntry> entries = entriesSpy.waitForResult();
+    QCOMPARE(entries.size(), 3);
+    for (const QWebEngineHttpCacheEntry &entry : qAsConst(entries)) {
+        QVERIFY(entry.url() == firstUrl || entry.url() == secondUrl || entry.url() == otherUrl);
+        QVERIFY(entry.size() > body.size());
+        QVERIFY(entry.lastUsed().isValid());
+    }
+
+    CallbackSpy<QWebEngineHttpCacheStatistics> statisticsSpy;
+    profile.requestHttpCacheStatistics(statisticsSpy.ref());
+    QWebEngineHttpCacheStatistics statistics = statisticsSpy.waitForResult();
+    QVERIFY(statistics.isValid());
+    QCOMPARE(statistics.entryCount(), qint64(3));
+    QVERIFY(statistics.totalSize() >= 3 * body.size());
+
+    CallbackSpy<int> prefixSpy;
+    profile.removeHttpCacheEntriesWithPrefix(QStringLiteral("http://cache.test/assets/"), prefixSpy.ref());
+    QCOMPARE(prefixSpy.waitForResult(), 2);
+
+    CallbackSpy<int> removeSpy;
+    profile.removeHttpCacheEntry(otherUrl, removeSpy.ref());
+    QCOMPARE(removeSpy.waitForResult(), 1);
+
+    CallbackSpy<QVector<QWebEngineHttpCacheEntry>> emptySpy;
+    profile.requestHttpCacheEntries(emptySpy.ref());
+    QVERIFY(emptySpy.waitForResult().isEmpty());
+    QVERIFY(emptySpy.wasCalled());
+}
+
 void tst_QWebEngineProfile::urlSchemeHandlers()
 {
     RedirectingUrlSchemeHandler lettertoHandler;
@@ -534,5 +599,349 @@ void tst_QWebEngineProfile::changePersistentPath()
     QVERIFY(newPath.endsWith(QStringLiteral("Test2")));
 }
 
+void tst_QWebEngineProfile::lifecycleFreezeDelay()
+{
+    QWebEngineProfile profile;
+    QCOMPARE(profile.lifecycleFreezeDelay(), 0);
+    QCOMPARE(profile.lifecycleMemoryBudget(), qint64(0));
+
+    QWebEnginePage page(&profile);
+    QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+    page.setHtml(QStringLiteral("<html><body>Hello world!</body></html>"));
+    QTRY_COMPARE(loadFinishedSpy.count(), 1);
+    QCOMPARE(page.lifecycleState(), QWebEnginePage::LifecycleState::Active);
+
+    // Pages without a view are hidden and get frozen after the delay.
+    profile.setLifecycleFreezeDelay(100);
+    QCOMPARE(profile.lifecycleFreezeDelay(), 100);
+    QTRY_COMPARE(page.lifecycleState(), QWebEnginePage::LifecycleState::Frozen);
+
+    // A budget no renderer can fit in discards the page.
+    profile.setLifecycleMemoryBudget(1);
+    QCOMPARE(profile.lifecycleMemoryBudget(), qint64(1));
+    QTRY_COMPARE(page.lifecycleState(), QWebEnginePage::LifecycleState::Discarded);
+
+    profile.setLifecycleFreezeDelay(-1);
+    QCOMPARE(profile.lifecycleFreezeDelay(), 0);
+}
+
+void tst_QWebEngineProfile::spareRenderProcesses()
+{
+    QWebEngineProfile profile;
+    QCOMPARE(profile.maximumSpareRenderProcesses(), 1);
+    QCOMPARE(profile.spareRenderProcessHitCount(), 0);
+    QCOMPARE(profile.spareRenderProcessMissCount(), 0);
+
+    // The first page of the profile adopts the pre-launched process.
+    profile.warmUpRenderProcesses();
+    QWebEnginePage page(&profile);
+    QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+    page.setHtml(QStringLiteral("<html><body>Hello world!</body></html>"));
+    QTRY_COMPARE(loadFinishedSpy.count(), 1);
+    QCOMPARE(profile.spareRenderProcessHitCount(), 1);
+    QCOMPARE(profile.spareRenderProcessMissCount(), 0);
+
+    // A maximum of zero disables pre-launching, nothing is launched or counted.
+    profile.setMaximumSpareRenderProcesses(-1);
+    QCOMPARE(profile.maximumSpareRenderProcesses(), 0);
+    profile.warmUpRenderProcesses(2);
+    QWebEnginePage otherPage(&profile);
+    QSignalSpy otherLoadFinishedSpy(&otherPage, SIGNAL(loadFinished(bool)));
+    otherPage.setHtml(QStringLiteral("<html><body>Hello world!</body></html>"));
+    QTRY_COMPARE(otherLoadFinishedSpy.count(), 1);
+    QCOMPARE(profile.spareRenderProcessHitCount(), 1);
+    QCOMPARE(profile.spareRenderProcessMissCount(), 0);
+
+    // Warming up a second profile does not take the spare of the first one away.
+    QWebEngineProfile first;
+    QWebEngineProfile second;
+    first.warmUpRenderProcesses();
+    second.warmUpRenderProcesses();
+    QWebEnginePage firstPage(&first);
+    QSignalSpy firstLoadFinishedSpy(&firstPage, SIGNAL(loadFinished(bool)));
+    firstPage.setHtml(QStringLiteral("<html><body>Hello world!</body></html>"));
+    QTRY_COMPARE(firstLoadFinishedSpy.count(), 1);
+    QCOMPARE(first.spareRenderProcessHitCount(), 1);
+    QCOMPARE(first.spareRenderProcessMissCount(), 0);
+
+    // The second profile gets its spare once the first one has been adopted.
+    QTest::qWait(100);
+    QWebEnginePage secondPage(&second);
+    QSignalSpy secondLoadFinishedSpy(&secondPage, SIGNAL(loadFinished(bool)));
+    secondPage.setHtml(QStringLiteral("<html><body>Hello world!</body></html>"));
+    QTRY_COMPARE(secondLoadFinishedSpy.count(), 1);
+    QCOMPARE(second.spareRenderProcessHitCount(), 1);
+    QCOMPARE(second.spareRenderProcessMissCount(), 0);
+}
+
+void tst_QWebEngineProfile::networkPrediction()
+{
+    QWebEngineProfile profile;
+    profile.preconnect(QUrl(QStringLiteral("http://127.0.0.1:1/")), 2);
+
+    CallbackSpy<bool> hostNameSpy;
+    profile.prefetchHostName(QStringLiteral("localhost"), hostNameSpy.ref());
+    QVERIFY(hostNameSpy.waitForResult());
+
+    // Only HTTP and HTTPS resources go to the HTTP cache.
+    CallbackSpy<bool> schemeSpy;
+    profile.prefetch(QUrl(QStringLiteral("qrc:/resources/index.html")), QWebEngineProfile::HighPrefetchPriority, schemeSpy.ref());
+    QVERIFY(!schemeSpy.waitForResult());
+    QVERIFY(schemeSpy.wasCalled());
+
+    CallbackSpy<bool> refusedSpy;
+    profile.prefetch(QUrl(QStringLiteral("http://127.0.0.1:1/")), QWebEngineProfile::IdlePrefetchPriority, refusedSpy.ref());
+    QVERIFY(!refusedSpy.waitForResult());
+    QVERIFY(refusedSpy.wasCalled());
+}
+
+void tst_QWebEngineProfile::storageAccessPolicy()
+{
+    QWebEngineProfile profile;
+    QCOMPARE(profile.storageAccessPolicy(), QWebEngineProfile::AllowStorageAccess);
+
+    QWebEnginePage page(&profile);
+    QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+    auto canAccessStorage = [&] () {
+        // Storage access is decided once per document.
+        loadFinishedSpy.clear();
+        page.setHtml(QStringLiteral("<html><body>Hello world!</body></html>"), QUrl(QStringLiteral("http://qt.io/")));
+        if (!loadFinishedSpy.wait())
+            return QVariant();
+        return evaluateJavaScriptSync(&page, QStringLiteral("(function() { try { return localStorage.length >= 0; } catch (e) { return false; } })()"));
+    };
+    QCOMPARE(canAccessStorage(), QVariant(true));
+
+    profile.setStorageAccessPolicy(QWebEngineProfile::BlockStorageAccess);
+    QCOMPARE(profile.storageAccessPolicy(), QWebEngineProfile::BlockStorageAccess);
+    QCOMPARE(canAccessStorage(), QVariant(false));
+
+    // The first party frame is not affected by blocking third party storage.
+    profile.setStorageAccessPolicy(QWebEngineProfile::BlockThirdPartyStorageAccess);
+    QCOMPARE(canAccessStorage(), QVariant(true));
+
+    // Changing the cookie filter invalidates the renderer's snapshot.
+    profile.setStorageAccessPolicy(QWebEngineProfile::AllowStorageAccess);
+    profile.cookieStore()->setCookieFilter([] (const QWebEngineCookieStore::FilterRequest &) { return false; });
+    QCOMPARE(canAccessStorage(), QVariant(false));
+    profile.cookieStore()->setCookieFilter(nullptr);
+    QCOMPARE(canAccessStorage(), QVariant(true));
+}
+
+void tst_QWebEngineProfile::permissions()
+{
+    QWebEngineProfile profile;
+    const QUrl origin(QStringLiteral("https://www.qt.io/some/path"));
+    QCOMPARE(profile.permission(origin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::AskPermission);
+
+    QVERIFY(profile.setPermission(QStringLiteral("https://*.qt.io"), QWebEngineProfile::GeolocationPermission, QWebEngineProfile::GrantedPermission));
+    QCOMPARE(profile.permission(origin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::GrantedPermission);
+    QCOMPARE(profile.permission(QUrl(QStringLiteral("https://qt.io")), QWebEngineProfile::GeolocationPermission), QWebEngineProfile::GrantedPermission);
+    QCOMPARE(profile.permission(QUrl(QStringLiteral("http://www.qt.io")), QWebEngineProfile::GeolocationPermission), QWebEngineProfile::AskPermission);
+    QCOMPARE(profile.permission(QUrl(QStringLiteral("https://www.qt.io:8443")), QWebEngineProfile::GeolocationPermission), QWebEngineProfile::AskPermission);
+    QCOMPARE(profile.permission(QUrl(QStringLiteral("https://notqt.io")), QWebEngineProfile::GeolocationPermission), QWebEngineProfile::AskPermission);
+
+    // A decision for the origin overrides the pattern.
+    QVERIFY(profile.setPermission(QStringLiteral("https://www.qt.io"), QWebEngineProfile::GeolocationPermission, QWebEngineProfile::DeniedPermission));
+    QCOMPARE(profile.permission(origin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::DeniedPermission);
+
+    QVERIFY(profile.setPermission(QStringLiteral("*://intranet:*"), QWebEngineProfile::AudioCapturePermission, QWebEngineProfile::GrantedPermission));
+    QCOMPARE(profile.permission(QUrl(QStringLiteral("http://intranet:8080")), QWebEngineProfile::AudioCapturePermission), QWebEngineProfile::GrantedPermission);
+    QCOMPARE(profile.permission(QUrl(QStringLiteral("http://intranet:8080")), QWebEngineProfile::VideoCapturePermission), QWebEngineProfile::AskPermission);
+
+    QVERIFY(!profile.setPermission(QStringLiteral("https://www.*.io"), QWebEngineProfile::GeolocationPermission, QWebEngineProfile::GrantedPermission));
+
+    const QByteArray exported = profile.exportPermissions();
+    QWebEngineProfile otherProfile;
+    QVERIFY(otherProfile.importPermissions(exported));
+    QCOMPARE(otherProfile.permission(origin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::DeniedPermission);
+    QCOMPARE(otherProfile.permission(QUrl(QStringLiteral("https://doc.qt.io")), QWebEngineProfile::GeolocationPermission), QWebEngineProfile::GrantedPermission);
+    QCOMPARE(otherProfile.permission(QUrl(QStringLiteral("http://intranet:8080")), QWebEngineProfile::AudioCapturePermission), QWebEngineProfile::GrantedPermission);
+    QVERIFY(!otherProfile.importPermissions(QByteArrayLiteral("not json")));
+
+    QVERIFY(profile.setPermission(QStringLiteral("https://www.qt.io"), QWebEngineProfile::GeolocationPermission, QWebEngineProfile::AskPermission));
+    QCOMPARE(profile.permission(origin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::GrantedPermission);
+
+    // Replies of pages apply to the profile, but are neither exported nor saved.
+    const QUrl pageOrigin(QStringLiteral("https://example.com"));
+    QWebEnginePage page(&profile);
+    page.setFeaturePermission(pageOrigin, QWebEnginePage::Geolocation, QWebEnginePage::PermissionGrantedByUser);
+    QCOMPARE(profile.permission(pageOrigin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::GrantedPermission);
+    QVERIFY(!profile.exportPermissions().contains("example.com"));
+    QVERIFY(profile.setPermission(pageOrigin.toString(), QWebEngineProfile::GeolocationPermission, QWebEngineProfile::DeniedPermission));
+    QCOMPARE(profile.permission(pageOrigin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::DeniedPermission);
+    QVERIFY(profile.exportPermissions().contains("example.com"));
+
+    profile.clearPermissions();
+    QCOMPARE(profile.permission(origin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::AskPermission);
+    QCOMPARE(profile.permission(QUrl(QStringLiteral("http://intranet:8080")), QWebEngineProfile::AudioCapturePermission), QWebEngineProfile::AskPermission);
+}
+
+void tst_QWebEngineProfile::persistentPermissions()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QUrl origin(QStringLiteral("https://www.qt.io"));
+    const QUrl pageOrigin(QStringLiteral("https://example.com"));
+    {
+        QWebEngineProfile profile(QStringLiteral("Permissions"));
+        profile.setPersistentStoragePath(tempDir.path());
+        QVERIFY(profile.setPermission(origin.toString(), QWebEngineProfile::GeolocationPermission, QWebEngineProfile::GrantedPermission));
+        QWebEnginePage page(&profile);
+        page.setFeaturePermission(pageOrigin, QWebEnginePage::Geolocation, QWebEnginePage::PermissionGrantedByUser);
+    }
+    QTRY_VERIFY(QFile::exists(tempDir.filePath(QStringLiteral("Permissions"))));
+
+    QWebEngineProfile profile(QStringLiteral("Permissions"));
+    profile.setPersistentStoragePath(tempDir.path());
+    QCOMPARE(profile.permission(origin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::GrantedPermission);
+    QCOMPARE(profile.permission(pageOrigin, QWebEngineProfile::GeolocationPermission), QWebEngineProfile::AskPermission);
+}
+
+void tst_QWebEngineProfile::certificateExceptions()
+{
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    const QByteArray hash = QCryptographicHash::hash("public key", QCryptographicHash::Sha256);
+    {
+        QWebEngineProfile profile(QStringLiteral("CertificateExceptions"));
+        profile.setPersistentStoragePath(tempDir.path());
+        QVERIFY(!profile.addCertificateException(QString(), QWebEngineProfile::PublicKeyHash, hash));
+        QVERIFY(!profile.addCertificateException(QStringLiteral("example.com"), QWebEngineProfile::PublicKeyHash, "short"));
+        QVERIFY(profile.addCertificateException(QStringLiteral("Example.com"), QWebEngineProfile::PublicKeyHash, hash));
+        QVERIFY(profile.addCertificateException(QStringLiteral("expired.example.com"), QWebEngineProfile::CertificateHash, hash,
+                                                QDateTime::currentDateTimeUtc().addDays(-1)));
+    }
+    QTRY_VERIFY(QFile::exists(tempDir.filePath(QStringLiteral("CertificateExceptions"))));
+
+    QWebEngineProfile profile(QStringLiteral("CertificateExceptions"));
+    profile.setPersistentStoragePath(tempDir.path());
+    const QJsonObject exported = QJsonDocument::fromJson(profile.exportCertificateExceptions()).object();
+    const QJsonArray exceptions = exported.value(QStringLiteral("exceptions")).toArray();
+    QCOMPARE(exceptions.size(), 1);
+    QCOMPARE(exceptions.at(0).toObject().value(QStringLiteral("host")).toString(), QStringLiteral("example.com"));
+    QCOMPARE(exceptions.at(0).toObject().value(QStringLiteral("type")).toString(), QStringLiteral("publicKey"));
+    QCOMPARE(exceptions.at(0).toObject().value(QStringLiteral("hash")).toString(),
+             QStringLiteral("sha256/") + QString::fromLatin1(hash.toBase64()));
+
+    profile.clearCertificateExceptions();
+    QCOMPARE(QJsonDocument::fromJson(profile.exportCertificateExceptions()).object()
+             .value(QStringLiteral("exceptions")).toArray().size(), 0);
+
+    const QByteArray seed = "{\"version\": 1, \"exceptions\": ["
+                            "{\"host\": \"a.example.com\", \"type\": \"certificate\", \"hash\": \"sha256/"
+                            + hash.toBase64() + "\"},"
+                            "{\"host\": \"b.example.com\", \"type\": \"unknown\", \"hash\": \"sha256/"
+                            + hash.toBase64() + "\"}]}";
+    QVERIFY(!profile.importCertificateExceptions(seed));
+    QCOMPARE(QJsonDocument::fromJson(profile.exportCertificateExceptions()).object()
+             .value(QStringLiteral("exceptions")).toArray().size(), 1);
+    profile.removeCertificateExceptions(QStringLiteral("a.example.com"));
+    QCOMPARE(QJsonDocument::fromJson(profile.exportCertificateExceptions()).object()
+             .value(QStringLiteral("exceptions")).toArray().size(), 0);
+
+    // Accepted certificate errors only last for the session by default.
+    QVERIFY(!profile.rememberCertificateErrorDecisions());
+    profile.setRememberCertificateErrorDecisions(true);
+    QVERIFY(profile.rememberCertificateErrorDecisions());
+}
+
+void tst_QWebEngineProfile::httpAuthCredentials()
+{
+    const QByteArray expectedAuthorization = "Basic " + QByteArrayLiteral("user:secret").toBase64();
+    int challenges = 0;
+    QTcpServer server;
+    connect(&server, &QTcpServer::newConnection, this, [&]() {
+        QTcpSocket *socket = server.nextPendingConnection();
+        QByteArray *rawData = new QByteArray;
+        connect(socket, &QObject::destroyed, [rawData]() { delete rawData; });
+        connect(socket, &QIODevice::readyRead, socket, [&, socket, rawData]() {
+            *rawData += socket->readAll();
+            const int headerEnd = rawData->indexOf("\r\n\r\n");
+            if (headerEnd < 0)
+                return;
+            bool authorized = false;
+            for (const QByteArray &line : rawData->left(headerEnd).split('\n')) {
+                if (line.toLower().startsWith("authorization:"))
+                    authorized = line.mid(14).trimmed() == expectedAuthorization;
+            }
+            rawData->remove(0, headerEnd + 4);
+            if (authorized) {
+                socket->write("HTTP/1.1 200 OK\r\n"
+                              "Content-Type: text/html\r\n"
+                              "Content-Length: 28\r\n\r\n"
+                              "<html><body>ok</body></html>");
+            } else {
+                ++challenges;
+                socket->write("HTTP/1.1 401 Unauthorized\r\n"
+                              "WWW-Authenticate: Basic realm=\"tests\"\r\n"
+                              "Content-Type: text/html\r\n"
+                              "Content-Length: 0\r\n\r\n");
+            }
+            socket->flush();
+        });
+    });
+    QVERIFY(server.listen(QHostAddress::LocalHost));
+    const QUrl url("http://127.0.0.1:" + QString::number(server.serverPort()));
+
+    QWebEngineProfile profile;
+    QVERIFY(!profile.addHttpAuthCredentials(QUrl(), QString(), QWebEngineProfile::AnyHttpAuthScheme,
+                                            QStringLiteral("user"), QStringLiteral("secret")));
+    QVERIFY(!profile.addHttpAuthCredentials(QUrl(QStringLiteral("file:///tmp")), QString(), QWebEngineProfile::AnyHttpAuthScheme,
+                                            QStringLiteral("user"), QStringLiteral("secret")));
+    // Digest credentials do not match the Basic challenge, credentials for other ports of
+    // the host do not match the origin at all, and the better matching ones win.
+    QUrl otherPortUrl(url);
+    otherPortUrl.setPort(url.port() + 1);
+    QVERIFY(profile.addHttpAuthCredentials(otherPortUrl, QStringLiteral("tests"), QWebEngineProfile::AnyHttpAuthScheme,
+                                           QStringLiteral("user"), QStringLiteral("wrong")));
+    QVERIFY(profile.addHttpAuthCredentials(url, QString(), QWebEngineProfile::DigestHttpAuthScheme,
+                                           QStringLiteral("user"), QStringLiteral("wrong")));
+    QVERIFY(profile.addHttpAuthCredentials(url, QString(), QWebEngineProfile::AnyHttpAuthScheme,
+                                           QStringLiteral("user"), QStringLiteral("wrong")));
+    QVERIFY(profile.addHttpAuthCredentials(url, QStringLiteral("tests"), QWebEngineProfile::AnyHttpAuthScheme,
+                                           QStringLiteral("user"), QStringLiteral("secret")));
+
+    QWebEnginePage page(&profile);
+    int authenticationRequests = 0;
+    connect(&page, &QWebEnginePage::authenticationRequired, [&authenticationRequests](const QUrl &, QAuthenticator *) {
+        ++authenticationRequests;
+    });
+    QSignalSpy loadFinishedSpy(&page, SIGNAL(loadFinished(bool)));
+    page.load(url);
+    QTRY_COMPARE_WITH_TIMEOUT(loadFinishedSpy.count(), 1, 20000);
+    QVERIFY(loadFinishedSpy.takeFirst().first().toBool());
+    QCOMPARE(toPlainTextSync(&page), QStringLiteral("ok"));
+    QCOMPARE(challenges, 1);
+    QCOMPARE(authenticationRequests, 0);
+
+    // Credentials rejected by the server fall back to asking the page.
+    QWebEngineProfile otherProfile;
+    otherProfile.addHttpAuthCredentials(url, QString(), QWebEngineProfile::AnyHttpAuthScheme,
+                                        QStringLiteral("user"), QStringLiteral("wrong"));
+    QWebEnginePage otherPage(&otherProfile);
+    connect(&otherPage, &QWebEnginePage::authenticationRequired, [&authenticationRequests](const QUrl &, QAuthenticator *) {
+        ++authenticationRequests;
+    });
+    QSignalSpy otherLoadFinishedSpy(&otherPage, SIGNAL(loadFinished(bool)));
+    challenges = 0;
+    otherPage.load(url);
+    QTRY_COMPARE_WITH_TIMEOUT(otherLoadFinishedSpy.count(), 1, 20000);
+    QCOMPARE(challenges, 2);
+    QCOMPARE(authenticationRequests, 1);
+
+    // Basic credentials are only sent before a challenge when asked for.
+    QWebEngineProfile preemptiveProfile;
+    QVERIFY(preemptiveProfile.addHttpAuthCredentials(url, QStringLiteral("tests"), QWebEngineProfile::BasicHttpAuthScheme,
+                                                     QStringLiteral("user"), QStringLiteral("secret"), true));
+    QWebEnginePage preemptivePage(&preemptiveProfile);
+    QSignalSpy preemptiveLoadFinishedSpy(&preemptivePage, SIGNAL(loadFinished(bool)));
+    challenges = 0;
+    preemptivePage.load(url);
+    QTRY_COMPARE_WITH_TIMEOUT(preemptiveLoadFinishedSpy.count(), 1, 20000);
+    QVERIFY(preemptiveLoadFinishedSpy.takeFirst().first().toBool());
+    QCOMPARE(challenges, 0);
+}
+
 QTEST_MAIN(tst_QWebEngineProfile)
 #include "tst_qwebengineprofile.moc"
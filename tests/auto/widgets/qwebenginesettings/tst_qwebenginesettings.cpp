@@ -38,6 +38,7 @@ private Q_SLOTS:
     void javascriptClipboard_data();
     void javascriptClipboard();
     void setInAcceptNavigationRequest();
+    void inheritedSettingsUpdate();
 };
 
 void tst_QWebEngineSettings::resetAttributes()
@@ -197,6 +198,39 @@ void tst_QWebEngineSettings::setInAcceptNavigationRequest()
     QCOMPARE(toPlainTextSync(&page), QStringLiteral("PASS"));
 }
 
+static QString defaultFontSizeSync(QWebEnginePage *page)
+{
+    return evaluateJavaScriptSync(page, "getComputedStyle(document.body).fontSize").toString();
+}
+
+void tst_QWebEngineSettings::inheritedSettingsUpdate()
+{
+    QWebEngineProfile profile;
+    QWebEnginePage firstPage(&profile);
+    QWebEnginePage secondPage(&profile);
+    QWebEnginePage overridingPage(&profile);
+    overridingPage.settings()->setFontSize(QWebEngineSettings::DefaultFontSize, 20);
+    for (QWebEnginePage *page : { &firstPage, &secondPage, &overridingPage }) {
+        QSignalSpy loadFinishedSpy(page, SIGNAL(loadFinished(bool)));
+        page->setHtml("<html><body>Text</body></html>");
+        QVERIFY(loadFinishedSpy.wait());
+    }
+    QCOMPARE(defaultFontSizeSync(&firstPage), QStringLiteral("16px"));
+    QCOMPARE(defaultFontSizeSync(&overridingPage), QStringLiteral("20px"));
+
+    // Pages sharing the profile's values pick up its changes, the page with its own value keeps it.
+    profile.settings()->setFontSize(QWebEngineSettings::DefaultFontSize, 24);
+    QTRY_COMPARE(defaultFontSizeSync(&firstPage), QStringLiteral("24px"));
+    QTRY_COMPARE(defaultFontSizeSync(&secondPage), QStringLiteral("24px"));
+    QCOMPARE(defaultFontSizeSync(&overridingPage), QStringLiteral("20px"));
+
+    // Going back to values applied before must not be skipped.
+    profile.settings()->resetFontSize(QWebEngineSettings::DefaultFontSize);
+    QTRY_COMPARE(defaultFontSizeSync(&firstPage), QStringLiteral("16px"));
+    overridingPage.settings()->resetFontSize(QWebEngineSettings::DefaultFontSize);
+    QTRY_COMPARE(defaultFontSizeSync(&overridingPage), QStringLiteral("16px"));
+}
+
 QTEST_MAIN(tst_QWebEngineSettings)
 
 #include "tst_qwebenginesettings.moc"
@@ -33,6 +33,7 @@
 #include <qdiriterator.h>
 #include <qstackedlayout.h>
 #include <qtemporarydir.h>
+#include <QBuffer>
 #include <QClipboard>
 #include <QCompleter>
 #include <QLabel>
@@ -45,6 +46,7 @@
 #include <QTcpServer>
 #include <QTcpSocket>
 #include <QStyle>
+#include <QTimer>
 #include <QtWidgets/qaction.h>
 
 #define VERIFY_INPUTMETHOD_HINTS(actual, expect) \
@@ -162,6 +164,9 @@ private Q_SLOTS:
     void keyboardFocusAfterPopup();
     void mouseClick();
     void postData();
+    void postDataStreamed_data();
+    void postDataStreamed();
+    void postDataUploadProgress();
     void inputFieldOverridesShortcuts();
 
     void softwareInputPanel();
@@ -177,6 +182,7 @@ private Q_SLOTS:
     void imeJSInputEvents();
 
     void mouseLeave();
+    void mouseMoveCoalescing();
 
 #ifndef QT_NO_CLIPBOARD
     void globalMouseSelection();
@@ -1510,6 +1516,142 @@ void tst_QWebEngineView::postData()
     server.close();
 }
 
+void tst_QWebEngineView::postDataStreamed_data()
+{
+    QTest::addColumn<QString>("source");
+    QTest::newRow("file") << QStringLiteral("file");
+    QTest::newRow("file device") << QStringLiteral("file device");
+    QTest::newRow("buffer device") << QStringLiteral("buffer device");
+}
+
+void tst_QWebEngineView::postDataStreamed()
+{
+    QFETCH(QString, source);
+
+    // Larger than a single upload chunk, and with a recognizable pattern.
+    QByteArray body;
+    for (int i = 0; body.size() < 1024 * 1024; ++i)
+        body += QByteArray::number(i) + ',';
+
+    QTemporaryDir tempDir;
+    QVERIFY(tempDir.isValid());
+    QFile bodyFile(tempDir.filePath("body"));
+    QVERIFY(bodyFile.open(QIODevice::WriteOnly));
+    QCOMPARE(bodyFile.write("skipped" + body), qint64(body.size() + 7));
+    bodyFile.close();
+    QBuffer bodyBuffer(&body);
+
+    QByteArray receivedBody;
+    QTcpServer server;
+    connect(&server, &QTcpServer::newConnection, this, [&server, &receivedBody]() {
+        QTcpSocket *socket = server.nextPendingConnection();
+        QByteArray *rawData = new QByteArray;
+        connect(socket, &QObject::destroyed, [rawData]() { delete rawData; });
+        connect(socket, &QIODevice::readyRead, socket, [socket, rawData, &receivedBody]() {
+            *rawData += socket->readAll();
+            const int headerEnd = rawData->indexOf("\r\n\r\n");
+            if (headerEnd < 0)
+                return;
+            int contentLength = 0;
+            for (const QByteArray &line : rawData->left(headerEnd).split('\n')) {
+                if (line.toLower().startsWith("content-length:"))
+                    contentLength = line.mid(15).trimmed().toInt();
+            }
+            if (rawData->size() - headerEnd - 4 < contentLength)
+                return;
+            receivedBody = rawData->mid(headerEnd + 4, contentLength);
+            socket->write("HTTP/1.1 200 OK\r\n"
+                          "Content-Type: text/html\r\n"
+                          "Content-Length: 28\r\n\r\n"
+                          "<html><body>ok</body></html>");
+            socket->flush();
+            socket->disconnectFromHost();
+        });
+    });
+    QVERIFY(server.listen());
+
+    QWebEngineHttpRequest request(QUrl("http://127.0.0.1:" + QString::number(server.serverPort())),
+                                  QWebEngineHttpRequest::Post);
+    request.setHeader(QByteArrayLiteral("Content-Type"), QByteArrayLiteral("application/octet-stream"));
+    if (source == QLatin1String("file")) {
+        request.setPostDataFile(bodyFile.fileName());
+        // The whole file is uploaded, including the prefix.
+        body.prepend("skipped");
+    } else if (source == QLatin1String("file device")) {
+        QVERIFY(bodyFile.open(QIODevice::ReadOnly));
+        QVERIFY(bodyFile.seek(7));
+        request.setPostDataDevice(&bodyFile);
+    } else {
+        QVERIFY(bodyBuffer.open(QIODevice::ReadOnly));
+        request.setPostDataDevice(&bodyBuffer);
+    }
+    QVERIFY(request.postData().isEmpty());
+
+    QWebEngineView view;
+    QSignalSpy loadFinishedSpy(view.page(), SIGNAL(loadFinished(bool)));
+    view.load(request);
+    QTRY_COMPARE_WITH_TIMEOUT(loadFinishedSpy.count(), 1, 20000);
+    QVERIFY(loadFinishedSpy.first().first().toBool());
+    QCOMPARE(receivedBody.size(), body.size());
+    QVERIFY(receivedBody == body);
+}
+
+void tst_QWebEngineView::postDataUploadProgress()
+{
+    QByteArray body(4 * 1024 * 1024, 'x');
+    QBuffer bodyBuffer(&body);
+    QVERIFY(bodyBuffer.open(QIODevice::ReadOnly));
+
+    // Reads the body slowly, so the upload position is sampled several times.
+    int receivedBodySize = -1;
+    QTcpServer server;
+    connect(&server, &QTcpServer::newConnection, this, [&server, &receivedBodySize]() {
+        QTcpSocket *socket = server.nextPendingConnection();
+        socket->setReadBufferSize(64 * 1024);
+        QByteArray *rawData = new QByteArray;
+        QTimer *timer = new QTimer(socket);
+        connect(socket, &QObject::destroyed, [rawData]() { delete rawData; });
+        connect(timer, &QTimer::timeout, socket, [socket, timer, rawData, &receivedBodySize]() {
+            *rawData += socket->read(64 * 1024);
+            const int headerEnd = rawData->indexOf("\r\n\r\n");
+            if (headerEnd < 0 || rawData->size() - headerEnd - 4 < 4 * 1024 * 1024)
+                return;
+            timer->stop();
+            receivedBodySize = rawData->size() - headerEnd - 4;
+            socket->write("HTTP/1.1 200 OK\r\n"
+                          "Content-Type: text/html\r\n"
+                          "Content-Length: 28\r\n\r\n"
+                          "<html><body>ok</body></html>");
+            socket->flush();
+            socket->disconnectFromHost();
+        });
+        timer->start(20);
+    });
+    QVERIFY(server.listen());
+
+    QWebEngineHttpRequest request(QUrl("http://127.0.0.1:" + QString::number(server.serverPort())),
+                                  QWebEngineHttpRequest::Post);
+    request.setPostDataDevice(&bodyBuffer);
+
+    QWebEngineView view;
+    QSignalSpy loadFinishedSpy(view.page(), SIGNAL(loadFinished(bool)));
+    QSignalSpy uploadProgressSpy(view.page(), &QWebEnginePage::uploadProgress);
+    view.load(request);
+    QTRY_COMPARE_WITH_TIMEOUT(loadFinishedSpy.count(), 1, 30000);
+    QVERIFY(loadFinishedSpy.first().first().toBool());
+    QCOMPARE(receivedBodySize, body.size());
+
+    QVERIFY(uploadProgressSpy.count() > 0);
+    qint64 lastBytesSent = 0;
+    for (const QList<QVariant> &arguments : qAsConst(uploadProgressSpy)) {
+        const qint64 bytesSent = arguments.at(0).toLongLong();
+        QCOMPARE(arguments.at(1).toLongLong(), qint64(body.size()));
+        QVERIFY(bytesSent >= lastBytesSent);
+        QVERIFY(bytesSent <= body.size());
+        lastBytesSent = bytesSent;
+    }
+}
+
 void tst_QWebEngineView::inputFieldOverridesShortcuts()
 {
     bool actionTriggered = false;
@@ -2654,6 +2796,48 @@ void tst_QWebEngineView::mouseLeave()
     QTRY_COMPARE(innerText(), QStringLiteral("Mouse OUT"));
 }
 
+void tst_QWebEngineView::mouseMoveCoalescing()
+{
+    QWebEngineView view;
+    view.resize(400, 200);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QSignalSpy loadFinishedSpy(&view, SIGNAL(loadFinished(bool)));
+    view.setHtml("<html><head><script>"
+                 "var moves = 0; var lastMove = ''; var lastMoveAtPress = '';"
+                 "document.onmousemove = function(e) { ++moves; lastMove = e.clientX + ',' + e.clientY; };"
+                 "document.onmousedown = function(e) { lastMoveAtPress = lastMove; };"
+                 "</script></head>"
+                 "<body style='margin: 0px; padding: 0px; width: 100%; height: 100%'></body></html>");
+    QVERIFY(loadFinishedSpy.wait());
+
+    // The events are sent without returning to the event loop, so no frame can begin in between.
+    QWidget *renderWidget = view.focusProxy();
+    QVERIFY(renderWidget);
+    auto sendMouseEvent = [renderWidget](QEvent::Type type, const QPoint &pos, Qt::MouseButton button, Qt::MouseButtons buttons) {
+        QMouseEvent event(type, pos, renderWidget->mapToGlobal(pos), button, buttons, Qt::NoModifier);
+        event.setTimestamp(++QTest::lastMouseTimestamp);
+        QSpontaneKeyEvent::setSpontaneous(&event);
+        QApplication::sendEvent(renderWidget, &event);
+    };
+
+    for (int i = 1; i <= 50; ++i)
+        sendMouseEvent(QEvent::MouseMove, QPoint(10 + i * 4, 100), Qt::NoButton, Qt::NoButton);
+
+    // However many moves were merged, the page has to see the last position.
+    QTRY_COMPARE(evaluateJavaScriptSync(view.page(), "lastMove").toString(), QStringLiteral("210,100"));
+    const int moves = evaluateJavaScriptSync(view.page(), "moves").toInt();
+    QVERIFY(moves >= 1);
+    QVERIFY(moves < 50);
+
+    // A move still waiting for the next frame must be delivered before a press that follows it.
+    sendMouseEvent(QEvent::MouseMove, QPoint(300, 150), Qt::NoButton, Qt::NoButton);
+    sendMouseEvent(QEvent::MouseButtonPress, QPoint(300, 150), Qt::LeftButton, Qt::LeftButton);
+    QTRY_COMPARE(evaluateJavaScriptSync(view.page(), "lastMoveAtPress").toString(), QStringLiteral("300,150"));
+    sendMouseEvent(QEvent::MouseButtonRelease, QPoint(300, 150), Qt::LeftButton, Qt::NoButton);
+}
+
 void tst_QWebEngineView::webUIURLs_data()
 {
     QTest::addColumn<QUrl>("url");